@@ -28,6 +28,8 @@
 #include <iterator>
 #include <cmath>
 #include <fstream>
+#include <future>
+#include <atomic>
 
 #include "silkit/SilKit.hpp"
 #include "silkit/SilKitVersion.hpp"
@@ -66,7 +68,13 @@ void PrintUsage(const std::string& executableName)
         << std::endl
         << "\t--configuration\tPath and filename of the participant configuration YAML or JSON file. Default: empty"
         << std::endl
-        << "\t--write-csv\tPath and filename of csv file with benchmark results. Default: empty" << std::endl;
+        << "\t--write-csv\tPath and filename of csv file with benchmark results. Default: empty" << std::endl
+        << "\t--io-mode\tI/O of the participants: 'blocking', 'polling' (busy-polling I/O worker), or 'both' to "
+           "measure and compare both. Default: blocking"
+        << std::endl
+        << "\t--polling-configuration\tPath and filename of the participant configuration used for the polling "
+           "measurement. Default: Middleware/IoBusyPoll enabled"
+        << std::endl;
 }
 
 struct BenchmarkConfig
@@ -77,6 +85,8 @@ struct BenchmarkConfig
     std::string registryUri = "silkit://localhost:8500";
     std::string silKitConfigPath = "";
     std::string writeCsv = "";
+    std::string ioMode = "blocking";
+    std::string pollingConfigPath = "";
 };
 
 bool Parse(int argc, char** argv, BenchmarkConfig& config)
@@ -159,6 +169,8 @@ bool Parse(int argc, char** argv, BenchmarkConfig& config)
     parseOptional("--message-count", config.messageCount, asNum);
     parseOptional("--configuration", config.silKitConfigPath, asStr);
     parseOptional("--write-csv", config.writeCsv, asStr);
+    parseOptional("--io-mode", config.ioMode, asStr);
+    parseOptional("--polling-configuration", config.pollingConfigPath, asStr);
 
     //check unknown long options
     for (const auto& arg : args)
@@ -222,6 +234,11 @@ bool Validate(const BenchmarkConfig& config)
         std::cout << "Invalid argument: The message payload size must be at least 1 byte." << std::endl;
         return false;
     }
+    if (config.ioMode != "blocking" && config.ioMode != "polling" && config.ioMode != "both")
+    {
+        std::cout << "Invalid argument: The I/O mode must be 'blocking', 'polling', or 'both'." << std::endl;
+        return false;
+    }
 
     return true;
 }
@@ -251,6 +268,8 @@ void PrintParameters(BenchmarkConfig benchmark)
               << std::left << std::setw(38) << "- Registry URI: " << benchmark.registryUri << std::endl
               << std::left << std::setw(38) << "- Configuration: " << benchmark.silKitConfigPath << std::endl
               << std::left << std::setw(38) << "- CSV output: " << benchmark.writeCsv << std::endl
+              << std::left << std::setw(38) << "- I/O mode: " << benchmark.ioMode << std::endl
+              << std::left << std::setw(38) << "- Polling configuration: " << benchmark.pollingConfigPath << std::endl
               << std::endl;
 }
 
@@ -271,194 +290,289 @@ std::pair<T, T> mean_and_error(const std::vector<T>& vec)
     return std::make_pair(mean, std::sqrt(std::accumulate(vec.begin(), vec.end(), 0.0, variance_func)));
 }
 
-/**************************************************************************************************
- * Main Function
- **************************************************************************************************/
-int main(int argc, char** argv)
+struct LatencyResult
 {
-    std::cout.precision(3);
-    BenchmarkConfig benchmark;
-    if (!Parse(argc, argv, benchmark) || !Validate(benchmark))
-    {
-        return -1;
-    }
+    std::string ioMode;
+    double durationSeconds{0.0};
+    double throughput{0.0};
+    std::pair<double, double> latency{0.0, 0.0};
+};
 
-    PrintParameters(benchmark);
+// Used for the polling measurement, if no --polling-configuration is given
+const auto defaultPollingConfiguration = R"({"Middleware": {"IoBusyPoll": true}})";
 
-    try
+auto MakeParticipantConfiguration(const BenchmarkConfig& benchmark, const std::string& ioMode)
+    -> std::shared_ptr<SilKit::Config::IParticipantConfiguration>
+{
+    if (ioMode == "polling")
     {
-        std::shared_ptr<SilKit::Config::IParticipantConfiguration> config;
-        if (benchmark.silKitConfigPath == "")
-        {
-            config = SilKit::Config::ParticipantConfigurationFromString("{}");
-        }
-        else
+        if (benchmark.pollingConfigPath == "")
         {
-            config = SilKit::Config::ParticipantConfigurationFromFile(benchmark.silKitConfigPath);
+            return SilKit::Config::ParticipantConfigurationFromString(defaultPollingConfiguration);
         }
+        return SilKit::Config::ParticipantConfigurationFromFile(benchmark.pollingConfigPath);
+    }
+
+    if (benchmark.silKitConfigPath == "")
+    {
+        return SilKit::Config::ParticipantConfigurationFromString("{}");
+    }
+    return SilKit::Config::ParticipantConfigurationFromFile(benchmark.silKitConfigPath);
+}
+
+// Returns false for the receiver, which has no results
+bool RunLatencyMeasurement(const BenchmarkConfig& benchmark, const std::string& ioMode, LatencyResult& result)
+{
+    std::cout << std::endl << "Measuring with " << ioMode << " I/O ..." << std::endl;
+
+    auto config = MakeParticipantConfiguration(benchmark, ioMode);
 
-        std::vector<std::chrono::nanoseconds> measuredRoundtrips;
-        std::chrono::high_resolution_clock::time_point startTimestamp{};
+    std::vector<std::chrono::nanoseconds> measuredRoundtrips;
+    std::chrono::high_resolution_clock::time_point startTimestamp{};
 
-        // -----------------------------------
-        // Runtime measurement
+    // -----------------------------------
+    // Runtime measurement
 
-        std::string participantName = benchmark.isReceiver ? " Receiver" : "Sender";
-        std::vector<uint8_t> data(benchmark.messageSizeInBytes, '*');
-        auto participant = SilKit::CreateParticipant(config, participantName, benchmark.registryUri);
+    // Participants and topics are separate for each I/O mode, so consecutive measurements do not interfere
+    std::string participantName = (benchmark.isReceiver ? "Receiver-" : "Sender-") + ioMode;
+    std::vector<uint8_t> data(benchmark.messageSizeInBytes, '*');
+    auto participant = SilKit::CreateParticipant(config, participantName, benchmark.registryUri);
 
-        uint32_t sendCount{0};
-        std::atomic_bool allSent{false};
-        std::promise<void> allSentPromise;
-        std::chrono::high_resolution_clock::time_point sendTime;
+    uint32_t sendCount{0};
+    std::atomic_bool allSent{false};
+    std::promise<void> allSentPromise;
+    std::chrono::high_resolution_clock::time_point sendTime;
 
-        std::string topicPub = benchmark.isReceiver ? "Pong" : "Ping";
-        std::string topicSub = benchmark.isReceiver ? "Ping" : "Pong";
-        auto publisher = participant->CreateDataPublisher("PubCtrl1", {topicPub, {}}, 1);
-        participant->CreateDataSubscriber(
-            "SubCtrl1", {topicSub, {}},
-            [data, publisher, benchmark, &sendCount, &allSent, &allSentPromise,
+    std::string topicPub = (benchmark.isReceiver ? "Pong-" : "Ping-") + ioMode;
+    std::string topicSub = (benchmark.isReceiver ? "Ping-" : "Pong-") + ioMode;
+    auto publisher = participant->CreateDataPublisher("PubCtrl1", {topicPub, {}}, 1);
+    participant->CreateDataSubscriber(
+        "SubCtrl1", {topicSub, {}},
+        [data, publisher, benchmark, &sendCount, &allSent, &allSentPromise,
 
-             &measuredRoundtrips, &sendTime, &startTimestamp](auto*, auto&) {
-                if (!allSent)
+         &measuredRoundtrips, &sendTime, &startTimestamp](auto*, auto&) {
+            if (!allSent)
+            {
+                if (!benchmark.isReceiver)
                 {
-                    if (!benchmark.isReceiver)
-                    {
-                        if (sendCount == 0)
-                        {
-                            startTimestamp = std::chrono::high_resolution_clock::now(); // Initial receive: Start runtime measurement
-                        }
-                        else
-                        {
-                            measuredRoundtrips.push_back(std::chrono::high_resolution_clock::now() - sendTime);
-                        }
-                        sendTime = std::chrono::high_resolution_clock::now();
-                    }
-                    publisher->Publish(data);
-                    sendCount++;
-                    if (benchmark.isReceiver && (benchmark.messageCount <= 20 || sendCount % (benchmark.messageCount / 20) == 0))
+                    if (sendCount == 0)
                     {
-                        std::cout << ".";
+                        startTimestamp = std::chrono::high_resolution_clock::now(); // Initial receive: Start runtime measurement
                     }
-                    if (sendCount >= benchmark.messageCount+1) // Initial publish has no timing, use +1
+                    else
                     {
-                        allSentPromise.set_value();
-                        allSent = true;
+                        measuredRoundtrips.push_back(std::chrono::high_resolution_clock::now() - sendTime);
                     }
+                    sendTime = std::chrono::high_resolution_clock::now();
                 }
-            });
+                publisher->Publish(data);
+                sendCount++;
+                if (benchmark.isReceiver && (benchmark.messageCount <= 20 || sendCount % (benchmark.messageCount / 20) == 0))
+                {
+                    std::cout << ".";
+                }
+                if (sendCount >= benchmark.messageCount+1) // Initial publish has no timing, use +1
+                {
+                    allSentPromise.set_value();
+                    allSent = true;
+                }
+            }
+        });
 
-        if (!benchmark.isReceiver) // Initial publish without timing
-        {
-            publisher->Publish(data);
-        }
-        auto allSendFuture = allSentPromise.get_future();
-        allSendFuture.wait();
+    if (!benchmark.isReceiver) // Initial publish without timing
+    {
+        publisher->Publish(data);
+    }
+    auto allSendFuture = allSentPromise.get_future();
+    allSendFuture.wait();
 
-        // -----------------------------------
-        // End Runtime measurement
+    // -----------------------------------
+    // End Runtime measurement
 
-        auto duration = std::chrono::high_resolution_clock::now() - startTimestamp;
-        std::cout << std::endl << std::endl << "Runtime measurement done. Synchronizing ..." << std::endl;
+    auto duration = std::chrono::high_resolution_clock::now() - startTimestamp;
+    std::cout << std::endl << std::endl << "Runtime measurement done. Synchronizing ..." << std::endl;
 
-        // Sync Ping-Pong to make sure last publish (probably large) has arrived
-        std::promise<void> syncParticipants;
-        std::string topicPubAllDone = benchmark.isReceiver ? "AllDoneReceiver" : "AllDoneSender";
-        std::string topicSubAllDone = benchmark.isReceiver ? "AllDoneSender" : "AllDoneReceiver";
-        auto allDonePublisher = participant->CreateDataPublisher("PubCtrl2", {topicPubAllDone, {}}, 1);
-        if (benchmark.isReceiver)
-        {
-            allDonePublisher->Publish(std::vector<uint8_t>{0});
-        }
-        participant->CreateDataSubscriber("SubCtrl2", {topicSubAllDone, {}},
-            [&syncParticipants, benchmark, allDonePublisher](auto*, auto&) {
-                if (!benchmark.isReceiver)
-                {
-                    allDonePublisher->Publish(std::vector<uint8_t>{0});
-                }
-                syncParticipants.set_value();
-            });
-        auto syncParticipantsFuture = syncParticipants.get_future();
-        syncParticipantsFuture.wait();
-        std::cout << "... done." << std::endl;
+    // Sync Ping-Pong to make sure last publish (probably large) has arrived
+    std::promise<void> syncParticipants;
+    std::string topicPubAllDone = (benchmark.isReceiver ? "AllDoneReceiver-" : "AllDoneSender-") + ioMode;
+    std::string topicSubAllDone = (benchmark.isReceiver ? "AllDoneSender-" : "AllDoneReceiver-") + ioMode;
+    auto allDonePublisher = participant->CreateDataPublisher("PubCtrl2", {topicPubAllDone, {}}, 1);
+    if (benchmark.isReceiver)
+    {
+        allDonePublisher->Publish(std::vector<uint8_t>{0});
+    }
+    participant->CreateDataSubscriber("SubCtrl2", {topicSubAllDone, {}},
+        [&syncParticipants, benchmark, allDonePublisher](auto*, auto&) {
+            if (!benchmark.isReceiver)
+            {
+                allDonePublisher->Publish(std::vector<uint8_t>{0});
+            }
+            syncParticipants.set_value();
+        });
+    auto syncParticipantsFuture = syncParticipants.get_future();
+    syncParticipantsFuture.wait();
+    std::cout << "... done." << std::endl;
 
-        if (benchmark.isReceiver) // Receiver is done here
-        {
-            std::cout << "Receiver done." << std::endl;
-            return 0;
-        }
+    if (benchmark.isReceiver) // Receiver is done here
+    {
+        return false;
+    }
+
+    // -----------------------------------
+    // Calculation of KPIs
+
+    std::vector<double> measuredLatencySeconds(measuredRoundtrips.size());
+    std::transform(measuredRoundtrips.begin(), measuredRoundtrips.end(), measuredLatencySeconds.begin(),
+                   [](auto d) {
+                       return static_cast<double>(d.count() / 1.e3 * 0.5); // Convert to microseconds, factor 0.5 for latency from roundtrip
+                   });
+
+    result.ioMode = ioMode;
+    result.latency = mean_and_error(measuredLatencySeconds);
+
+    // Total throughput includes both direction, hence the factor 2.0
+    result.durationSeconds = duration.count() / 1e9;
+    result.throughput =
+        2.0 * benchmark.messageCount * benchmark.messageSizeInBytes / 1024.0 / 1024.0 / result.durationSeconds;
+
+    return true;
+}
+
+void PrintResult(const LatencyResult& result)
+{
+    std::ostringstream averageLatencyWithUnit;
+    averageLatencyWithUnit.precision(3);
+    averageLatencyWithUnit << result.latency.first << " us";
+
+    std::ostringstream throughputWithUnit;
+    throughputWithUnit.precision(3);
+    throughputWithUnit << result.throughput << " MiB/s";
 
-        // -----------------------------------
-        // Calculation of KPIs
+    std::cout << std::endl << std::endl << "Result of the simulation run (" << result.ioMode << " I/O):" << std::endl << std::endl;
+
+    // Stream helper to combine value and unit to use it with std::setw as a whole
+    std::ostringstream durationWithUnit;
+    durationWithUnit.precision(3);
+    durationWithUnit << result.durationSeconds << " s";
+
+    std::cout << std::setw(38) << "- Realtime duration (runtime): "     << std::setw(6) << durationWithUnit.str() << std::endl
+              << std::setw(38) << "- Throughput (data size/runtime): " << std::setw(6) << throughputWithUnit.str() << std::endl
+              << std::setw(38) << "- Latency: "                         << std::setw(6) << averageLatencyWithUnit.str() << " +/- " << result.latency.second << std::endl
+              << std::endl;
+}
 
-        std::vector<double> measuredLatencySeconds(measuredRoundtrips.size());
-        std::transform(measuredRoundtrips.begin(), measuredRoundtrips.end(), measuredLatencySeconds.begin(),
-                       [](auto d) {
-                           return static_cast<double>(d.count() / 1.e3 * 0.5); // Convert to microseconds, factor 0.5 for latency from roundtrip
-                       });
+void PrintComparison(const std::vector<LatencyResult>& results)
+{
+    if (results.size() < 2)
+    {
+        return;
+    }
 
-        const auto averageLatency = mean_and_error(measuredLatencySeconds);
+    std::cout << "Latency by I/O mode:" << std::endl << std::endl;
+    for (const auto& result : results)
+    {
         std::ostringstream averageLatencyWithUnit;
         averageLatencyWithUnit.precision(3);
-        averageLatencyWithUnit << averageLatency.first << " us";
+        averageLatencyWithUnit << result.latency.first << " us";
 
-        // Total throughput includes both direction, hence the factor 2.0
-        const auto durationSeconds = duration.count() / 1e9;
-        const auto throughput =
-            2.0 * benchmark.messageCount * benchmark.messageSizeInBytes / 1024.0 / 1024.0 / durationSeconds;
-        std::ostringstream throughputWithUnit;
-        throughputWithUnit.precision(3);
-        throughputWithUnit << throughput << " MiB/s";
+        std::cout << std::setw(38) << ("- " + result.ioMode + ": ") << std::setw(6) << averageLatencyWithUnit.str()
+                  << " +/- " << result.latency.second << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+void WriteCsv(const BenchmarkConfig& benchmark, const std::vector<LatencyResult>& results)
+{
+    std::stringstream csvHeader;
+    csvHeader << "# SilKitBenchmarkDemo, SIL Kit Version " << SilKit::Version::String();
+    const auto csvColumns =
+        "messageSize; messageCount; runtime(s); throughput(MiB/s); latency(us); latency_err; ioMode";
+    std::fstream csvFile;
+    csvFile.open(benchmark.writeCsv, std::ios_base::in | std::ios_base::out); // Try to open
+    bool csvValid{true};
+    if (!csvFile.is_open())
+    {
+        // File doesn't exist, create new file and write header
+        csvFile.open(benchmark.writeCsv, std::ios_base::in | std::ios_base::out | std::ios_base::trunc);
+        csvFile << csvHeader.str() << std::endl;
+        csvFile << csvColumns << std::endl;
+    }
+    else
+    {
+        // File is there, check if header is valid
+        std::string header;
+        std::getline(csvFile, header);
+        csvFile.clear();
+        if (header != csvHeader.str())
+        {
+            std::cerr << "Invalid header in file \"" << benchmark.writeCsv << "\"." << std::endl;
+            csvValid = false;
+        }
+    }
+    if (csvValid)
+    {
+        // Append data
+        csvFile.seekp(0, std::ios_base::end);
+        for (const auto& result : results)
+        {
+            csvFile << benchmark.messageSizeInBytes << ";" << benchmark.messageCount << ";"
+                    << result.durationSeconds << ";"
+                    << result.throughput << ";"
+                    << result.latency.first << ";" << result.latency.second << ";"
+                    << result.ioMode << std::endl;
+        }
+    }
+    csvFile.close();
+}
 
-        std::cout << std::endl << std::endl << "Result of the simulation run:" << std::endl << std::endl;
+/**************************************************************************************************
+ * Main Function
+ **************************************************************************************************/
+int main(int argc, char** argv)
+{
+    std::cout.precision(3);
+    BenchmarkConfig benchmark;
+    if (!Parse(argc, argv, benchmark) || !Validate(benchmark))
+    {
+        return -1;
+    }
 
-        // Stream helper to combine value and unit to use it with std::setw as a whole
-        std::ostringstream durationWithUnit;
-        durationWithUnit.precision(3);
-        durationWithUnit << durationSeconds << " s";
+    PrintParameters(benchmark);
 
-        std::cout << std::setw(38) << "- Realtime duration (runtime): "     << std::setw(6) << durationWithUnit.str() << std::endl
-                  << std::setw(38) << "- Throughput (data size/runtime): " << std::setw(6) << throughputWithUnit.str() << std::endl
-                  << std::setw(38) << "- Latency: "                         << std::setw(6) << averageLatencyWithUnit.str() << " +/- " << averageLatency.second << std::endl
-                  << std::endl;
+    std::vector<std::string> ioModes;
+    if (benchmark.ioMode == "both")
+    {
+        ioModes = {"blocking", "polling"};
+    }
+    else
+    {
+        ioModes = {benchmark.ioMode};
+    }
 
-        if (benchmark.writeCsv != "")
+    try
+    {
+        std::vector<LatencyResult> results;
+        for (const auto& ioMode : ioModes)
         {
-            std::stringstream csvHeader;
-            csvHeader << "# SilKitBenchmarkDemo, SIL Kit Version " << SilKit::Version::String();
-            const auto csvColumns = "messageSize; messageCount; runtime(s); throughput(MiB/s); latency(us); latency_err";
-            std::fstream csvFile;
-            csvFile.open(benchmark.writeCsv, std::ios_base::in | std::ios_base::out); // Try to open
-            bool csvValid{true};
-            if (!csvFile.is_open())
-            {
-                // File doesn't exist, create new file and write header
-                csvFile.open(benchmark.writeCsv, std::ios_base::in | std::ios_base::out | std::ios_base::trunc);
-                csvFile << csvHeader.str() << std::endl;
-                csvFile << csvColumns << std::endl;
-            }
-            else
-            {
-                // File is there, check if header is valid
-                std::string header;
-                std::getline(csvFile, header);
-                csvFile.clear();
-                if (header != csvHeader.str())
-                {
-                    std::cerr << "Invalid header in file \"" << benchmark.writeCsv << "\"." << std::endl;
-                    csvValid = false;
-                }
-            }
-            if (csvValid)
+            LatencyResult result;
+            if (RunLatencyMeasurement(benchmark, ioMode, result))
             {
-                // Append data
-                csvFile.seekp(0, std::ios_base::end);
-                csvFile << benchmark.messageSizeInBytes << ";" << benchmark.messageCount << ";" 
-                        << durationSeconds << ";"
-                        << throughput << ";"
-                        << averageLatency.first << ";" << averageLatency.second << std::endl;
+                PrintResult(result);
+                results.push_back(result);
             }
-            csvFile.close();
+        }
+
+        if (benchmark.isReceiver)
+        {
+            std::cout << "Receiver done." << std::endl;
+            return 0;
+        }
+
+        PrintComparison(results);
+
+        if (benchmark.writeCsv != "")
+        {
+            WriteCsv(benchmark, results);
         }
     }
     catch (const SilKit::ConfigurationError& error)
@@ -770,6 +770,28 @@ extern "C"
         return globalCapi->SilKit_Participant_GetLogger(outLogger, participant);
     }
 
+    SilKit_ReturnCode SilKitCALL SilKit_Experimental_Participant_BeginRegistrationBatch(SilKit_Participant* participant)
+    {
+        return globalCapi->SilKit_Experimental_Participant_BeginRegistrationBatch(participant);
+    }
+
+    SilKit_ReturnCode SilKitCALL SilKit_Experimental_Participant_EndRegistrationBatch(SilKit_Participant* participant)
+    {
+        return globalCapi->SilKit_Experimental_Participant_EndRegistrationBatch(participant);
+    }
+
+    SilKit_ReturnCode SilKitCALL SilKit_Experimental_Participant_GetPeerStatistics(
+        SilKit_Participant* participant, void* context, SilKit_Experimental_PeerStatisticsHandler_t handler)
+    {
+        return globalCapi->SilKit_Experimental_Participant_GetPeerStatistics(participant, context, handler);
+    }
+
+    SilKit_ReturnCode SilKitCALL SilKit_Experimental_Participant_GetSimulationStepStatistics(
+        SilKit_Participant* participant, void* context, SilKit_Experimental_SimulationStepStatisticsHandler_t handler)
+    {
+        return globalCapi->SilKit_Experimental_Participant_GetSimulationStepStatistics(participant, context, handler);
+    }
+
     // ParticipantConfiguration
 
     SilKit_ReturnCode SilKitCALL SilKit_ParticipantConfiguration_FromString(
@@ -416,6 +416,19 @@ public:
     MOCK_METHOD(SilKit_ReturnCode, SilKit_Participant_GetLogger,
                 (SilKit_Logger * *outLogger, SilKit_Participant* participant));
 
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_Experimental_Participant_BeginRegistrationBatch,
+                (SilKit_Participant * participant));
+
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_Experimental_Participant_EndRegistrationBatch,
+                (SilKit_Participant * participant));
+
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_Experimental_Participant_GetPeerStatistics,
+                (SilKit_Participant * participant, void* context, SilKit_Experimental_PeerStatisticsHandler_t handler));
+
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_Experimental_Participant_GetSimulationStepStatistics,
+                (SilKit_Participant * participant, void* context,
+                 SilKit_Experimental_SimulationStepStatisticsHandler_t handler));
+
     // ParticipantConfiguration
 
     MOCK_METHOD(SilKit_ReturnCode, SilKit_ParticipantConfiguration_FromString,
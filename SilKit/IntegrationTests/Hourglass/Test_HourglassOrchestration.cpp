@@ -573,6 +573,116 @@ TEST_F(Test_HourglassOrchestration, SilKit_Experimental_SystemController_Create)
     SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Participant::CreateSystemController(&participant);
 }
 
+TEST_F(Test_HourglassOrchestration, SilKit_Experimental_Participant_RegistrationBatch)
+{
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Participant participant{mockParticipant};
+
+    {
+        testing::InSequence sequence;
+        EXPECT_CALL(capi, SilKit_Experimental_Participant_BeginRegistrationBatch(mockParticipant)).Times(1);
+        EXPECT_CALL(capi, SilKit_Experimental_Participant_EndRegistrationBatch(mockParticipant)).Times(1);
+    }
+
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Participant::RegistrationBatch batch{&participant};
+    batch.End();
+}
+
+TEST_F(Test_HourglassOrchestration, SilKit_Experimental_Participant_GetPeerStatistics)
+{
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Participant participant{mockParticipant};
+
+    EXPECT_CALL(capi, SilKit_Experimental_Participant_GetPeerStatistics(mockParticipant, testing::_, testing::_))
+        .WillOnce([](SilKit_Participant* participant, void* context,
+                     SilKit_Experimental_PeerStatisticsHandler_t handler) {
+            SilKit_Experimental_PeerStatistics statistics;
+            SilKit_Struct_Init(SilKit_Experimental_PeerStatistics, statistics);
+            statistics.participantName = "Peer1";
+            statistics.sentMessages = 1;
+            statistics.sentBytes = 2;
+            statistics.receivedMessages = 3;
+            statistics.receivedBytes = 4;
+            statistics.sendQueueMessages = 5;
+            statistics.sendQueueBytes = 6;
+            statistics.peakSendQueueMessages = 7;
+            statistics.peakSendQueueBytes = 8;
+            statistics.sendBatches = 9;
+            statistics.maxSendBatchMessages = 10;
+            statistics.maxSendBatchBytes = 11;
+            statistics.roundTripTime = 12;
+            handler(context, participant, &statistics);
+            return SilKit_ReturnCode_SUCCESS;
+        });
+
+    const auto peerStatistics =
+        SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Participant::GetPeerStatistics(&participant);
+
+    ASSERT_EQ(peerStatistics.size(), 1u);
+    EXPECT_EQ(peerStatistics[0].participantName, "Peer1");
+    EXPECT_EQ(peerStatistics[0].sentMessages, 1u);
+    EXPECT_EQ(peerStatistics[0].sentBytes, 2u);
+    EXPECT_EQ(peerStatistics[0].receivedMessages, 3u);
+    EXPECT_EQ(peerStatistics[0].receivedBytes, 4u);
+    EXPECT_EQ(peerStatistics[0].sendQueueMessages, 5u);
+    EXPECT_EQ(peerStatistics[0].sendQueueBytes, 6u);
+    EXPECT_EQ(peerStatistics[0].peakSendQueueMessages, 7u);
+    EXPECT_EQ(peerStatistics[0].peakSendQueueBytes, 8u);
+    EXPECT_EQ(peerStatistics[0].sendBatches, 9u);
+    EXPECT_EQ(peerStatistics[0].maxSendBatchMessages, 10u);
+    EXPECT_EQ(peerStatistics[0].maxSendBatchBytes, 11u);
+    EXPECT_EQ(peerStatistics[0].roundTripTime, std::chrono::nanoseconds{12});
+}
+
+TEST_F(Test_HourglassOrchestration, SilKit_Experimental_Participant_GetSimulationStepStatistics)
+{
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Participant participant{mockParticipant};
+
+    EXPECT_CALL(capi,
+                SilKit_Experimental_Participant_GetSimulationStepStatistics(mockParticipant, testing::_, testing::_))
+        .WillOnce([](SilKit_Participant* participant, void* context,
+                     SilKit_Experimental_SimulationStepStatisticsHandler_t handler) {
+            SilKit_Experimental_SimulationStepBlockingParticipant blockingParticipant;
+            blockingParticipant.participantName = "Peer1";
+            blockingParticipant.blockedSteps = 11;
+            blockingParticipant.waitTime = 12;
+
+            SilKit_Experimental_SimulationStepStatistics statistics;
+            SilKit_Struct_Init(SilKit_Experimental_SimulationStepStatistics, statistics);
+            statistics.executedSteps = 1;
+            statistics.recordedSteps = 2;
+            statistics.waitTimeMedian = 3;
+            statistics.waitTimeP90 = 4;
+            statistics.waitTimeP99 = 5;
+            statistics.waitTimeMax = 6;
+            statistics.execTimeMedian = 7;
+            statistics.execTimeP90 = 8;
+            statistics.execTimeP99 = 9;
+            statistics.execTimeMax = 10;
+            statistics.numBlockingParticipants = 1;
+            statistics.blockingParticipants = &blockingParticipant;
+            handler(context, participant, &statistics);
+            return SilKit_ReturnCode_SUCCESS;
+        });
+
+    const auto stepStatistics =
+        SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Participant::GetSimulationStepStatistics(
+            &participant);
+
+    EXPECT_EQ(stepStatistics.executedSteps, 1u);
+    EXPECT_EQ(stepStatistics.recordedSteps, 2u);
+    EXPECT_EQ(stepStatistics.waitTimeMedian, std::chrono::nanoseconds{3});
+    EXPECT_EQ(stepStatistics.waitTimeP90, std::chrono::nanoseconds{4});
+    EXPECT_EQ(stepStatistics.waitTimeP99, std::chrono::nanoseconds{5});
+    EXPECT_EQ(stepStatistics.waitTimeMax, std::chrono::nanoseconds{6});
+    EXPECT_EQ(stepStatistics.execTimeMedian, std::chrono::nanoseconds{7});
+    EXPECT_EQ(stepStatistics.execTimeP90, std::chrono::nanoseconds{8});
+    EXPECT_EQ(stepStatistics.execTimeP99, std::chrono::nanoseconds{9});
+    EXPECT_EQ(stepStatistics.execTimeMax, std::chrono::nanoseconds{10});
+    ASSERT_EQ(stepStatistics.blockingParticipants.size(), 1u);
+    EXPECT_EQ(stepStatistics.blockingParticipants[0].participantName, "Peer1");
+    EXPECT_EQ(stepStatistics.blockingParticipants[0].blockedSteps, 11u);
+    EXPECT_EQ(stepStatistics.blockingParticipants[0].waitTime, std::chrono::nanoseconds{12});
+}
+
 TEST_F(Test_HourglassOrchestration, SilKit_Experimental_SystemController_AbortSimulation)
 {
     SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Experimental::Services::Orchestration::SystemController
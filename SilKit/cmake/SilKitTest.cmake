@@ -132,3 +132,34 @@ function(add_silkit_test_to_executable SILKIT_TEST_EXECUTABLE_NAME)
         )
     endforeach ()
 endfunction()
+
+
+function(add_silkit_benchmark_executable SILKIT_BENCHMARK_EXECUTABLE_NAME)
+    if(NOT ${SILKIT_BUILD_TESTS})
+        return()
+    endif()
+
+    set(mva SOURCES LIBS)
+
+    cmake_parse_arguments(arg
+        ""
+        ""
+        "${mva}"
+        ${ARGN}
+    )
+
+    # benchmarks are built alongside the tests, but are not registered with CTest
+    add_executable("${SILKIT_BENCHMARK_EXECUTABLE_NAME}" ${arg_SOURCES})
+
+    target_link_libraries("${SILKIT_BENCHMARK_EXECUTABLE_NAME}"
+        PRIVATE SilKitInterface
+        PRIVATE ${arg_LIBS}
+    )
+
+    set_property(TARGET "${SILKIT_BENCHMARK_EXECUTABLE_NAME}" PROPERTY FOLDER "Benchmarks")
+
+    set_target_properties("${SILKIT_BENCHMARK_EXECUTABLE_NAME}" PROPERTIES
+        RUNTIME_OUTPUT_DIRECTORY "${CMAKE_BINARY_DIR}/$<CONFIG>"
+        LIBRARY_OUTPUT_DIRECTORY "${CMAKE_BINARY_DIR}/$<CONFIG>"
+    )
+endfunction()
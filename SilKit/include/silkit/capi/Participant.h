@@ -24,6 +24,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <limits.h>
 #include "silkit/capi/SilKitMacros.h"
 #include "silkit/capi/Types.h"
+#include "silkit/capi/InterfaceIdentifiers.h"
 #include "silkit/capi/Logger.h"
 
 #pragma pack(push)
@@ -78,6 +79,151 @@ SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_Participant_GetLogger(SilKit_Logge
 
 typedef SilKit_ReturnCode (SilKitFPTR *SilKit_Participant_GetLogger_t)(SilKit_Logger** outLogger, SilKit_Participant* participant);
 
+/*! \brief Start registering the controllers created at a participant together.
+ *
+ * The subscriptions of all controllers created until the matching \ref SilKit_Experimental_Participant_EndRegistrationBatch
+ * are announced to the other participants together, instead of waiting for their acknowledgement after creating each
+ * controller. The controllers must not be used before the batch has ended. Batches can be nested, only the outermost
+ * batch is effective.
+ *
+ * @warning This function is not part of the stable API and ABI of the SIL Kit. It may be removed at any time without
+ *          prior notice.
+ *
+ * @param participant The participant at which the controllers are created.
+ */
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_Experimental_Participant_BeginRegistrationBatch(SilKit_Participant* participant);
+
+typedef SilKit_ReturnCode (SilKitFPTR *SilKit_Experimental_Participant_BeginRegistrationBatch_t)(SilKit_Participant* participant);
+
+/*! \brief Finish registering the controllers created since \ref SilKit_Experimental_Participant_BeginRegistrationBatch.
+ *
+ * Blocks until the subscriptions of all controllers created in the batch have been acknowledged by the other
+ * participants.
+ *
+ * @warning This function is not part of the stable API and ABI of the SIL Kit. It may be removed at any time without
+ *          prior notice.
+ *
+ * @param participant The participant at which the controllers are created.
+ */
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_Experimental_Participant_EndRegistrationBatch(SilKit_Participant* participant);
+
+typedef SilKit_ReturnCode (SilKitFPTR *SilKit_Experimental_Participant_EndRegistrationBatch_t)(SilKit_Participant* participant);
+
+/*! \brief Transport statistics of the connection to another participant, or to the registry.
+ *
+ * @warning This structure is not part of the stable API and ABI of the SIL Kit. It may be removed at any time without
+ *          prior notice.
+ */
+typedef struct SilKit_Experimental_PeerStatistics
+{
+    SilKit_StructHeader structHeader; //!< The interface id specifying which version of this struct was obtained
+    const char* participantName; //!< Name of the remote participant
+
+    uint64_t sentMessages; //!< Messages written into the connection
+    uint64_t sentBytes; //!< Bytes written into the connection, after the compression of messages
+    uint64_t receivedMessages; //!< Messages read from the connection
+    uint64_t receivedBytes; //!< Bytes read from the connection, before the decompression of messages
+
+    uint64_t sendQueueMessages; //!< Messages currently waiting in the sending queue
+    uint64_t sendQueueBytes; //!< Bytes currently waiting in the sending queue
+    uint64_t peakSendQueueMessages; //!< Largest number of messages waiting in the sending queue so far
+    uint64_t peakSendQueueBytes; //!< Largest number of bytes waiting in the sending queue so far
+
+    uint64_t sendBatches; //!< Writes into the connection, each of them coalesces one or more messages
+    uint64_t maxSendBatchMessages; //!< Largest number of messages coalesced into a single write
+    uint64_t maxSendBatchBytes; //!< Largest number of bytes coalesced into a single write
+
+    SilKit_NanosecondsTime roundTripTime; //!< Round-trip time estimated by the operating system (TCP only), or zero
+} SilKit_Experimental_PeerStatistics;
+
+/*! Callback type receiving the statistics of a single connection.
+ * Cf., \ref SilKit_Experimental_Participant_GetPeerStatistics
+ */
+typedef void (SilKitFPTR *SilKit_Experimental_PeerStatisticsHandler_t)(
+    void* context, SilKit_Participant* participant, const SilKit_Experimental_PeerStatistics* peerStatistics);
+
+/*! \brief Obtain the transport statistics of all connections of a participant.
+ *
+ * The handler is called once for every connection, before this function returns. The statistics, including the
+ * participant name, are only valid during the call of the handler.
+ *
+ * @warning This function is not part of the stable API and ABI of the SIL Kit. It may be removed at any time without
+ *          prior notice.
+ *
+ * @param participant The participant whose connections are inspected.
+ * @param context The user context pointer made available to the handler.
+ * @param handler The handler to be called for every connection.
+ */
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_Experimental_Participant_GetPeerStatistics(
+    SilKit_Participant* participant, void* context, SilKit_Experimental_PeerStatisticsHandler_t handler);
+
+typedef SilKit_ReturnCode (SilKitFPTR *SilKit_Experimental_Participant_GetPeerStatistics_t)(
+    SilKit_Participant* participant, void* context, SilKit_Experimental_PeerStatisticsHandler_t handler);
+
+/*! \brief Participant that prevented the time advance of the recorded simulation steps.
+ *
+ * @warning This structure is not part of the stable API and ABI of the SIL Kit. It may be removed at any time without
+ *          prior notice.
+ */
+typedef struct SilKit_Experimental_SimulationStepBlockingParticipant
+{
+    const char* participantName; //!< Name of the other participant, or of the time coordinator
+    uint64_t blockedSteps; //!< Number of steps which waited for this participant
+    SilKit_NanosecondsTime waitTime; //!< Waiting time of these steps, in total
+} SilKit_Experimental_SimulationStepBlockingParticipant;
+
+/*! \brief Summary of the most recent simulation steps, as recorded by the step profiler.
+ *
+ * @warning This structure is not part of the stable API and ABI of the SIL Kit. It may be removed at any time without
+ *          prior notice.
+ */
+typedef struct SilKit_Experimental_SimulationStepStatistics
+{
+    SilKit_StructHeader structHeader; //!< The interface id specifying which version of this struct was obtained
+
+    uint64_t executedSteps; //!< Simulation steps executed by the participant
+    uint64_t recordedSteps; //!< Most recent simulation steps the summary is based on
+
+    SilKit_NanosecondsTime waitTimeMedian; //!< Median of the waiting times
+    SilKit_NanosecondsTime waitTimeP90; //!< 90th percentile of the waiting times
+    SilKit_NanosecondsTime waitTimeP99; //!< 99th percentile of the waiting times
+    SilKit_NanosecondsTime waitTimeMax; //!< Longest waiting time
+
+    SilKit_NanosecondsTime execTimeMedian; //!< Median of the execution times
+    SilKit_NanosecondsTime execTimeP90; //!< 90th percentile of the execution times
+    SilKit_NanosecondsTime execTimeP99; //!< 99th percentile of the execution times
+    SilKit_NanosecondsTime execTimeMax; //!< Longest execution time
+
+    size_t numBlockingParticipants; //!< Number of entries in blockingParticipants
+    //! Participants the recorded steps waited for, with the longest total waiting time first
+    const SilKit_Experimental_SimulationStepBlockingParticipant* blockingParticipants;
+} SilKit_Experimental_SimulationStepStatistics;
+
+/*! Callback type receiving the summary of the simulation steps.
+ * Cf., \ref SilKit_Experimental_Participant_GetSimulationStepStatistics
+ */
+typedef void (SilKitFPTR *SilKit_Experimental_SimulationStepStatisticsHandler_t)(
+    void* context, SilKit_Participant* participant, const SilKit_Experimental_SimulationStepStatistics* stepStatistics);
+
+/*! \brief Obtain the summary of the most recent simulation steps of a participant.
+ *
+ * The steps are recorded by the step profiler, which is enabled by TimeSynchronization/ProfiledSteps in the
+ * participant configuration. The handler is called once, before this function returns. The statistics, including the
+ * blocking participants, are only valid during the call of the handler.
+ *
+ * @warning This function is not part of the stable API and ABI of the SIL Kit. It may be removed at any time without
+ *          prior notice.
+ *
+ * @param participant The participant whose simulation steps are inspected.
+ * @param context The user context pointer made available to the handler.
+ * @param handler The handler to be called with the summary.
+ */
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_Experimental_Participant_GetSimulationStepStatistics(
+    SilKit_Participant* participant, void* context, SilKit_Experimental_SimulationStepStatisticsHandler_t handler);
+
+typedef SilKit_ReturnCode (SilKitFPTR *SilKit_Experimental_Participant_GetSimulationStepStatistics_t)(
+    SilKit_Participant* participant, void* context, SilKit_Experimental_SimulationStepStatisticsHandler_t handler);
+
 SILKIT_END_DECLS
 
 #pragma pack(pop)
@@ -25,6 +25,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "silkit/participant/IParticipant.hpp"
 #include "silkit/experimental/services/orchestration/ISystemController.hpp"
 
+#include "silkit/capi/Participant.h"
+
+#include "silkit/detail/impl/ThrowOnError.hpp"
 #include "silkit/detail/impl/participant/Participant.hpp"
 #include "silkit/detail/impl/experimental/services/orchestration/SystemController.hpp"
 
@@ -42,6 +45,132 @@ auto CreateSystemController(SilKit::IParticipant* cppIParticipant)
     return cppParticipant.ExperimentalCreateSystemController();
 }
 
+void BeginRegistrationBatch(SilKit::IParticipant* cppIParticipant)
+{
+    auto& cppParticipant = dynamic_cast<Impl::Participant&>(*cppIParticipant);
+
+    const auto returnCode = SilKit_Experimental_Participant_BeginRegistrationBatch(cppParticipant.Get());
+    Impl::ThrowOnError(returnCode);
+}
+
+void EndRegistrationBatch(SilKit::IParticipant* cppIParticipant)
+{
+    auto& cppParticipant = dynamic_cast<Impl::Participant&>(*cppIParticipant);
+
+    const auto returnCode = SilKit_Experimental_Participant_EndRegistrationBatch(cppParticipant.Get());
+    Impl::ThrowOnError(returnCode);
+}
+
+auto GetPeerStatistics(SilKit::IParticipant* cppIParticipant)
+    -> std::vector<SilKit::Experimental::Participant::PeerStatistics>
+{
+    auto& cppParticipant = dynamic_cast<Impl::Participant&>(*cppIParticipant);
+
+    std::vector<SilKit::Experimental::Participant::PeerStatistics> cppPeerStatistics;
+
+    const auto cPeerStatisticsHandler = [](void* context, SilKit_Participant* participant,
+                                           const SilKit_Experimental_PeerStatistics* cPeerStatistics) {
+        SILKIT_UNUSED_ARG(participant);
+
+        const auto peerStatisticsPtr =
+            static_cast<std::vector<SilKit::Experimental::Participant::PeerStatistics>*>(context);
+        peerStatisticsPtr->emplace_back();
+
+        auto& peerStatistics = peerStatisticsPtr->back();
+        peerStatistics.participantName = cPeerStatistics->participantName;
+        peerStatistics.sentMessages = cPeerStatistics->sentMessages;
+        peerStatistics.sentBytes = cPeerStatistics->sentBytes;
+        peerStatistics.receivedMessages = cPeerStatistics->receivedMessages;
+        peerStatistics.receivedBytes = cPeerStatistics->receivedBytes;
+        peerStatistics.sendQueueMessages = cPeerStatistics->sendQueueMessages;
+        peerStatistics.sendQueueBytes = cPeerStatistics->sendQueueBytes;
+        peerStatistics.peakSendQueueMessages = cPeerStatistics->peakSendQueueMessages;
+        peerStatistics.peakSendQueueBytes = cPeerStatistics->peakSendQueueBytes;
+        peerStatistics.sendBatches = cPeerStatistics->sendBatches;
+        peerStatistics.maxSendBatchMessages = cPeerStatistics->maxSendBatchMessages;
+        peerStatistics.maxSendBatchBytes = cPeerStatistics->maxSendBatchBytes;
+        peerStatistics.roundTripTime = std::chrono::nanoseconds{cPeerStatistics->roundTripTime};
+    };
+
+    const auto returnCode = SilKit_Experimental_Participant_GetPeerStatistics(cppParticipant.Get(), &cppPeerStatistics,
+                                                                              cPeerStatisticsHandler);
+    Impl::ThrowOnError(returnCode);
+
+    return cppPeerStatistics;
+}
+
+auto GetSimulationStepStatistics(SilKit::IParticipant* cppIParticipant)
+    -> SilKit::Experimental::Participant::SimulationStepStatistics
+{
+    auto& cppParticipant = dynamic_cast<Impl::Participant&>(*cppIParticipant);
+
+    SilKit::Experimental::Participant::SimulationStepStatistics cppStepStatistics;
+
+    const auto cStepStatisticsHandler = [](void* context, SilKit_Participant* participant,
+                                           const SilKit_Experimental_SimulationStepStatistics* cStepStatistics) {
+        SILKIT_UNUSED_ARG(participant);
+
+        auto& stepStatistics = *static_cast<SilKit::Experimental::Participant::SimulationStepStatistics*>(context);
+        stepStatistics.executedSteps = cStepStatistics->executedSteps;
+        stepStatistics.recordedSteps = cStepStatistics->recordedSteps;
+        stepStatistics.waitTimeMedian = std::chrono::nanoseconds{cStepStatistics->waitTimeMedian};
+        stepStatistics.waitTimeP90 = std::chrono::nanoseconds{cStepStatistics->waitTimeP90};
+        stepStatistics.waitTimeP99 = std::chrono::nanoseconds{cStepStatistics->waitTimeP99};
+        stepStatistics.waitTimeMax = std::chrono::nanoseconds{cStepStatistics->waitTimeMax};
+        stepStatistics.execTimeMedian = std::chrono::nanoseconds{cStepStatistics->execTimeMedian};
+        stepStatistics.execTimeP90 = std::chrono::nanoseconds{cStepStatistics->execTimeP90};
+        stepStatistics.execTimeP99 = std::chrono::nanoseconds{cStepStatistics->execTimeP99};
+        stepStatistics.execTimeMax = std::chrono::nanoseconds{cStepStatistics->execTimeMax};
+
+        for (size_t i = 0; i < cStepStatistics->numBlockingParticipants; ++i)
+        {
+            const auto& cBlockingParticipant = cStepStatistics->blockingParticipants[i];
+
+            SilKit::Experimental::Participant::SimulationStepBlockingParticipant blockingParticipant;
+            blockingParticipant.participantName = cBlockingParticipant.participantName;
+            blockingParticipant.blockedSteps = cBlockingParticipant.blockedSteps;
+            blockingParticipant.waitTime = std::chrono::nanoseconds{cBlockingParticipant.waitTime};
+            stepStatistics.blockingParticipants.push_back(std::move(blockingParticipant));
+        }
+    };
+
+    const auto returnCode = SilKit_Experimental_Participant_GetSimulationStepStatistics(
+        cppParticipant.Get(), &cppStepStatistics, cStepStatisticsHandler);
+    Impl::ThrowOnError(returnCode);
+
+    return cppStepStatistics;
+}
+
+RegistrationBatch::RegistrationBatch(SilKit::IParticipant* participant)
+{
+    BeginRegistrationBatch(participant);
+    _participant = participant;
+}
+
+RegistrationBatch::~RegistrationBatch()
+{
+    try
+    {
+        End();
+    }
+    catch (...)
+    {
+        // errors are only reported by an explicit call of End
+    }
+}
+
+void RegistrationBatch::End()
+{
+    if (_participant == nullptr)
+    {
+        return;
+    }
+
+    auto* participant = _participant;
+    _participant = nullptr;
+    EndRegistrationBatch(participant);
+}
+
 } // namespace Participant
 } // namespace Experimental
 DETAIL_SILKIT_DETAIL_VN_NAMESPACE_CLOSE
@@ -52,6 +181,11 @@ namespace SilKit {
 namespace Experimental {
 namespace Participant {
 using SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Participant::CreateSystemController;
+using SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Participant::BeginRegistrationBatch;
+using SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Participant::EndRegistrationBatch;
+using SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Participant::GetPeerStatistics;
+using SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Participant::GetSimulationStepStatistics;
+using SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Participant::RegistrationBatch;
 } // namespace Participant
 } // namespace Experimental
 } // namespace SilKit
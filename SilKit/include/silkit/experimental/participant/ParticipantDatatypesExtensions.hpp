@@ -0,0 +1,120 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace SilKit {
+namespace Experimental {
+namespace Participant {
+
+/*! \brief Transport statistics of the connection to another participant, or to the registry.
+*
+* The counters start with the connection. They are maintained for all connections, without synchronizing with the
+* I/O of the participant, and are therefore only approximately consistent with each other.
+*/
+struct PeerStatistics
+{
+    //! Name of the remote participant
+    std::string participantName;
+
+    //! Messages written into the connection
+    uint64_t sentMessages{0};
+    //! Bytes written into the connection, after the compression of messages
+    uint64_t sentBytes{0};
+    //! Messages read from the connection
+    uint64_t receivedMessages{0};
+    //! Bytes read from the connection, before the decompression of messages
+    uint64_t receivedBytes{0};
+
+    //! Messages currently waiting in the sending queue
+    uint64_t sendQueueMessages{0};
+    //! Bytes currently waiting in the sending queue
+    uint64_t sendQueueBytes{0};
+    //! Largest number of messages waiting in the sending queue so far
+    uint64_t peakSendQueueMessages{0};
+    //! Largest number of bytes waiting in the sending queue so far
+    uint64_t peakSendQueueBytes{0};
+
+    //! Writes into the connection, each of them coalesces one or more messages
+    uint64_t sendBatches{0};
+    //! Largest number of messages coalesced into a single write
+    uint64_t maxSendBatchMessages{0};
+    //! Largest number of bytes coalesced into a single write
+    uint64_t maxSendBatchBytes{0};
+
+    //! Round-trip time of TCP connections as estimated by the operating system, zero if there is no estimate
+    std::chrono::nanoseconds roundTripTime{0};
+};
+
+//! \brief Participant that prevented the time advance of the recorded simulation steps.
+struct SimulationStepBlockingParticipant
+{
+    //! Name of the other participant, or of the time coordinator
+    std::string participantName;
+    //! Number of steps which waited for this participant
+    uint64_t blockedSteps{0};
+    //! Waiting time of these steps, in total
+    std::chrono::nanoseconds waitTime{0};
+};
+
+/*! \brief Summary of the most recent simulation steps, as recorded by the step profiler.
+*
+* The step profiler is enabled by TimeSynchronization/ProfiledSteps in the participant configuration. The waiting time
+* of a step lasts from the end of the previous step until the simulation step handler is called, the execution time
+* until the handler returns.
+*/
+struct SimulationStepStatistics
+{
+    //! Simulation steps executed by the participant
+    uint64_t executedSteps{0};
+    //! Most recent simulation steps the summary is based on, at most TimeSynchronization/ProfiledSteps
+    uint64_t recordedSteps{0};
+
+    //! Median of the waiting times
+    std::chrono::nanoseconds waitTimeMedian{0};
+    //! 90th percentile of the waiting times
+    std::chrono::nanoseconds waitTimeP90{0};
+    //! 99th percentile of the waiting times
+    std::chrono::nanoseconds waitTimeP99{0};
+    //! Longest waiting time
+    std::chrono::nanoseconds waitTimeMax{0};
+
+    //! Median of the execution times
+    std::chrono::nanoseconds execTimeMedian{0};
+    //! 90th percentile of the execution times
+    std::chrono::nanoseconds execTimeP90{0};
+    //! 99th percentile of the execution times
+    std::chrono::nanoseconds execTimeP99{0};
+    //! Longest execution time
+    std::chrono::nanoseconds execTimeMax{0};
+
+    //! Participants the recorded steps waited for, with the longest total waiting time first
+    std::vector<SimulationStepBlockingParticipant> blockingParticipants;
+};
+
+} // namespace Participant
+} // namespace Experimental
+} // namespace SilKit
@@ -24,9 +24,12 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "silkit/SilKitMacros.hpp"
 #include "silkit/participant/IParticipant.hpp"
 #include "silkit/experimental/services/orchestration/ISystemController.hpp"
+#include "silkit/experimental/participant/ParticipantDatatypesExtensions.hpp"
 
 #include "silkit/detail/macros.hpp"
 
+#include <vector>
+
 
 namespace SilKit {
 DETAIL_SILKIT_DETAIL_VN_NAMESPACE_BEGIN
@@ -42,6 +45,73 @@ namespace Participant {
 DETAIL_SILKIT_CPP_API auto CreateSystemController(SilKit::IParticipant* participant)
     -> SilKit::Experimental::Services::Orchestration::ISystemController*;
 
+/*! \brief Start registering the controllers created at a given SIL Kit participant together.
+*
+* The subscriptions of all controllers created until the matching EndRegistrationBatch are announced to the other
+* participants together, instead of waiting for their acknowledgement after creating each controller. The controllers
+* must not be used before the batch has ended. Batches can be nested, only the outermost batch is effective.
+*
+* \param participant The participant instance at which the controllers are created
+*
+* \throw SilKit::SilKitError The participant is invalid.
+*/
+DETAIL_SILKIT_CPP_API void BeginRegistrationBatch(SilKit::IParticipant* participant);
+
+/*! \brief Finish registering the controllers created since BeginRegistrationBatch.
+*
+* Blocks until the subscriptions of all controllers created in the batch have been acknowledged by the other
+* participants.
+*
+* \param participant The participant instance at which the controllers are created
+*
+* \throw SilKit::SilKitError The participant is invalid, or no registration batch is active.
+*/
+DETAIL_SILKIT_CPP_API void EndRegistrationBatch(SilKit::IParticipant* participant);
+
+/*! \brief Return the transport statistics of all connections of a given SIL Kit participant.
+*
+* The statistics are maintained for every connection to another participant, and to the registry. Reading them does
+* not block the communication of the participant.
+*
+* \param participant The participant instance whose connections are inspected
+*
+* \throw SilKit::SilKitError The participant is invalid.
+*/
+DETAIL_SILKIT_CPP_API auto GetPeerStatistics(SilKit::IParticipant* participant)
+    -> std::vector<SilKit::Experimental::Participant::PeerStatistics>;
+
+/*! \brief Return the summary of the most recent simulation steps of a given SIL Kit participant.
+*
+* The steps are recorded by the step profiler, see TimeSynchronization/ProfiledSteps. If it is disabled, or the
+* participant does not synchronize its virtual time, the summary is empty.
+*
+* \param participant The participant instance whose simulation steps are inspected
+*
+* \throw SilKit::SilKitError The participant is invalid.
+*/
+DETAIL_SILKIT_CPP_API auto GetSimulationStepStatistics(SilKit::IParticipant* participant)
+    -> SilKit::Experimental::Participant::SimulationStepStatistics;
+
+/*! \brief Registers the controllers created during its lifetime together, see BeginRegistrationBatch.
+*
+* The batch ends when End is called, or when the object is destroyed. Errors are only reported by End.
+*/
+class RegistrationBatch
+{
+public:
+    inline explicit RegistrationBatch(SilKit::IParticipant* participant);
+    inline ~RegistrationBatch();
+
+    RegistrationBatch(const RegistrationBatch&) = delete;
+    RegistrationBatch& operator=(const RegistrationBatch&) = delete;
+
+    //! \brief Wait until the controllers created in the batch are registered, see EndRegistrationBatch.
+    inline void End();
+
+private:
+    SilKit::IParticipant* _participant{nullptr};
+};
+
 } // namespace Participant
 } // namespace Experimental
 DETAIL_SILKIT_DETAIL_VN_NAMESPACE_CLOSE
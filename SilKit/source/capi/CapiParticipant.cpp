@@ -22,6 +22,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "ParticipantConfiguration.hpp"
 #include "ParticipantConfigurationFromXImpl.hpp"
 #include "CreateParticipantImpl.hpp"
+#include "participant/ParticipantExtensionsImpl.hpp"
+#include "silkit/experimental/participant/ParticipantDatatypesExtensions.hpp"
 
 #include "silkit/capi/SilKit.h"
 #include "silkit/SilKit.hpp"
@@ -102,6 +104,105 @@ try
 CAPI_CATCH_EXCEPTIONS
 
 
+SilKit_ReturnCode SilKitCALL SilKit_Experimental_Participant_BeginRegistrationBatch(SilKit_Participant* participant)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(participant);
+
+    auto* cppParticipant = reinterpret_cast<SilKit::IParticipant*>(participant);
+    SilKit::Experimental::Participant::BeginRegistrationBatchImpl(cppParticipant);
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
+SilKit_ReturnCode SilKitCALL SilKit_Experimental_Participant_EndRegistrationBatch(SilKit_Participant* participant)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(participant);
+
+    auto* cppParticipant = reinterpret_cast<SilKit::IParticipant*>(participant);
+    SilKit::Experimental::Participant::EndRegistrationBatchImpl(cppParticipant);
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
+SilKit_ReturnCode SilKitCALL SilKit_Experimental_Participant_GetPeerStatistics(
+    SilKit_Participant* participant, void* context, SilKit_Experimental_PeerStatisticsHandler_t handler)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(participant);
+    ASSERT_VALID_HANDLER_PARAMETER(handler);
+
+    auto* cppParticipant = reinterpret_cast<SilKit::IParticipant*>(participant);
+    const auto cppPeerStatistics = SilKit::Experimental::Participant::GetPeerStatisticsImpl(cppParticipant);
+
+    for (const auto& cppStatistics : cppPeerStatistics)
+    {
+        SilKit_Experimental_PeerStatistics statistics;
+        SilKit_Struct_Init(SilKit_Experimental_PeerStatistics, statistics);
+        statistics.participantName = cppStatistics.participantName.c_str();
+        statistics.sentMessages = cppStatistics.sentMessages;
+        statistics.sentBytes = cppStatistics.sentBytes;
+        statistics.receivedMessages = cppStatistics.receivedMessages;
+        statistics.receivedBytes = cppStatistics.receivedBytes;
+        statistics.sendQueueMessages = cppStatistics.sendQueueMessages;
+        statistics.sendQueueBytes = cppStatistics.sendQueueBytes;
+        statistics.peakSendQueueMessages = cppStatistics.peakSendQueueMessages;
+        statistics.peakSendQueueBytes = cppStatistics.peakSendQueueBytes;
+        statistics.sendBatches = cppStatistics.sendBatches;
+        statistics.maxSendBatchMessages = cppStatistics.maxSendBatchMessages;
+        statistics.maxSendBatchBytes = cppStatistics.maxSendBatchBytes;
+        statistics.roundTripTime = static_cast<SilKit_NanosecondsTime>(cppStatistics.roundTripTime.count());
+
+        handler(context, participant, &statistics);
+    }
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+SilKit_ReturnCode SilKitCALL SilKit_Experimental_Participant_GetSimulationStepStatistics(
+    SilKit_Participant* participant, void* context, SilKit_Experimental_SimulationStepStatisticsHandler_t handler)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(participant);
+    ASSERT_VALID_HANDLER_PARAMETER(handler);
+
+    auto* cppParticipant = reinterpret_cast<SilKit::IParticipant*>(participant);
+    const auto cppStatistics = SilKit::Experimental::Participant::GetSimulationStepStatisticsImpl(cppParticipant);
+
+    std::vector<SilKit_Experimental_SimulationStepBlockingParticipant> blockingParticipants;
+    for (const auto& cppBlockingParticipant : cppStatistics.blockingParticipants)
+    {
+        SilKit_Experimental_SimulationStepBlockingParticipant blockingParticipant;
+        blockingParticipant.participantName = cppBlockingParticipant.participantName.c_str();
+        blockingParticipant.blockedSteps = cppBlockingParticipant.blockedSteps;
+        blockingParticipant.waitTime = static_cast<SilKit_NanosecondsTime>(cppBlockingParticipant.waitTime.count());
+        blockingParticipants.push_back(blockingParticipant);
+    }
+
+    SilKit_Experimental_SimulationStepStatistics statistics;
+    SilKit_Struct_Init(SilKit_Experimental_SimulationStepStatistics, statistics);
+    statistics.executedSteps = cppStatistics.executedSteps;
+    statistics.recordedSteps = cppStatistics.recordedSteps;
+    statistics.waitTimeMedian = static_cast<SilKit_NanosecondsTime>(cppStatistics.waitTimeMedian.count());
+    statistics.waitTimeP90 = static_cast<SilKit_NanosecondsTime>(cppStatistics.waitTimeP90.count());
+    statistics.waitTimeP99 = static_cast<SilKit_NanosecondsTime>(cppStatistics.waitTimeP99.count());
+    statistics.waitTimeMax = static_cast<SilKit_NanosecondsTime>(cppStatistics.waitTimeMax.count());
+    statistics.execTimeMedian = static_cast<SilKit_NanosecondsTime>(cppStatistics.execTimeMedian.count());
+    statistics.execTimeP90 = static_cast<SilKit_NanosecondsTime>(cppStatistics.execTimeP90.count());
+    statistics.execTimeP99 = static_cast<SilKit_NanosecondsTime>(cppStatistics.execTimeP99.count());
+    statistics.execTimeMax = static_cast<SilKit_NanosecondsTime>(cppStatistics.execTimeMax.count());
+    statistics.numBlockingParticipants = blockingParticipants.size();
+    statistics.blockingParticipants = blockingParticipants.data();
+
+    handler(context, participant, &statistics);
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
 SilKit_ReturnCode SilKitCALL SilKit_ParticipantConfiguration_FromString(
     SilKit_ParticipantConfiguration** outParticipantConfiguration,
     const char* participantConfigurationString)
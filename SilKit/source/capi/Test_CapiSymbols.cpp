@@ -140,6 +140,10 @@ SilKit_HandlerId id;
 (void) SilKit_RpcClient_SetCallResultHandler(nullptr, nullptr, nullptr);
 (void) SilKit_ReturnCodeToString(nullptr, SilKit_ReturnCode_BADPARAMETER);
 (void) SilKit_Participant_GetLogger(nullptr, nullptr);
+(void) SilKit_Experimental_Participant_BeginRegistrationBatch(nullptr);
+(void) SilKit_Experimental_Participant_EndRegistrationBatch(nullptr);
+(void) SilKit_Experimental_Participant_GetPeerStatistics(nullptr, nullptr, nullptr);
+(void) SilKit_Experimental_Participant_GetSimulationStepStatistics(nullptr, nullptr, nullptr);
 (void)SilKit_GetLastErrorString();
 }
 
@@ -32,6 +32,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "silkit/services/logging/LoggingDatatypes.hpp"
 
 #include "Optional.hpp"
+#include "SetThreadScheduling.hpp"
 
 namespace SilKit {
 namespace Config {
@@ -81,6 +82,26 @@ struct Logging
     std::vector<Sink> sinks;
 };
 
+// ================================================================================
+//  Threads
+// ================================================================================
+
+//! \brief CPU placement and scheduling of a thread spawned by SIL Kit
+struct ThreadSettings
+{
+    std::vector<int> cpuAffinity; //!< CPUs the thread may run on, the inherited affinity is kept if empty
+    Util::ThreadSchedulingPolicy schedulingPolicy{ Util::ThreadSchedulingPolicy::Default };
+    int schedulingPriority{ 0 }; //!< Priority of the Fifo scheduling policy
+};
+
+//! \brief Settings of the threads spawned by SIL Kit, by the role of the thread
+struct Threads
+{
+    ThreadSettings io; //!< Threads running the I/O of the connections
+    ThreadSettings watchdog; //!< Thread supervising the duration of the simulation steps (HealthCheck)
+    ThreadSettings dashboard; //!< Threads forwarding the simulation state to the dashboard (registry only)
+};
+
 // ================================================================================
 //  Tracing service
 // ================================================================================
@@ -157,6 +178,8 @@ struct SimulatedNetwork
 
 inline bool operator==(const Sink& lhs, const Sink& rhs);
 inline bool operator==(const Logging& lhs, const Logging& rhs);
+inline bool operator==(const ThreadSettings& lhs, const ThreadSettings& rhs);
+inline bool operator==(const Threads& lhs, const Threads& rhs);
 inline bool operator==(const TraceSink& lhs, const TraceSink& rhs);
 inline bool operator==(const TraceSource& lhs, const TraceSource& rhs);
 inline bool operator==(const Replay& lhs, const Replay& rhs);
@@ -215,6 +238,20 @@ bool operator==(const Logging& lhs, const Logging& rhs)
         && lhs.sinks == rhs.sinks;
 }
 
+bool operator==(const ThreadSettings& lhs, const ThreadSettings& rhs)
+{
+    return lhs.cpuAffinity == rhs.cpuAffinity
+        && lhs.schedulingPolicy == rhs.schedulingPolicy
+        && lhs.schedulingPriority == rhs.schedulingPriority;
+}
+
+bool operator==(const Threads& lhs, const Threads& rhs)
+{
+    return lhs.io == rhs.io
+        && lhs.watchdog == rhs.watchdog
+        && lhs.dashboard == rhs.dashboard;
+}
+
 bool operator==(const TraceSink& lhs, const TraceSink& rhs)
 {
     return lhs.name == rhs.name
@@ -191,6 +191,28 @@ struct HealthCheck
     SilKit::Util::Optional<std::chrono::milliseconds> hardResponseTimeout;
 };
 
+// ================================================================================
+//  Time synchronization
+// ================================================================================
+
+//! \brief Structure that contains the settings of the virtual time synchronization
+struct TimeSynchronization
+{
+    //! Minimum latency before messages sent by this participant can affect other participants. The other
+    //! participants may run ahead of this participant by up to this duration. Zero keeps the lockstep.
+    std::chrono::nanoseconds lookahead{0};
+    //! Messages sent by other participants wake this participant up before its next scheduled simulation step.
+    //! The other participants do not wait for the simulation steps in between.
+    bool eventDriven{false};
+    //! Name of the participant that coordinates the time synchronization. The participants send their next time
+    //! point only to the coordinator, which grants the time advances to all of them. Empty for the full mesh.
+    std::string coordinator;
+    //! Number of the most recent simulation steps recorded by the step profiler. Zero disables the profiler.
+    int profiledSteps{0};
+    //! File the recorded simulation steps are written to on shutdown, as a Chrome trace / Perfetto timeline.
+    std::string stepTimelineOutputPath;
+};
+
 // ================================================================================
 //  Tracing service
 // ================================================================================
@@ -219,6 +241,28 @@ struct Extensions
 
 struct Middleware
 {
+    //! Behavior if the sending queue of a connection exceeds one of its limits.
+    enum class SendQueueOverflowPolicy : uint8_t
+    {
+        //! Sending blocks until the queue is within its limits again. Sending from the I/O thread never blocks.
+        //! Senders only start to block once a queue exceeds its limits, messages already handed to the I/O thread
+        //! are queued in any case.
+        Block,
+        //! The oldest queued messages are discarded.
+        DropOldest,
+        //! New messages are discarded and an error is logged.
+        Error
+    };
+
+    //! Implementation of the I/O of the connections to other participants.
+    enum class IoBackend : uint8_t
+    {
+        //! Portable implementation based on asio.
+        Asio,
+        //! The connections are driven by io_uring (Linux only). Falls back to Asio, if io_uring is not available.
+        IoUring
+    };
+
     std::string registryUri{}; //!< Registry URI to connect to (configuration has priority)
     int connectAttempts{ 1 }; //!<  Number of connection attempts to the registry a participant should perform.
     int tcpReceiveBufferSize{ -1 };
@@ -231,6 +275,35 @@ struct Middleware
     bool registryAsFallbackProxy{ true };
     //! By default, requesting connection of other participants, and honoring these requests by other participants is enabled.
     bool experimentalRemoteParticipantConnection{ true };
+    //! Maximum number of bytes coalesced into a single vectored socket write. Zero disables coalescing.
+    int sendBatchMaxBytes{ 64 * 1024 };
+    //! Maximum number of buffers (i.e., iovec entries) coalesced into a single vectored socket write.
+    int sendBatchMaxBuffers{ 64 };
+    //! Move the traffic of local-domain socket connections between participants on the same host into shared memory.
+    bool enableSharedMemory{ false };
+    //! Number of threads running the I/O of the participant. Each connection is processed on its own strand.
+    int ioWorkerThreads{ 1 };
+    //! Buffer the messages sent during a simulation step and write them when the step handler returns.
+    bool enableSendBuffering{ false };
+    //! Messages larger than this number of bytes are compressed, if the receiving participant supports it. Zero
+    //! disables compression.
+    int compressionThreshold{ 0 };
+    //! Upper bound for the number of bytes queued for sending to a single participant. Zero disables the limit.
+    int sendQueueMaxBytes{ 0 };
+    //! Upper bound for the number of messages queued for sending to a single participant. Zero disables the limit.
+    int sendQueueMaxMessages{ 0 };
+    //! Behavior if the sending queue of a connection exceeds SendQueueMaxBytes or SendQueueMaxMessages.
+    SendQueueOverflowPolicy sendQueueOverflowPolicy{ SendQueueOverflowPolicy::Block };
+    //! Implementation of the I/O of the connections to other participants.
+    IoBackend ioBackend{ IoBackend::Asio };
+    //! Run the I/O event loop as a polling loop, instead of blocking until the next event arrives.
+    bool ioBusyPoll{ false };
+    //! Duration without any events, after which the polling I/O event loop blocks until the next event arrives.
+    int ioBusyPollSpinMicroseconds{ 200 };
+    //! Busy-poll duration of the TCP sockets in microseconds (Linux SO_BUSY_POLL). Zero keeps the system default.
+    int tcpBusyPollMicroseconds{ 0 };
+    //! CPU placement and scheduling of the threads spawned by the participant.
+    Threads threads;
 };
 
 // ================================================================================
@@ -269,6 +342,7 @@ struct ParticipantConfiguration
 
     Logging logging;
     HealthCheck healthCheck;
+    TimeSynchronization timeSynchronization;
     Tracing tracing;
     Extensions extensions;
     Middleware middleware;
@@ -283,6 +357,7 @@ bool operator==(const DataSubscriber& lhs, const DataSubscriber& rhs);
 bool operator==(const RpcServer& lhs, const RpcServer& rhs);
 bool operator==(const RpcClient& lhs, const RpcClient& rhs);
 bool operator==(const HealthCheck& lhs, const HealthCheck& rhs);
+bool operator==(const TimeSynchronization& lhs, const TimeSynchronization& rhs);
 bool operator==(const Tracing& lhs, const Tracing& rhs);
 bool operator==(const Extensions& lhs, const Extensions& rhs);
 bool operator==(const Middleware& lhs, const Middleware& rhs);
@@ -126,6 +126,12 @@ bool operator==(const HealthCheck& lhs, const HealthCheck& rhs)
     return lhs.softResponseTimeout == rhs.softResponseTimeout && lhs.hardResponseTimeout == rhs.hardResponseTimeout;
 }
 
+bool operator==(const TimeSynchronization& lhs, const TimeSynchronization& rhs)
+{
+    return lhs.lookahead == rhs.lookahead && lhs.eventDriven == rhs.eventDriven && lhs.coordinator == rhs.coordinator
+           && lhs.profiledSteps == rhs.profiledSteps && lhs.stepTimelineOutputPath == rhs.stepTimelineOutputPath;
+}
+
 bool operator==(const Tracing& lhs, const Tracing& rhs)
 {
     return lhs.traceSinks == rhs.traceSinks && lhs.traceSources == rhs.traceSources;
@@ -142,7 +148,19 @@ bool operator==(const Middleware& lhs, const Middleware& rhs)
     return lhs.registryUri == rhs.registryUri && lhs.connectAttempts == rhs.connectAttempts
            && lhs.enableDomainSockets == rhs.enableDomainSockets && lhs.tcpNoDelay == rhs.tcpNoDelay
            && lhs.tcpQuickAck == rhs.tcpQuickAck && lhs.tcpReceiveBufferSize == rhs.tcpReceiveBufferSize
-           && lhs.tcpSendBufferSize == rhs.tcpSendBufferSize && lhs.acceptorUris == rhs.acceptorUris;
+           && lhs.tcpSendBufferSize == rhs.tcpSendBufferSize && lhs.acceptorUris == rhs.acceptorUris
+           && lhs.sendBatchMaxBytes == rhs.sendBatchMaxBytes && lhs.sendBatchMaxBuffers == rhs.sendBatchMaxBuffers
+           && lhs.enableSharedMemory == rhs.enableSharedMemory && lhs.ioWorkerThreads == rhs.ioWorkerThreads
+           && lhs.enableSendBuffering == rhs.enableSendBuffering
+           && lhs.compressionThreshold == rhs.compressionThreshold
+           && lhs.sendQueueMaxBytes == rhs.sendQueueMaxBytes
+           && lhs.sendQueueMaxMessages == rhs.sendQueueMaxMessages
+           && lhs.sendQueueOverflowPolicy == rhs.sendQueueOverflowPolicy
+           && lhs.ioBackend == rhs.ioBackend
+           && lhs.ioBusyPoll == rhs.ioBusyPoll
+           && lhs.ioBusyPollSpinMicroseconds == rhs.ioBusyPollSpinMicroseconds
+           && lhs.tcpBusyPollMicroseconds == rhs.tcpBusyPollMicroseconds
+           && lhs.threads == rhs.threads;
 }
 
 bool operator==(const ParticipantConfiguration& lhs, const ParticipantConfiguration& rhs)
@@ -152,7 +170,8 @@ bool operator==(const ParticipantConfiguration& lhs, const ParticipantConfigurat
            && lhs.flexrayControllers == rhs.flexrayControllers && lhs.dataPublishers == rhs.dataPublishers
            && lhs.dataSubscribers == rhs.dataSubscribers && lhs.rpcClients == rhs.rpcClients
            && lhs.rpcServers == rhs.rpcServers && lhs.logging == rhs.logging && lhs.healthCheck == rhs.healthCheck
-           && lhs.tracing == rhs.tracing && lhs.extensions == rhs.extensions;
+           && lhs.timeSynchronization == rhs.timeSynchronization && lhs.tracing == rhs.tracing
+           && lhs.extensions == rhs.extensions;
 }
 
 } // inline namespace v1
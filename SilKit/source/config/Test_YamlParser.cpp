@@ -185,6 +185,12 @@ Logging:
 HealthCheck:
   SoftResponseTimeout: 500
   HardResponseTimeout: 5000
+TimeSynchronization:
+  Lookahead: 10000000
+  EventDriven: true
+  Coordinator: Node0
+  ProfiledSteps: 1000
+  StepTimelineOutputPath: Node0_steps.json
 Tracing:
   TraceSinks:
   - Name: Sink1
@@ -207,6 +213,27 @@ Middleware:
   TcpSendBufferSize: 3456
   TcpReceiveBufferSize: 3456
   RegistryAsFallbackProxy: false
+  SendBatchMaxBytes: 4096
+  SendBatchMaxBuffers: 16
+  EnableSharedMemory: true
+  IoWorkerThreads: 4
+  EnableSendBuffering: true
+  CompressionThreshold: 1024
+  SendQueueMaxBytes: 1048576
+  SendQueueMaxMessages: 10000
+  SendQueueOverflowPolicy: DropOldest
+  IoBackend: IoUring
+  IoBusyPoll: true
+  IoBusyPollSpinMicroseconds: 1000
+  TcpBusyPollMicroseconds: 50
+  Threads:
+    Io:
+      CpuAffinity: [2, 3]
+      SchedulingPolicy: Fifo
+      SchedulingPriority: 50
+    Watchdog:
+      CpuAffinity: [0]
+      SchedulingPolicy: Other
 
 )raw";
 
@@ -246,6 +273,12 @@ TEST_F(Test_YamlParser, yaml_complete_configuration)
     EXPECT_TRUE(config.healthCheck.softResponseTimeout.value() == 500ms);
     EXPECT_TRUE(config.healthCheck.hardResponseTimeout.value() == 5000ms);
 
+    EXPECT_TRUE(config.timeSynchronization.lookahead == 10ms);
+    EXPECT_TRUE(config.timeSynchronization.eventDriven);
+    EXPECT_TRUE(config.timeSynchronization.coordinator == "Node0");
+    EXPECT_TRUE(config.timeSynchronization.profiledSteps == 1000);
+    EXPECT_TRUE(config.timeSynchronization.stepTimelineOutputPath == "Node0_steps.json");
+
     EXPECT_TRUE(config.tracing.traceSinks.size() == 1);
     EXPECT_TRUE(config.tracing.traceSinks.at(0).name == "Sink1");
     EXPECT_TRUE(config.tracing.traceSinks.at(0).outputPath == "FlexrayDemo_node0.mf4");
@@ -267,6 +300,25 @@ TEST_F(Test_YamlParser, yaml_complete_configuration)
     EXPECT_TRUE(config.middleware.tcpReceiveBufferSize == 3456);
     EXPECT_TRUE(config.middleware.tcpSendBufferSize == 3456);
     EXPECT_FALSE(config.middleware.registryAsFallbackProxy);
+    EXPECT_TRUE(config.middleware.sendBatchMaxBytes == 4096);
+    EXPECT_TRUE(config.middleware.sendBatchMaxBuffers == 16);
+    EXPECT_TRUE(config.middleware.enableSharedMemory);
+    EXPECT_TRUE(config.middleware.ioWorkerThreads == 4);
+    EXPECT_TRUE(config.middleware.enableSendBuffering);
+    EXPECT_TRUE(config.middleware.compressionThreshold == 1024);
+    EXPECT_TRUE(config.middleware.sendQueueMaxBytes == 1048576);
+    EXPECT_TRUE(config.middleware.sendQueueMaxMessages == 10000);
+    EXPECT_TRUE(config.middleware.sendQueueOverflowPolicy == Middleware::SendQueueOverflowPolicy::DropOldest);
+    EXPECT_TRUE(config.middleware.ioBackend == Middleware::IoBackend::IoUring);
+    EXPECT_TRUE(config.middleware.ioBusyPoll);
+    EXPECT_TRUE(config.middleware.ioBusyPollSpinMicroseconds == 1000);
+    EXPECT_TRUE(config.middleware.tcpBusyPollMicroseconds == 50);
+    EXPECT_TRUE(config.middleware.threads.io.cpuAffinity == (std::vector<int>{2, 3}));
+    EXPECT_TRUE(config.middleware.threads.io.schedulingPolicy == SilKit::Util::ThreadSchedulingPolicy::Fifo);
+    EXPECT_TRUE(config.middleware.threads.io.schedulingPriority == 50);
+    EXPECT_TRUE(config.middleware.threads.watchdog.cpuAffinity == (std::vector<int>{0}));
+    EXPECT_TRUE(config.middleware.threads.watchdog.schedulingPolicy == SilKit::Util::ThreadSchedulingPolicy::Other);
+    EXPECT_TRUE(config.middleware.threads.dashboard == ThreadSettings{});
 }
 
 const auto emptyConfiguration = R"raw(
@@ -362,7 +414,27 @@ TEST_F(Test_YamlParser, middleware_convert)
             "TcpSendBufferSize": 3456,
             "TcpReceiveBufferSize": 3456,
             "EnableDomainSockets": false,
-            "RegistryAsFallbackProxy": false
+            "RegistryAsFallbackProxy": false,
+            "SendBatchMaxBytes": 4096,
+            "SendBatchMaxBuffers": 16,
+            "EnableSharedMemory": true,
+            "IoWorkerThreads": 4,
+            "EnableSendBuffering": true,
+            "CompressionThreshold": 1024,
+            "SendQueueMaxBytes": 1048576,
+            "SendQueueMaxMessages": 10000,
+            "SendQueueOverflowPolicy": "DropOldest",
+            "IoBackend": "IoUring",
+            "IoBusyPoll": true,
+            "IoBusyPollSpinMicroseconds": 1000,
+            "TcpBusyPollMicroseconds": 50,
+            "Threads": {
+                "Io": {
+                    "CpuAffinity": [1],
+                    "SchedulingPolicy": "Fifo",
+                    "SchedulingPriority": 10
+                }
+            }
         }
     )");
     auto config = node.as<Middleware>();
@@ -375,6 +447,22 @@ TEST_F(Test_YamlParser, middleware_convert)
     EXPECT_EQ(config.tcpSendBufferSize, 3456);
     EXPECT_EQ(config.tcpReceiveBufferSize, 3456);
     EXPECT_EQ(config.registryAsFallbackProxy, false);
+    EXPECT_EQ(config.sendBatchMaxBytes, 4096);
+    EXPECT_EQ(config.sendBatchMaxBuffers, 16);
+    EXPECT_EQ(config.enableSharedMemory, true);
+    EXPECT_EQ(config.ioWorkerThreads, 4);
+    EXPECT_EQ(config.enableSendBuffering, true);
+    EXPECT_EQ(config.compressionThreshold, 1024);
+    EXPECT_EQ(config.sendQueueMaxBytes, 1048576);
+    EXPECT_EQ(config.sendQueueMaxMessages, 10000);
+    EXPECT_EQ(config.sendQueueOverflowPolicy, Middleware::SendQueueOverflowPolicy::DropOldest);
+    EXPECT_EQ(config.ioBackend, Middleware::IoBackend::IoUring);
+    EXPECT_EQ(config.ioBusyPoll, true);
+    EXPECT_EQ(config.ioBusyPollSpinMicroseconds, 1000);
+    EXPECT_EQ(config.tcpBusyPollMicroseconds, 50);
+    EXPECT_EQ(config.threads.io.cpuAffinity, std::vector<int>{1});
+    EXPECT_EQ(config.threads.io.schedulingPolicy, SilKit::Util::ThreadSchedulingPolicy::Fifo);
+    EXPECT_EQ(config.threads.io.schedulingPriority, 10);
 }
 
 TEST_F(Test_YamlParser, map_serdes)
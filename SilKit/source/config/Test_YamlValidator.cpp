@@ -48,6 +48,7 @@ TEST_F(Test_YamlValidator, yaml_doc_relations)
     EXPECT_TRUE(v.IsRootElement("/FlexrayControllers"));
     EXPECT_TRUE(v.IsRootElement("/Logging"));
     EXPECT_TRUE(v.IsRootElement("/HealthCheck"));
+    EXPECT_TRUE(v.IsRootElement("/TimeSynchronization"));
     EXPECT_TRUE(v.IsRootElement("/Tracing"));
     EXPECT_TRUE(v.IsRootElement("/Extensions"));
     EXPECT_TRUE(v.IsRootElement("/Middleware"));
@@ -67,6 +68,22 @@ TEST_F(Test_YamlValidator, validate_without_warnings)
     cfg.middleware.tcpQuickAck = true;
     cfg.middleware.tcpReceiveBufferSize = 1234;
     cfg.middleware.tcpSendBufferSize = 1234;
+    cfg.middleware.sendBatchMaxBytes = 1234;
+    cfg.middleware.sendBatchMaxBuffers = 12;
+    cfg.middleware.enableSharedMemory = true;
+    cfg.middleware.ioWorkerThreads = 4;
+    cfg.middleware.enableSendBuffering = true;
+    cfg.middleware.compressionThreshold = 1024;
+    cfg.middleware.sendQueueMaxBytes = 1048576;
+    cfg.middleware.sendQueueMaxMessages = 10000;
+    cfg.middleware.sendQueueOverflowPolicy = Middleware::SendQueueOverflowPolicy::DropOldest;
+    cfg.middleware.ioBackend = Middleware::IoBackend::IoUring;
+    cfg.middleware.ioBusyPoll = true;
+    cfg.middleware.ioBusyPollSpinMicroseconds = 1000;
+    cfg.middleware.tcpBusyPollMicroseconds = 50;
+    cfg.middleware.threads.io.cpuAffinity = {2, 3};
+    cfg.middleware.threads.io.schedulingPolicy = SilKit::Util::ThreadSchedulingPolicy::Fifo;
+    cfg.middleware.threads.io.schedulingPriority = 50;
 
     std::stringstream stream;
     auto jsonString = yaml_to_json(to_yaml(cfg));
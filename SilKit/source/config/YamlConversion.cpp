@@ -776,6 +776,29 @@ bool Converter::decode(const Node& node, HealthCheck& obj)
     return true;
 }
 
+template <>
+Node Converter::encode(const TimeSynchronization& obj)
+{
+    static const TimeSynchronization defaultObj{};
+    Node node;
+    non_default_encode(obj.lookahead, node, "Lookahead", defaultObj.lookahead);
+    non_default_encode(obj.eventDriven, node, "EventDriven", defaultObj.eventDriven);
+    non_default_encode(obj.coordinator, node, "Coordinator", defaultObj.coordinator);
+    non_default_encode(obj.profiledSteps, node, "ProfiledSteps", defaultObj.profiledSteps);
+    non_default_encode(obj.stepTimelineOutputPath, node, "StepTimelineOutputPath", defaultObj.stepTimelineOutputPath);
+    return node;
+}
+template <>
+bool Converter::decode(const Node& node, TimeSynchronization& obj)
+{
+    optional_decode(obj.lookahead, node, "Lookahead");
+    optional_decode(obj.eventDriven, node, "EventDriven");
+    optional_decode(obj.coordinator, node, "Coordinator");
+    optional_decode(obj.profiledSteps, node, "ProfiledSteps");
+    optional_decode(obj.stepTimelineOutputPath, node, "StepTimelineOutputPath");
+    return true;
+}
+
 template<>
 Node Converter::encode(const Tracing& obj)
 {
@@ -943,6 +966,178 @@ bool Converter::decode(const Node& node, Extensions& obj)
 }
 
 
+template<>
+Node Converter::encode(const Middleware::SendQueueOverflowPolicy& obj)
+{
+    Node node;
+    switch (obj)
+    {
+    case Middleware::SendQueueOverflowPolicy::Block:
+        node = "Block";
+        break;
+    case Middleware::SendQueueOverflowPolicy::DropOldest:
+        node = "DropOldest";
+        break;
+    case Middleware::SendQueueOverflowPolicy::Error:
+        node = "Error";
+        break;
+    default:
+        break;
+    }
+    return node;
+}
+template<>
+bool Converter::decode(const Node& node, Middleware::SendQueueOverflowPolicy& obj)
+{
+    if (!node.IsScalar())
+    {
+        throw ConversionError(node, "Middleware::SendQueueOverflowPolicy should be a string of Block|DropOldest|Error.");
+    }
+    auto&& str = parse_as<std::string>(node);
+    if (str == "Block")
+    {
+        obj = Middleware::SendQueueOverflowPolicy::Block;
+    }
+    else if (str == "DropOldest")
+    {
+        obj = Middleware::SendQueueOverflowPolicy::DropOldest;
+    }
+    else if (str == "Error")
+    {
+        obj = Middleware::SendQueueOverflowPolicy::Error;
+    }
+    else
+    {
+        throw ConversionError(node, "Unknown Middleware::SendQueueOverflowPolicy: " + str + ".");
+    }
+    return true;
+}
+
+template<>
+Node Converter::encode(const Middleware::IoBackend& obj)
+{
+    Node node;
+    switch (obj)
+    {
+    case Middleware::IoBackend::Asio:
+        node = "Asio";
+        break;
+    case Middleware::IoBackend::IoUring:
+        node = "IoUring";
+        break;
+    default:
+        break;
+    }
+    return node;
+}
+template<>
+bool Converter::decode(const Node& node, Middleware::IoBackend& obj)
+{
+    if (!node.IsScalar())
+    {
+        throw ConversionError(node, "Middleware::IoBackend should be a string of Asio|IoUring.");
+    }
+    auto&& str = parse_as<std::string>(node);
+    if (str == "Asio")
+    {
+        obj = Middleware::IoBackend::Asio;
+    }
+    else if (str == "IoUring")
+    {
+        obj = Middleware::IoBackend::IoUring;
+    }
+    else
+    {
+        throw ConversionError(node, "Unknown Middleware::IoBackend: " + str + ".");
+    }
+    return true;
+}
+
+template<>
+Node Converter::encode(const SilKit::Util::ThreadSchedulingPolicy& obj)
+{
+    Node node;
+    switch (obj)
+    {
+    case SilKit::Util::ThreadSchedulingPolicy::Default:
+        node = "Default";
+        break;
+    case SilKit::Util::ThreadSchedulingPolicy::Other:
+        node = "Other";
+        break;
+    case SilKit::Util::ThreadSchedulingPolicy::Fifo:
+        node = "Fifo";
+        break;
+    default:
+        break;
+    }
+    return node;
+}
+template<>
+bool Converter::decode(const Node& node, SilKit::Util::ThreadSchedulingPolicy& obj)
+{
+    if (!node.IsScalar())
+    {
+        throw ConversionError(node, "ThreadSchedulingPolicy should be a string of Default|Other|Fifo.");
+    }
+    auto&& str = parse_as<std::string>(node);
+    if (str == "Default")
+    {
+        obj = SilKit::Util::ThreadSchedulingPolicy::Default;
+    }
+    else if (str == "Other")
+    {
+        obj = SilKit::Util::ThreadSchedulingPolicy::Other;
+    }
+    else if (str == "Fifo")
+    {
+        obj = SilKit::Util::ThreadSchedulingPolicy::Fifo;
+    }
+    else
+    {
+        throw ConversionError(node, "Unknown ThreadSchedulingPolicy: " + str + ".");
+    }
+    return true;
+}
+
+template<>
+Node Converter::encode(const ThreadSettings& obj)
+{
+    static const ThreadSettings defaultObj{};
+    Node node;
+    optional_encode(obj.cpuAffinity, node, "CpuAffinity");
+    non_default_encode(obj.schedulingPolicy, node, "SchedulingPolicy", defaultObj.schedulingPolicy);
+    non_default_encode(obj.schedulingPriority, node, "SchedulingPriority", defaultObj.schedulingPriority);
+    return node;
+}
+template<>
+bool Converter::decode(const Node& node, ThreadSettings& obj)
+{
+    optional_decode(obj.cpuAffinity, node, "CpuAffinity");
+    optional_decode(obj.schedulingPolicy, node, "SchedulingPolicy");
+    optional_decode(obj.schedulingPriority, node, "SchedulingPriority");
+    return true;
+}
+
+template<>
+Node Converter::encode(const Threads& obj)
+{
+    static const Threads defaultObj{};
+    Node node;
+    non_default_encode(obj.io, node, "Io", defaultObj.io);
+    non_default_encode(obj.watchdog, node, "Watchdog", defaultObj.watchdog);
+    non_default_encode(obj.dashboard, node, "Dashboard", defaultObj.dashboard);
+    return node;
+}
+template<>
+bool Converter::decode(const Node& node, Threads& obj)
+{
+    optional_decode(obj.io, node, "Io");
+    optional_decode(obj.watchdog, node, "Watchdog");
+    optional_decode(obj.dashboard, node, "Dashboard");
+    return true;
+}
+
 template<>
 Node Converter::encode(const Middleware& obj)
 {
@@ -958,6 +1153,20 @@ Node Converter::encode(const Middleware& obj)
     non_default_encode(obj.acceptorUris, node, "acceptorUris", defaultObj.acceptorUris);
     non_default_encode(obj.registryAsFallbackProxy, node, "RegistryAsFallbackProxy", defaultObj.registryAsFallbackProxy);
     non_default_encode(obj.experimentalRemoteParticipantConnection, node, "ExperimentalRemoteParticipantConnection", defaultObj.experimentalRemoteParticipantConnection);
+    non_default_encode(obj.sendBatchMaxBytes, node, "SendBatchMaxBytes", defaultObj.sendBatchMaxBytes);
+    non_default_encode(obj.sendBatchMaxBuffers, node, "SendBatchMaxBuffers", defaultObj.sendBatchMaxBuffers);
+    non_default_encode(obj.enableSharedMemory, node, "EnableSharedMemory", defaultObj.enableSharedMemory);
+    non_default_encode(obj.ioWorkerThreads, node, "IoWorkerThreads", defaultObj.ioWorkerThreads);
+    non_default_encode(obj.enableSendBuffering, node, "EnableSendBuffering", defaultObj.enableSendBuffering);
+    non_default_encode(obj.compressionThreshold, node, "CompressionThreshold", defaultObj.compressionThreshold);
+    non_default_encode(obj.sendQueueMaxBytes, node, "SendQueueMaxBytes", defaultObj.sendQueueMaxBytes);
+    non_default_encode(obj.sendQueueMaxMessages, node, "SendQueueMaxMessages", defaultObj.sendQueueMaxMessages);
+    non_default_encode(obj.sendQueueOverflowPolicy, node, "SendQueueOverflowPolicy", defaultObj.sendQueueOverflowPolicy);
+    non_default_encode(obj.ioBackend, node, "IoBackend", defaultObj.ioBackend);
+    non_default_encode(obj.ioBusyPoll, node, "IoBusyPoll", defaultObj.ioBusyPoll);
+    non_default_encode(obj.ioBusyPollSpinMicroseconds, node, "IoBusyPollSpinMicroseconds", defaultObj.ioBusyPollSpinMicroseconds);
+    non_default_encode(obj.tcpBusyPollMicroseconds, node, "TcpBusyPollMicroseconds", defaultObj.tcpBusyPollMicroseconds);
+    non_default_encode(obj.threads, node, "Threads", defaultObj.threads);
     return node;
 }
 template<>
@@ -973,6 +1182,20 @@ bool Converter::decode(const Node& node, Middleware& obj)
     optional_decode(obj.acceptorUris, node, "AcceptorUris");
     optional_decode(obj.registryAsFallbackProxy, node, "RegistryAsFallbackProxy");
     optional_decode(obj.experimentalRemoteParticipantConnection, node, "ExperimentalRemoteParticipantConnection");
+    optional_decode(obj.sendBatchMaxBytes, node, "SendBatchMaxBytes");
+    optional_decode(obj.sendBatchMaxBuffers, node, "SendBatchMaxBuffers");
+    optional_decode(obj.enableSharedMemory, node, "EnableSharedMemory");
+    optional_decode(obj.ioWorkerThreads, node, "IoWorkerThreads");
+    optional_decode(obj.enableSendBuffering, node, "EnableSendBuffering");
+    optional_decode(obj.compressionThreshold, node, "CompressionThreshold");
+    optional_decode(obj.sendQueueMaxBytes, node, "SendQueueMaxBytes");
+    optional_decode(obj.sendQueueMaxMessages, node, "SendQueueMaxMessages");
+    optional_decode(obj.sendQueueOverflowPolicy, node, "SendQueueOverflowPolicy");
+    optional_decode(obj.ioBackend, node, "IoBackend");
+    optional_decode(obj.ioBusyPoll, node, "IoBusyPoll");
+    optional_decode(obj.ioBusyPollSpinMicroseconds, node, "IoBusyPollSpinMicroseconds");
+    optional_decode(obj.tcpBusyPollMicroseconds, node, "TcpBusyPollMicroseconds");
+    optional_decode(obj.threads, node, "Threads");
     return true;
 }
 
@@ -1002,6 +1225,7 @@ Node Converter::encode(const ParticipantConfiguration& obj)
 
     non_default_encode(obj.logging, node, "Logging", defaultObj.logging);
     non_default_encode(obj.healthCheck, node, "Extensions", defaultObj.healthCheck);
+    non_default_encode(obj.timeSynchronization, node, "TimeSynchronization", defaultObj.timeSynchronization);
     non_default_encode(obj.tracing, node, "Extensions", defaultObj.tracing);
     non_default_encode(obj.extensions, node, "Extensions", defaultObj.extensions);
     non_default_encode(obj.middleware, node, "Middleware", defaultObj.middleware);
@@ -1025,6 +1249,7 @@ bool Converter::decode(const Node& node, ParticipantConfiguration& obj)
 
     optional_decode(obj.logging, node, "Logging");
     optional_decode(obj.healthCheck, node, "HealthCheck");
+    optional_decode(obj.timeSynchronization, node, "TimeSynchronization");
     optional_decode(obj.tracing, node, "Tracing");
     optional_decode(obj.extensions, node, "Extensions");
     optional_decode(obj.middleware, node, "Middleware");
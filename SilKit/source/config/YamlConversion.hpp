@@ -70,12 +70,19 @@ DEFINE_SILKIT_CONVERT(RpcClient);
 
 DEFINE_SILKIT_CONVERT(HealthCheck);
 
+DEFINE_SILKIT_CONVERT(TimeSynchronization);
+
 DEFINE_SILKIT_CONVERT(Tracing);
 DEFINE_SILKIT_CONVERT(TraceSink);
 DEFINE_SILKIT_CONVERT(TraceSink::Type);
 DEFINE_SILKIT_CONVERT(TraceSource);
 DEFINE_SILKIT_CONVERT(TraceSource::Type);
 
+DEFINE_SILKIT_CONVERT(Middleware::SendQueueOverflowPolicy);
+DEFINE_SILKIT_CONVERT(Middleware::IoBackend);
+DEFINE_SILKIT_CONVERT(SilKit::Util::ThreadSchedulingPolicy);
+DEFINE_SILKIT_CONVERT(ThreadSettings);
+DEFINE_SILKIT_CONVERT(Threads);
 DEFINE_SILKIT_CONVERT(Middleware);
 
 DEFINE_SILKIT_CONVERT(Extensions);
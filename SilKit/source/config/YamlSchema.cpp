@@ -68,6 +68,18 @@ auto MakeYamlSchema() -> YamlSchemaElem
 
         }
     );
+    std::initializer_list<YamlSchemaElem> threadSettingsElements = {
+        {"CpuAffinity"},
+        {"SchedulingPolicy"},
+        {"SchedulingPriority"},
+    };
+    YamlSchemaElem threads("Threads",
+        {
+            {"Io", threadSettingsElements},
+            {"Watchdog", threadSettingsElements},
+            {"Dashboard", threadSettingsElements},
+        }
+    );
     YamlSchemaElem clusterParameters("ClusterParameters",
         {
             {"gColdstartAttempts"}, 
@@ -207,6 +219,14 @@ auto MakeYamlSchema() -> YamlSchemaElem
                 {"HardResponseTimeout"},
             }
         },
+        {"TimeSynchronization", {
+                {"Lookahead"},
+                {"EventDriven"},
+                {"Coordinator"},
+                {"ProfiledSteps"},
+                {"StepTimelineOutputPath"},
+            }
+        },
         {"Tracing", {
                 traceSinks,
                 traceSources
@@ -227,6 +247,20 @@ auto MakeYamlSchema() -> YamlSchemaElem
                 {"AcceptorUris"},
                 {"RegistryAsFallbackProxy"},
                 {"ExperimentalRemoteParticipantConnection"},
+                {"SendBatchMaxBytes"},
+                {"SendBatchMaxBuffers"},
+                {"EnableSharedMemory"},
+                {"IoWorkerThreads"},
+                {"EnableSendBuffering"},
+                {"CompressionThreshold"},
+                {"SendQueueMaxBytes"},
+                {"SendQueueMaxMessages"},
+                {"SendQueueOverflowPolicy"},
+                {"IoBackend"},
+                {"IoBusyPoll"},
+                {"IoBusyPollSpinMicroseconds"},
+                {"TcpBusyPollMicroseconds"},
+                threads,
             }
         }
     };
@@ -25,6 +25,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "silkit/participant/IParticipant.hpp"
 #include "silkit/experimental/services/orchestration/ISystemController.hpp"
+#include "silkit/experimental/participant/ParticipantDatatypesExtensions.hpp"
 
 #include "internal_fwd.hpp"
 #include "IServiceEndpoint.hpp"
@@ -185,6 +186,7 @@ public:
 
     // For Connection/middleware support:
     virtual void OnAllMessagesDelivered(std::function<void()> callback) = 0;
+    virtual void StartSendBuffering() = 0;
     virtual void FlushSendBuffers() = 0;
     virtual void ExecuteDeferred(std::function<void()> callback) = 0;
 
@@ -227,6 +229,21 @@ public:
 
     // Register handlers for completion of async service creation
     virtual void SetAsyncSubscriptionsCompletionHandler(std::function<void()> handler) = 0;
+
+    //! \brief Register the services created until EndRegistrationBatch together, see
+    //! SilKit::Experimental::Participant::BeginRegistrationBatch.
+    virtual void BeginRegistrationBatch() = 0;
+    //! \brief Wait until the subscriptions of the services created since BeginRegistrationBatch are acknowledged.
+    virtual void EndRegistrationBatch() = 0;
+
+    //! \brief Transport statistics of the connections to the other participants and to the registry.
+    virtual auto GetPeerStatistics() -> std::vector<Experimental::Participant::PeerStatistics> = 0;
+
+    //! \brief Summary of the simulation steps recorded by the step profiler of the time synchronization.
+    virtual auto GetSimulationStepStatistics() -> Experimental::Participant::SimulationStepStatistics = 0;
+
+    //! \brief Number of messages sent by the services of this participant, except for the internal ones.
+    virtual auto GetNumberOfSentMessages() const -> uint64_t = 0;
     
     virtual bool GetIsSystemControllerCreated() = 0;
     virtual void SetIsSystemControllerCreated(bool isCreated) = 0;
@@ -0,0 +1,83 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace SilKit {
+namespace Core {
+
+//! Wall-clock duration and number of messages received by the participant during one phase of joining the simulation.
+struct JoinPhaseStatistics
+{
+    std::chrono::nanoseconds duration{0};
+    uint64_t receivedMessages{0};
+};
+
+//! The phases of joining the simulation, in the order in which the participant passes them.
+struct JoinSimulationStatistics
+{
+    //! Connecting to the registry until the registry replied to the participant announcement.
+    JoinPhaseStatistics registryHandshake;
+    //! Connecting to all known participants until all of them replied to the participant announcement.
+    JoinPhaseStatistics connectKnownParticipants;
+    //! Creating the internal services, which waits for the subscription acknowledges of all known participants.
+    JoinPhaseStatistics subscriptionAcknowledge;
+    //! Afterwards, until every known participant has announced its services to this participant.
+    JoinPhaseStatistics serviceDiscovery;
+
+    //! The participants this participant is connected to after the handshakes are complete.
+    std::vector<std::string> knownParticipantNames;
+    //! True, once every known participant has announced its services.
+    bool isServiceDiscoveryComplete{false};
+};
+
+//! Accounts consecutive phases of joining the simulation, each phase starts when the previous one finished.
+class JoinPhaseClock
+{
+public:
+    JoinPhaseClock() = default;
+    JoinPhaseClock(std::chrono::steady_clock::time_point start, uint64_t receivedMessages)
+        : _phaseStart{start}
+        , _phaseStartReceivedMessages{receivedMessages}
+    {
+    }
+
+    //! Completes the phase at the given time and total number of received messages, and starts the next one.
+    void FinishPhase(JoinPhaseStatistics& phase, std::chrono::steady_clock::time_point now, uint64_t receivedMessages)
+    {
+        phase.duration = now - _phaseStart;
+        phase.receivedMessages = receivedMessages - _phaseStartReceivedMessages;
+        _phaseStart = now;
+        _phaseStartReceivedMessages = receivedMessages;
+    }
+
+private:
+    std::chrono::steady_clock::time_point _phaseStart{};
+    uint64_t _phaseStartReceivedMessages{0};
+};
+
+} // namespace Core
+} // namespace SilKit
@@ -23,6 +23,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include <chrono>
 #include <string>
+#include <vector>
 
 #include "silkit/services/orchestration/OrchestrationDatatypes.hpp"
 
@@ -32,10 +33,31 @@ namespace SilKit {
 namespace Services {
 namespace Orchestration {
 
+//! Time coordinator: A time grant may only be used after the NextSimTask with the timePoint (or a later one) of the
+//! participant was received, since the NextSimTask follows the messages sent by the participant.
+struct TimeGrantDependency
+{
+    std::string participantName;
+    std::chrono::nanoseconds timePoint{0};
+};
+
 struct NextSimTask
 {
     std::chrono::nanoseconds timePoint{0};
     std::chrono::nanoseconds duration{0};
+    //! Messages sent in this step affect other participants no earlier than timePoint + lookahead.
+    std::chrono::nanoseconds lookahead{0};
+    //! Event-driven participants: timePoint is preponed by messages of other participants.
+    bool eventDriven{false};
+    //! Time point of the last simulation step of the participant.
+    std::chrono::nanoseconds currentTimePoint{-1};
+    //! The participant may have sent messages since its previous NextSimTask.
+    bool sentMessages{true};
+    //! Time coordinator: The participants may advance to timePoint, which is the lowest time point at which any
+    //! participant can affect the others.
+    bool timeGrant{false};
+    //! Time grant: NextSimTasks that were sent to all participants since the previous time grant.
+    std::vector<TimeGrantDependency> timeGrantDependencies{};
 };
 
 //! System-wide command for the simulation flow.
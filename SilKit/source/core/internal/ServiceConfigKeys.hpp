@@ -86,6 +86,7 @@ const std::string controllerTypeOther = "Other";
 // Lifecycle & TimeSync
 const std::string lifecycleIsCoordinated = "LifecycleIsCoordinated";
 const std::string timeSyncActive = "TimeSyncActive";
+const std::string timeSyncCoordinator = "TimeSyncCoordinator";
 
 } // namespace Discovery
 } // namespace Core
@@ -42,6 +42,7 @@ DefineSilKitMsgTrait_TypeName(SilKit::Core::Tests, TestFrameEvent)
 //The renamed TestMessage must have the same SerdesName as the previous struct
 DefineSilKitMsgTrait_SerdesName(SilKit::Core::Tests::TestFrameEvent, "TESTMESSAGE");
 DefineSilKitMsgTrait_Version(SilKit::Core::Tests::TestFrameEvent, 3);
+DefineSilKitMsgTrait_UserData(SilKit::Core::Tests, TestFrameEvent)
 
 } // namespace Core
 } // namespace SilKit
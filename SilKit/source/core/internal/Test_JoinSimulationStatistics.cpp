@@ -0,0 +1,66 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "gtest/gtest.h"
+
+#include "JoinSimulationStatistics.hpp"
+
+namespace {
+
+using namespace std::chrono_literals;
+using SilKit::Core::JoinPhaseClock;
+using SilKit::Core::JoinSimulationStatistics;
+
+TEST(Test_JoinSimulationStatistics, consecutive_phases_start_where_the_previous_one_finished)
+{
+    const auto start = std::chrono::steady_clock::time_point{} + 1s;
+    JoinPhaseClock phaseClock{start, 10};
+
+    JoinSimulationStatistics statistics;
+    phaseClock.FinishPhase(statistics.registryHandshake, start + 5ms, 12);
+    phaseClock.FinishPhase(statistics.connectKnownParticipants, start + 20ms, 30);
+    phaseClock.FinishPhase(statistics.subscriptionAcknowledge, start + 21ms, 45);
+
+    EXPECT_EQ(statistics.registryHandshake.duration, 5ms);
+    EXPECT_EQ(statistics.registryHandshake.receivedMessages, 2u);
+    EXPECT_EQ(statistics.connectKnownParticipants.duration, 15ms);
+    EXPECT_EQ(statistics.connectKnownParticipants.receivedMessages, 18u);
+    EXPECT_EQ(statistics.subscriptionAcknowledge.duration, 1ms);
+    EXPECT_EQ(statistics.subscriptionAcknowledge.receivedMessages, 15u);
+}
+
+TEST(Test_JoinSimulationStatistics, copied_clock_continues_with_the_next_phase)
+{
+    const auto start = std::chrono::steady_clock::time_point{} + 1s;
+    JoinPhaseClock phaseClock{start, 0};
+
+    JoinSimulationStatistics statistics;
+    phaseClock.FinishPhase(statistics.subscriptionAcknowledge, start + 3ms, 4);
+
+    // the service discovery is completed later, by another thread
+    auto serviceDiscoveryClock = phaseClock;
+    serviceDiscoveryClock.FinishPhase(statistics.serviceDiscovery, start + 10ms, 4);
+
+    EXPECT_EQ(statistics.serviceDiscovery.duration, 7ms);
+    EXPECT_EQ(statistics.serviceDiscovery.receivedMessages, 0u);
+}
+
+} // namespace
@@ -52,9 +52,22 @@ std::ostream& operator<<(std::ostream& out, const NextSimTask& nextTask)
 {
     auto tp = std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(nextTask.timePoint);
     auto duration = std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(nextTask.duration);
+    auto lookahead = std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(nextTask.lookahead);
     out << "Orchestration::NextSimTask{tp=" << tp.count()
         << "ms, duration=" << duration.count()
-        << "ms}";
+        << "ms, lookahead=" << lookahead.count()
+        << "ms";
+    if (nextTask.eventDriven)
+    {
+        auto currentTp = std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(nextTask.currentTimePoint);
+        out << ", eventDriven, currentTp=" << currentTp.count() << "ms";
+    }
+    out << ", sentMessages=" << nextTask.sentMessages;
+    if (nextTask.timeGrant)
+    {
+        out << ", timeGrant, dependencies=" << nextTask.timeGrantDependencies.size();
+    }
+    out << "}";
     return out;
 }
 
@@ -50,6 +50,7 @@ template <class MsgT> struct SilKitMsgTraitTypeName { static constexpr const cha
 template <class MsgT> struct SilKitMsgTraitHistSize { static constexpr std::size_t HistSize() { return 0; } };
 template <class MsgT> struct SilKitMsgTraitEnforceSelfDelivery { static constexpr bool IsSelfDeliveryEnforced() { return false; } };
 template <class MsgT> struct SilKitMsgTraitForbidSelfDelivery { static constexpr bool IsSelfDeliveryForbidden() { return false; } };
+template <class MsgT> struct SilKitMsgTraitUserData { static constexpr bool IsUserData() { return false; } };
 
 // The final message traits
 template <class MsgT> struct SilKitMsgTraits
@@ -59,6 +60,7 @@ template <class MsgT> struct SilKitMsgTraits
     , SilKitMsgTraitVersion<MsgT>
     , SilKitMsgTraitSerdesName<MsgT>
     , SilKitMsgTraitForbidSelfDelivery<MsgT>
+    , SilKitMsgTraitUserData<MsgT>
 {
 };
 
@@ -74,6 +76,9 @@ template <class MsgT> struct SilKitMsgTraits
 #define DefineSilKitMsgTrait_ForbidSelfDelivery(Namespace, MsgName) template<> struct SilKitMsgTraitForbidSelfDelivery<Namespace::MsgName>{\
     static constexpr bool IsSelfDeliveryForbidden() { return true; }\
     };
+#define DefineSilKitMsgTrait_UserData(Namespace, MsgName) template<> struct SilKitMsgTraitUserData<Namespace::MsgName>{\
+    static constexpr bool IsUserData() { return true; }\
+    };
 
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Logging, LogMsg)
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Orchestration, SystemCommand)
@@ -128,5 +133,17 @@ DefineSilKitMsgTrait_EnforceSelfDelivery(SilKit::Services::Lin, LinSendFrameHead
 // Messages with forbidden self delivery
 DefineSilKitMsgTrait_ForbidSelfDelivery(SilKit::Services::Orchestration, SystemCommand)
 
+// Messages carrying user data, the only ones discarded by the overflow policies of the sending queues
+DefineSilKitMsgTrait_UserData(SilKit::Services::PubSub, WireDataMessageEvent)
+DefineSilKitMsgTrait_UserData(SilKit::Services::Rpc, FunctionCall)
+DefineSilKitMsgTrait_UserData(SilKit::Services::Rpc, FunctionCallResponse)
+DefineSilKitMsgTrait_UserData(SilKit::Services::Can, WireCanFrameEvent)
+DefineSilKitMsgTrait_UserData(SilKit::Services::Can, CanFrameTransmitEvent)
+DefineSilKitMsgTrait_UserData(SilKit::Services::Ethernet, WireEthernetFrameEvent)
+DefineSilKitMsgTrait_UserData(SilKit::Services::Ethernet, EthernetFrameTransmitEvent)
+DefineSilKitMsgTrait_UserData(SilKit::Services::Lin, LinTransmission)
+DefineSilKitMsgTrait_UserData(SilKit::Services::Flexray, WireFlexrayFrameEvent)
+DefineSilKitMsgTrait_UserData(SilKit::Services::Flexray, WireFlexrayFrameTransmitEvent)
+
 } // namespace Core
 } // namespace SilKit
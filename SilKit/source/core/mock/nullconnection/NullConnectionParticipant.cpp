@@ -57,7 +57,9 @@ struct NullConnection
     void SendMsg(const Core::IServiceEndpoint* /*from*/, const std::string& /*target*/, SilKitMessageT&& /*msg*/) {}
 
     void OnAllMessagesDelivered(std::function<void()> /*callback*/) {}
+    void StartSendBuffering() {}
     void FlushSendBuffers() {}
+    void RemoveRemoteServiceEndpoint(const SilKit::Core::ServiceDescriptor& /*serviceDescriptor*/) {}
     void ExecuteDeferred(std::function<void()> /*callback*/) {}
     void NotifyShutdown() {}
 
@@ -66,6 +68,13 @@ struct NullConnection
 
     void SetAsyncSubscriptionsCompletionHandler(std::function<void()> /*completionHandler*/) {}
 
+    void BeginRegistrationBatch() {}
+    void EndRegistrationBatch() {}
+
+    auto GetJoinSimulationStatistics() const -> SilKit::Core::JoinSimulationStatistics { return {}; }
+    auto GetNumberOfReceivedMessages() const -> uint64_t { return 0; }
+    auto GetPeerStatistics() -> std::vector<SilKit::Experimental::Participant::PeerStatistics> { return {}; }
+
     size_t GetNumberOfConnectedParticipants() { return 0; }
 
     size_t GetNumberOfRemoteReceivers(const IServiceEndpoint* /*service*/, const std::string& /*msgTypeName*/)
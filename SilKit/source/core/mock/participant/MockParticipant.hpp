@@ -363,6 +363,7 @@ public:
 
 
     void OnAllMessagesDelivered(std::function<void()> /*callback*/) override {}
+    void StartSendBuffering() override {}
     void FlushSendBuffers() override {}
     void ExecuteDeferred(std::function<void()> callback) override
     {
@@ -380,6 +381,12 @@ public:
     auto GetParticipantRepliesProcedure() -> RequestReply::IParticipantReplies* override { return &mockParticipantReplies; }
 
     void SetAsyncSubscriptionsCompletionHandler(std::function<void()> handler) override { handler(); };
+
+    void BeginRegistrationBatch() override {}
+    void EndRegistrationBatch() override {}
+    auto GetPeerStatistics() -> std::vector<Experimental::Participant::PeerStatistics> override { return {}; }
+    auto GetSimulationStepStatistics() -> Experimental::Participant::SimulationStepStatistics override { return {}; }
+    auto GetNumberOfSentMessages() const -> uint64_t override { return 0; }
     
     void SetIsSystemControllerCreated(bool /*isCreated*/) override{};
     bool GetIsSystemControllerCreated() override { return false; };
@@ -23,9 +23,13 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "IParticipantInternal.hpp"
 
+#include <atomic>
 #include <memory>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
+#include <mutex>
+#include <chrono>
 #include <map>
 #include <tuple>
 
@@ -75,6 +79,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "procs/ParticipantReplies.hpp"
 
 #include "ProtocolVersion.hpp"
+#include "JoinSimulationStatistics.hpp"
 #include "TimeProvider.hpp"
 
 // Add connection types here and make sure they are instantiated in Participant.cpp
@@ -268,11 +273,18 @@ public:
     void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName, const RequestReply::RequestReplyCallReturn& msg) override;
 
     void OnAllMessagesDelivered(std::function<void()> callback) override;
+    void StartSendBuffering() override;
     void FlushSendBuffers() override;
     void ExecuteDeferred(std::function<void()> callback) override;
 
     void SetAsyncSubscriptionsCompletionHandler(std::function<void()> handler) override;
 
+    void BeginRegistrationBatch() override;
+    void EndRegistrationBatch() override;
+    auto GetPeerStatistics() -> std::vector<Experimental::Participant::PeerStatistics> override;
+    auto GetSimulationStepStatistics() -> Experimental::Participant::SimulationStepStatistics override;
+    auto GetNumberOfSentMessages() const -> uint64_t override;
+
     void SetIsSystemControllerCreated(bool isCreated) override;
     bool GetIsSystemControllerCreated() override;
 
@@ -299,6 +311,9 @@ public:
     */
     void JoinSilKitSimulation() override;
 
+    //! Durations of the phases of JoinSilKitSimulation. The service discovery phase might still be in progress.
+    auto GetJoinSimulationStatistics() const -> JoinSimulationStatistics;
+
     // For Testing Purposes:
     inline auto GetSilKitConnection() -> SilKitConnectionT& { return _connection; }
 
@@ -330,6 +345,11 @@ private:
 
     void SetupRemoteLogging();
 
+    //!< Completes the statistics once all known participants have announced their services, and logs them.
+    void TrackServiceDiscoveryOfKnownParticipants();
+
+    void LogJoinSimulationStatistics(const JoinSimulationStatistics& statistics);
+
     void SetTimeProvider(Services::Orchestration::ITimeProvider*);
 
     template<class SilKitMessageT>
@@ -371,6 +391,13 @@ private:
     std::unique_ptr<Tracing::ReplayScheduler> _replayScheduler;
     std::unique_ptr<RequestReply::ParticipantReplies> _participantReplies;
 
+    mutable std::mutex _joinSimulationStatisticsMutex;
+    JoinSimulationStatistics _joinSimulationStatistics;
+    std::unordered_set<std::string> _participantsWithoutServiceDiscovery;
+    JoinPhaseClock _serviceDiscoveryClock;
+    // Set while the service discovery of the known participants is tracked, checked before taking the mutex
+    std::atomic<bool> _isTrackingServiceDiscovery{false};
+
     std::tuple<
         ControllerMap<Services::Can::IMsgForCanController>,
         ControllerMap<Services::Ethernet::IMsgForEthController>,
@@ -403,6 +430,9 @@ private:
 
     SilKitConnectionT _connection;
 
+    // messages sent by the services, except for the internal ones (see GetNumberOfSentMessages)
+    std::atomic<uint64_t> _numberOfSentMessages{0};
+
     // control variables to prevent multiple create accesses by public API 
     std::atomic<bool> _isSystemMonitorCreated{false};
     std::atomic<bool> _isSystemControllerCreated{false};
@@ -101,7 +101,117 @@ template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::JoinSilKitSimulation()
 {
     _connection.JoinSimulation(GetRegistryUri());
+
+    JoinPhaseClock phaseClock{std::chrono::steady_clock::now(), _connection.GetNumberOfReceivedMessages()};
+
     OnSilKitSimulationJoined();
+
+    auto statistics = _connection.GetJoinSimulationStatistics();
+    phaseClock.FinishPhase(statistics.subscriptionAcknowledge, std::chrono::steady_clock::now(),
+                           _connection.GetNumberOfReceivedMessages());
+
+    {
+        std::lock_guard<decltype(_joinSimulationStatisticsMutex)> lock{_joinSimulationStatisticsMutex};
+        _joinSimulationStatistics = statistics;
+        _participantsWithoutServiceDiscovery = {statistics.knownParticipantNames.begin(),
+                                                statistics.knownParticipantNames.end()};
+        _serviceDiscoveryClock = phaseClock;
+    }
+
+    LogJoinSimulationStatistics(statistics);
+
+    TrackServiceDiscoveryOfKnownParticipants();
+}
+
+template <class SilKitConnectionT>
+auto Participant<SilKitConnectionT>::GetJoinSimulationStatistics() const -> JoinSimulationStatistics
+{
+    std::lock_guard<decltype(_joinSimulationStatisticsMutex)> lock{_joinSimulationStatisticsMutex};
+    return _joinSimulationStatistics;
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::TrackServiceDiscoveryOfKnownParticipants()
+{
+    // Every participant announces all of its services, including its service discovery, as soon as it learns about
+    // the service discovery of this participant. The handler is called for the already known services first.
+    const auto handler = [this](Discovery::ServiceDiscoveryEvent::Type eventType,
+                                const ServiceDescriptor& serviceDescriptor) {
+        // The handler cannot be removed, it only returns once the service discovery is complete
+        if (!_isTrackingServiceDiscovery || eventType != Discovery::ServiceDiscoveryEvent::Type::ServiceCreated)
+        {
+            return;
+        }
+
+        std::string controllerType;
+        serviceDescriptor.GetSupplementalDataItem(Discovery::controllerType, controllerType);
+        if (controllerType != Discovery::controllerTypeServiceDiscovery)
+        {
+            return;
+        }
+
+        JoinSimulationStatistics statistics;
+        {
+            std::lock_guard<decltype(_joinSimulationStatisticsMutex)> lock{_joinSimulationStatisticsMutex};
+            if (_joinSimulationStatistics.isServiceDiscoveryComplete
+                || _participantsWithoutServiceDiscovery.erase(serviceDescriptor.GetParticipantName()) == 0
+                || !_participantsWithoutServiceDiscovery.empty())
+            {
+                return;
+            }
+
+            _serviceDiscoveryClock.FinishPhase(_joinSimulationStatistics.serviceDiscovery,
+                                               std::chrono::steady_clock::now(),
+                                               _connection.GetNumberOfReceivedMessages());
+            _joinSimulationStatistics.isServiceDiscoveryComplete = true;
+            _isTrackingServiceDiscovery = false;
+            statistics = _joinSimulationStatistics;
+        }
+
+        LogJoinSimulationStatistics(statistics);
+    };
+
+    {
+        std::lock_guard<decltype(_joinSimulationStatisticsMutex)> lock{_joinSimulationStatisticsMutex};
+        if (_participantsWithoutServiceDiscovery.empty())
+        {
+            _joinSimulationStatistics.isServiceDiscoveryComplete = true;
+            return;
+        }
+        _isTrackingServiceDiscovery = true;
+    }
+
+    GetServiceDiscovery()->RegisterServiceDiscoveryHandler(handler);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::LogJoinSimulationStatistics(const JoinSimulationStatistics& statistics)
+{
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+
+    const auto& registry = statistics.registryHandshake;
+    const auto& connect = statistics.connectKnownParticipants;
+    const auto& subscriptions = statistics.subscriptionAcknowledge;
+    const auto& discovery = statistics.serviceDiscovery;
+
+    if (!statistics.isServiceDiscoveryComplete)
+    {
+        Logging::Debug(GetLogger(),
+                       "Joined the simulation with {} known participants: registry handshake {:.3f}ms ({} messages), "
+                       "connect known participants {:.3f}ms ({} messages), subscription acknowledge {:.3f}ms ({} "
+                       "messages)",
+                       statistics.knownParticipantNames.size(), Milliseconds{registry.duration}.count(),
+                       registry.receivedMessages, Milliseconds{connect.duration}.count(), connect.receivedMessages,
+                       Milliseconds{subscriptions.duration}.count(), subscriptions.receivedMessages);
+        return;
+    }
+
+    const auto total = registry.duration + connect.duration + subscriptions.duration + discovery.duration;
+    Logging::Debug(GetLogger(),
+                   "Service discovery of {} known participants complete after {:.3f}ms ({} messages), joining took "
+                   "{:.3f}ms in total",
+                   statistics.knownParticipantNames.size(), Milliseconds{discovery.duration}.count(),
+                   discovery.receivedMessages, Milliseconds{total}.count());
 }
 
 template <class SilKitConnectionT>
@@ -713,7 +823,8 @@ auto Participant<SilKitConnectionT>::CreateTimeSyncService(Orchestration::Lifecy
     config.name = Discovery::controllerTypeTimeSyncService;
     config.network = "default";
     timeSyncService = CreateController<Orchestration::TimeSyncService>(
-        config, std::move(timeSyncSupplementalData), false, &_timeProvider, _participantConfig.healthCheck, lifecycleService);
+        config, std::move(timeSyncSupplementalData), false, &_timeProvider, _participantConfig.healthCheck, lifecycleService,
+        _participantConfig.middleware.threads.watchdog, _participantConfig.timeSynchronization);
 
     return timeSyncService;
 }
@@ -844,6 +955,14 @@ auto Participant<SilKitConnectionT>::GetServiceDiscovery() -> Discovery::IServic
         _connection.RegisterPeerShutdownCallback([controller](IVAsioPeer* peer) {
             controller->OnParticpantRemoval(peer->GetInfo().participantName);
         });
+
+        controller->RegisterServiceDiscoveryHandler(
+            [this](Discovery::ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& serviceDescriptor) {
+                if (discoveryType == Discovery::ServiceDiscoveryEvent::Type::ServiceRemoved)
+                {
+                    _connection.RemoveRemoteServiceEndpoint(serviceDescriptor);
+                }
+            });
     }
     return controller;
 }
@@ -1172,6 +1291,10 @@ template <typename SilKitMessageT>
 void Participant<SilKitConnectionT>::SendMsgImpl(const IServiceEndpoint* from, SilKitMessageT&& msg)
 {
     TraceTx(GetLogger(), from, msg);
+    if (from->GetServiceDescriptor().GetServiceType() != ServiceType::InternalController)
+    {
+        ++_numberOfSentMessages;
+    }
     _connection.SendMsg(from, std::forward<SilKitMessageT>(msg));
 }
 
@@ -1433,6 +1556,10 @@ template <typename SilKitMessageT>
 void Participant<SilKitConnectionT>::SendMsgImpl(const IServiceEndpoint* from, const std::string& targetParticipantName, SilKitMessageT&& msg)
 {
     TraceTx(GetLogger(), from, msg);
+    if (from->GetServiceDescriptor().GetServiceType() != ServiceType::InternalController)
+    {
+        ++_numberOfSentMessages;
+    }
     _connection.SendMsg(from, targetParticipantName, std::forward<SilKitMessageT>(msg));
 }
 
@@ -1592,6 +1719,12 @@ void Participant<SilKitConnectionT>::OnAllMessagesDelivered(std::function<void()
     _connection.OnAllMessagesDelivered(std::move(callback));
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::StartSendBuffering()
+{
+    _connection.StartSendBuffering();
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::FlushSendBuffers()
 {
@@ -1610,6 +1743,43 @@ void Participant<SilKitConnectionT>::SetAsyncSubscriptionsCompletionHandler(std:
     _connection.SetAsyncSubscriptionsCompletionHandler(std::move(handler));
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::BeginRegistrationBatch()
+{
+    _connection.BeginRegistrationBatch();
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::EndRegistrationBatch()
+{
+    _connection.EndRegistrationBatch();
+}
+
+template <class SilKitConnectionT>
+auto Participant<SilKitConnectionT>::GetPeerStatistics() -> std::vector<Experimental::Participant::PeerStatistics>
+{
+    return _connection.GetPeerStatistics();
+}
+
+template <class SilKitConnectionT>
+auto Participant<SilKitConnectionT>::GetSimulationStepStatistics()
+    -> Experimental::Participant::SimulationStepStatistics
+{
+    auto* timeSyncService =
+        GetController<Orchestration::TimeSyncService>(SilKit::Core::Discovery::controllerTypeTimeSyncService);
+    if (timeSyncService == nullptr)
+    {
+        return {};
+    }
+    return timeSyncService->GetStepProfiler().GetStatistics();
+}
+
+template <class SilKitConnectionT>
+auto Participant<SilKitConnectionT>::GetNumberOfSentMessages() const -> uint64_t
+{
+    return _numberOfSentMessages;
+}
+
 template <class SilKitConnectionT>
 template <typename ValueT>
 void Participant<SilKitConnectionT>::LogMismatchBetweenConfigAndPassedValue(const std::string& canonicalName,
@@ -0,0 +1,168 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+// Benchmark of joining the simulation: N participants join concurrently on one host and the time until every one of
+// them has discovered the services of all participants it knew when joining is measured. The phases of the join are
+// reported separately (see JoinSimulationStatistics), with the maximum and mean duration over all participants, and
+// the total number of messages they received in that phase.
+//
+// Usage: SilKitBenchJoinSimulation [maxNumberOfParticipants] [minNumberOfParticipants]
+//
+// The number of participants starts at the minimum and is doubled until the maximum is reached.
+
+#include "VAsioConnection.hpp"
+#include "VAsioRegistry.hpp"
+#include "Participant.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace {
+
+using namespace SilKit::Core;
+
+using Milliseconds = std::chrono::duration<double, std::milli>;
+
+const auto serviceDiscoveryTimeout = std::chrono::seconds{60};
+
+struct PhaseSummary
+{
+    Milliseconds maxDuration{0};
+    Milliseconds meanDuration{0};
+    uint64_t receivedMessages{0};
+};
+
+auto Summarize(const std::vector<JoinSimulationStatistics>& statistics,
+               JoinPhaseStatistics JoinSimulationStatistics::*phase) -> PhaseSummary
+{
+    PhaseSummary summary;
+    for (const auto& participantStatistics : statistics)
+    {
+        const auto& participantPhase = participantStatistics.*phase;
+        summary.maxDuration = std::max<Milliseconds>(summary.maxDuration, participantPhase.duration);
+        summary.meanDuration += participantPhase.duration;
+        summary.receivedMessages += participantPhase.receivedMessages;
+    }
+    summary.meanDuration /= static_cast<double>(statistics.size());
+    return summary;
+}
+
+void PrintPhase(const char* name, const PhaseSummary& summary)
+{
+    std::cout << "  " << std::left << std::setw(28) << name << std::right << std::fixed << std::setprecision(3)
+              << "max " << std::setw(10) << summary.maxDuration.count() << " ms   "
+              << "mean " << std::setw(10) << summary.meanDuration.count() << " ms   "
+              << "messages " << std::setw(8) << summary.receivedMessages << "\n";
+}
+
+bool RunJoinSimulation(size_t numberOfParticipants)
+{
+    VAsioRegistry registry{std::make_shared<SilKit::Config::ParticipantConfiguration>()};
+    const auto registryUri = registry.StartListening("silkit://localhost:0");
+
+    std::vector<std::unique_ptr<Participant<VAsioConnection>>> participants;
+    for (size_t index = 0; index != numberOfParticipants; ++index)
+    {
+        SilKit::Config::ParticipantConfiguration config;
+        config.participantName = "BenchParticipant" + std::to_string(index);
+        config.middleware.registryUri = registryUri;
+
+        participants.emplace_back(std::make_unique<Participant<VAsioConnection>>(std::move(config)));
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    // all participants join at the same time, like a simulation started by a script
+    std::vector<std::thread> joinThreads;
+    for (auto& participant : participants)
+    {
+        joinThreads.emplace_back([&participant] {
+            participant->JoinSilKitSimulation();
+        });
+    }
+    for (auto& thread : joinThreads)
+    {
+        thread.join();
+    }
+
+    const auto joinDuration = std::chrono::steady_clock::now() - start;
+
+    std::vector<JoinSimulationStatistics> statistics;
+    for (auto& participant : participants)
+    {
+        auto participantStatistics = participant->GetJoinSimulationStatistics();
+        while (!participantStatistics.isServiceDiscoveryComplete)
+        {
+            if (std::chrono::steady_clock::now() - start > serviceDiscoveryTimeout)
+            {
+                std::cerr << "participants: " << numberOfParticipants << ": timeout during service discovery"
+                          << std::endl;
+                return false;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+            participantStatistics = participant->GetJoinSimulationStatistics();
+        }
+        statistics.emplace_back(std::move(participantStatistics));
+    }
+
+    const auto totalDuration = std::chrono::steady_clock::now() - start;
+
+    std::cout << "participants: " << numberOfParticipants << "\n"
+              << std::fixed << std::setprecision(3)
+              << "  all joined after:           " << Milliseconds{joinDuration}.count() << " ms\n"
+              << "  all discovered after:       " << Milliseconds{totalDuration}.count() << " ms\n";
+    PrintPhase("registry handshake", Summarize(statistics, &JoinSimulationStatistics::registryHandshake));
+    PrintPhase("connect known participants", Summarize(statistics, &JoinSimulationStatistics::connectKnownParticipants));
+    PrintPhase("subscription acknowledge", Summarize(statistics, &JoinSimulationStatistics::subscriptionAcknowledge));
+    PrintPhase("service discovery", Summarize(statistics, &JoinSimulationStatistics::serviceDiscovery));
+    std::cout << std::endl;
+
+    return true;
+}
+
+} // namespace
+
+
+int main(int argc, char** argv)
+{
+    const size_t maxNumberOfParticipants = argc > 1 ? std::stoul(argv[1]) : 128;
+    const size_t minNumberOfParticipants = argc > 2 ? std::stoul(argv[2]) : 2;
+
+    for (auto numberOfParticipants = std::max<size_t>(minNumberOfParticipants, 1);
+         numberOfParticipants <= maxNumberOfParticipants; numberOfParticipants *= 2)
+    {
+        if (!RunJoinSimulation(numberOfParticipants))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,118 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+// Benchmark of Participant::SendMsg for CAN frames: A single participant creates CAN controllers on several networks
+// and sends frames from one of them. There are no remote receivers, so the measured time is dominated by the send
+// path down to the link (posting to the I/O thread, resolving the link, local distribution).
+//
+// Usage: SilKitBenchParticipantSendMsg [numberOfNetworks] [numberOfMessages]
+
+#include "VAsioConnection.hpp"
+#include "VAsioRegistry.hpp"
+#include "Participant.hpp"
+
+#include "WireCanMessages.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <string>
+
+
+namespace {
+
+using namespace SilKit::Core;
+
+auto MakeFrameEvent() -> SilKit::Services::Can::WireCanFrameEvent
+{
+    static const std::array<uint8_t, 8> data{1, 2, 3, 4, 5, 6, 7, 8};
+
+    SilKit::Services::Can::CanFrameEvent event{};
+    event.frame.canId = 5;
+    event.frame.dataField = SilKit::Util::MakeSpan(data);
+    event.frame.dlc = static_cast<uint16_t>(data.size());
+    event.direction = SilKit::Services::TransmitDirection::TX;
+    return SilKit::Services::Can::MakeWireCanFrameEvent(event);
+}
+
+} // namespace
+
+
+int main(int argc, char** argv)
+{
+    const size_t numberOfNetworks = argc > 1 ? std::stoul(argv[1]) : 64;
+    const size_t numberOfMessages = argc > 2 ? std::stoul(argv[2]) : 1000000;
+
+    VAsioRegistry registry{std::make_shared<SilKit::Config::ParticipantConfiguration>()};
+    const auto registryUri = registry.StartListening("silkit://localhost:0");
+
+    SilKit::Config::ParticipantConfiguration config;
+    config.participantName = "BenchParticipant";
+    config.middleware.registryUri = registryUri;
+
+    Participant<VAsioConnection> participant{std::move(config)};
+    participant.JoinSilKitSimulation();
+
+    // the links of all networks are registered, the frames are sent on the one in the middle
+    IServiceEndpoint* sender{nullptr};
+    for (size_t index = 0; index != numberOfNetworks; ++index)
+    {
+        const auto name = "CAN" + std::to_string(index);
+        auto* controller = participant.CreateCanController(name, name);
+        if (index == numberOfNetworks / 2)
+        {
+            sender = dynamic_cast<IServiceEndpoint*>(controller);
+        }
+    }
+
+    const auto frameEvent = MakeFrameEvent();
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (size_t index = 0; index != numberOfMessages; ++index)
+    {
+        participant.SendMsg(sender, frameEvent);
+    }
+    const auto sendDuration = std::chrono::steady_clock::now() - start;
+
+    // the I/O thread executes the sends in order, this runs after the last one
+    std::promise<void> done;
+    participant.ExecuteDeferred([&done] {
+        done.set_value();
+    });
+    done.get_future().wait();
+    const auto totalDuration = std::chrono::steady_clock::now() - start;
+
+    const auto sendNs = std::chrono::duration_cast<std::chrono::nanoseconds>(sendDuration).count();
+    const auto totalNs = std::chrono::duration_cast<std::chrono::nanoseconds>(totalDuration).count();
+    const auto messages = static_cast<double>(numberOfMessages);
+
+    std::cout << "networks:                     " << numberOfNetworks << "\n"
+              << "messages:                     " << numberOfMessages << "\n"
+              << "send nanoseconds/message:     " << static_cast<double>(sendNs) / messages << "\n"
+              << "total nanoseconds/message:    " << static_cast<double>(totalNs) / messages << "\n"
+              << "messages per second:          " << messages * 1e9 / static_cast<double>(totalNs) << std::endl;
+
+    return EXIT_SUCCESS;
+}
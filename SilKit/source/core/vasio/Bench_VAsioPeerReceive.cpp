@@ -0,0 +1,216 @@
+// Copyright (c) 2023 Vector Informatik GmbH
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+// LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+// OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Microbenchmark of the receive path of VAsioPeer: A fake byte stream feeds a stream of small serialized messages
+// into the peer and the heap allocations and the time spent per received message are reported.
+//
+// Usage: SilKitBenchVAsioPeerReceive [numberOfMessages] [readSize]
+
+#include "VAsioPeer.hpp"
+#include "IStrand.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+std::atomic<uint64_t> gAllocationCount{0};
+
+} // namespace
+
+
+// Count all heap allocations of the process.
+void* operator new(std::size_t size)
+{
+    gAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (auto* ptr = std::malloc(size == 0 ? 1 : size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+
+namespace {
+
+using namespace SilKit::Core;
+
+
+//! Strand which executes everything immediately, the benchmark is single-threaded.
+struct InlineStrand : IStrand
+{
+    void Post(IoTask task) override
+    {
+        task();
+    }
+
+    void Dispatch(IoTask task) override
+    {
+        task();
+    }
+};
+
+
+//! Byte stream which hands out the prepared data whenever the peer requests a read.
+struct FakeRawByteStream : IRawByteStream
+{
+    IRawByteStreamListener* listener{nullptr};
+    InlineStrand strand;
+    MutableBuffer readBuffer;
+    bool readPending{false};
+
+    void SetListener(IRawByteStreamListener& streamListener) override
+    {
+        listener = &streamListener;
+    }
+
+    auto GetLocalEndpoint() const -> std::string override
+    {
+        return "local:///bench";
+    }
+
+    auto GetRemoteEndpoint() const -> std::string override
+    {
+        return "local:///bench";
+    }
+
+    auto GetStrand() -> IStrand& override
+    {
+        return strand;
+    }
+
+    void AsyncReadSome(MutableBufferSequence bufferSequence) override
+    {
+        readBuffer = bufferSequence[0];
+        readPending = true;
+    }
+
+    void AsyncWriteSome(ConstBufferSequence) override {}
+
+    void Shutdown() override {}
+    auto GetRoundTripTime() const -> std::chrono::microseconds override { return std::chrono::microseconds{0}; }
+
+    //! Feed the data in chunks of at most readSize bytes. Returns the number of reads.
+    auto Feed(const std::vector<uint8_t>& data, size_t readSize) -> size_t
+    {
+        size_t numberOfReads{0};
+        size_t offset{0};
+        while (offset < data.size() && readPending)
+        {
+            const auto size = std::min({readSize, data.size() - offset, readBuffer.GetSize()});
+            std::memcpy(readBuffer.GetData(), data.data() + offset, size);
+            offset += size;
+            readPending = false;
+            ++numberOfReads;
+            listener->OnAsyncReadSomeDone(*this, size);
+        }
+        return numberOfReads;
+    }
+};
+
+
+struct CountingPeerListener : IVAsioPeerListener
+{
+    uint64_t numberOfMessages{0};
+
+    void OnSocketData(IVAsioPeer*, SerializedMessage&& buffer) override
+    {
+        if (buffer.GetMessageKind() == VAsioMsgKind::SubscriptionAnnouncement)
+        {
+            ++numberOfMessages;
+        }
+    }
+
+    void OnPeerShutdown(IVAsioPeer*) override {}
+    void OnPeerSendQueueOverflow(IVAsioPeer*, bool) override {}
+};
+
+
+auto MakeMessageStream(size_t numberOfMessages) -> std::vector<uint8_t>
+{
+    std::vector<uint8_t> data;
+    for (size_t index = 0; index != numberOfMessages; ++index)
+    {
+        VAsioMsgSubscriber subscriber;
+        subscriber.receiverIdx = static_cast<EndpointId>(index);
+        subscriber.networkName = "CAN" + std::to_string(index % 8);
+        subscriber.msgTypeName = "SomeMessageType";
+
+        const auto blob = SerializedMessage{subscriber}.ReleaseStorage();
+        data.insert(data.end(), blob.begin(), blob.end());
+    }
+    return data;
+}
+
+} // namespace
+
+
+int main(int argc, char** argv)
+{
+    const size_t numberOfMessages = argc > 1 ? std::stoul(argv[1]) : 1000000;
+    const size_t readSize = argc > 2 ? std::stoul(argv[2]) : 64 * 1024;
+
+    const auto data = MakeMessageStream(numberOfMessages);
+
+    CountingPeerListener listener;
+    auto stream = std::make_unique<FakeRawByteStream>();
+    auto* streamPtr = stream.get();
+    VAsioPeer peer{&listener, nullptr, std::move(stream), nullptr, VAsioPeerSettings{}};
+    peer.StartAsyncRead();
+
+    const auto allocationsBefore = gAllocationCount.load();
+    const auto start = std::chrono::steady_clock::now();
+
+    const auto numberOfReads = streamPtr->Feed(data, readSize);
+
+    const auto duration = std::chrono::steady_clock::now() - start;
+    const auto allocations = gAllocationCount.load() - allocationsBefore;
+
+    const auto durationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    const auto messages = static_cast<double>(std::max<uint64_t>(listener.numberOfMessages, 1));
+
+    std::cout << "messages:                 " << listener.numberOfMessages << "\n"
+              << "bytes:                    " << data.size() << "\n"
+              << "reads:                    " << numberOfReads << "\n"
+              << "allocations:              " << allocations << "\n"
+              << "allocations per message:  " << static_cast<double>(allocations) / messages << "\n"
+              << "nanoseconds per message:  " << static_cast<double>(durationNs) / messages << std::endl;
+
+    return listener.numberOfMessages == numberOfMessages ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,279 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+// Contention benchmark of the send path of VAsioPeer: Several threads publish small messages to the same peer in
+// parallel, while a single I/O thread writes them into a fake byte stream. The time until all messages have been
+// written is reported.
+//
+// Usage: SilKitBenchVAsioPeerSend [numberOfThreads] [messagesPerThread]
+
+#include "VAsioPeer.hpp"
+#include "IStrand.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace {
+
+using namespace SilKit::Core;
+
+
+//! Strand backed by a single worker thread, which plays the role of the I/O thread.
+class WorkerStrand : public IStrand
+{
+public:
+    WorkerStrand()
+        : _thread{[this] {
+            Work();
+        }}
+    {
+    }
+
+    ~WorkerStrand() override
+    {
+        Stop();
+    }
+
+    void Post(IoTask task) override
+    {
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+            _queue.emplace_back(std::move(task));
+        }
+        _condition.notify_one();
+    }
+
+    void Dispatch(IoTask task) override
+    {
+        if (std::this_thread::get_id() == _thread.get_id())
+        {
+            task();
+        }
+        else
+        {
+            Post(std::move(task));
+        }
+    }
+
+    //! Execute the remaining tasks and join the worker thread.
+    void Stop()
+    {
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+            _stopping = true;
+        }
+        _condition.notify_one();
+
+        if (_thread.joinable())
+        {
+            _thread.join();
+        }
+    }
+
+private:
+    void Work()
+    {
+        std::unique_lock<std::mutex> lock{_mutex};
+        while (true)
+        {
+            _condition.wait(lock, [this] {
+                return _stopping || !_queue.empty();
+            });
+
+            if (_queue.empty())
+            {
+                return;
+            }
+
+            auto task{std::move(_queue.front())};
+            _queue.pop_front();
+
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::deque<IoTask> _queue;
+    bool _stopping{false};
+    std::thread _thread;
+};
+
+
+//! Byte stream which completes every write immediately (on the strand) and counts the written bytes.
+struct FakeRawByteStream : IRawByteStream
+{
+    IRawByteStreamListener* listener{nullptr};
+    IStrand* strand{nullptr};
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    size_t bytesWritten{0};
+
+    void SetListener(IRawByteStreamListener& streamListener) override
+    {
+        listener = &streamListener;
+    }
+
+    auto GetLocalEndpoint() const -> std::string override
+    {
+        return "local:///bench";
+    }
+
+    auto GetRemoteEndpoint() const -> std::string override
+    {
+        return "local:///bench";
+    }
+
+    auto GetStrand() -> IStrand& override
+    {
+        return *strand;
+    }
+
+    void AsyncReadSome(MutableBufferSequence) override {}
+
+    void AsyncWriteSome(ConstBufferSequence bufferSequence) override
+    {
+        size_t size{0};
+        for (const auto& buffer : bufferSequence)
+        {
+            size += buffer.GetSize();
+        }
+
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            bytesWritten += size;
+        }
+        condition.notify_all();
+
+        strand->Post([this, size] {
+            listener->OnAsyncWriteSomeDone(*this, size);
+        });
+    }
+
+    void Shutdown() override {}
+    auto GetRoundTripTime() const -> std::chrono::microseconds override { return std::chrono::microseconds{0}; }
+
+    void WaitForBytesWritten(size_t size)
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        condition.wait(lock, [this, size] {
+            return bytesWritten >= size;
+        });
+    }
+};
+
+
+struct NullPeerListener : IVAsioPeerListener
+{
+    void OnSocketData(IVAsioPeer*, SerializedMessage&&) override {}
+    void OnPeerShutdown(IVAsioPeer*) override {}
+    void OnPeerSendQueueOverflow(IVAsioPeer*, bool) override {}
+};
+
+
+auto MakeMessage(size_t index) -> SerializedMessage
+{
+    VAsioMsgSubscriber subscriber;
+    subscriber.receiverIdx = static_cast<EndpointId>(index);
+    subscriber.networkName = "CAN1";
+    subscriber.msgTypeName = "SomeMessageType";
+    return SerializedMessage{subscriber};
+}
+
+} // namespace
+
+
+int main(int argc, char** argv)
+{
+    const size_t numberOfThreads = argc > 1 ? std::stoul(argv[1]) : 8;
+    const size_t messagesPerThread = argc > 2 ? std::stoul(argv[2]) : 200000;
+
+    const auto messageSize = MakeMessage(0).ReleaseStorage().size();
+    const auto numberOfMessages = numberOfThreads * messagesPerThread;
+
+    WorkerStrand strand;
+    NullPeerListener listener;
+    auto stream = std::make_unique<FakeRawByteStream>();
+    auto* streamPtr = stream.get();
+    stream->strand = &strand;
+    VAsioPeer peer{&listener, nullptr, std::move(stream), nullptr, VAsioPeerSettings{}};
+
+    std::atomic<bool> go{false};
+    std::vector<std::thread> publishers;
+    for (size_t thread = 0; thread != numberOfThreads; ++thread)
+    {
+        publishers.emplace_back([&peer, &go, messagesPerThread] {
+            while (!go)
+            {
+                std::this_thread::yield();
+            }
+
+            for (size_t index = 0; index != messagesPerThread; ++index)
+            {
+                peer.SendSilKitMsg(MakeMessage(index));
+            }
+        });
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    go = true;
+
+    for (auto& publisher : publishers)
+    {
+        publisher.join();
+    }
+    const auto publishDuration = std::chrono::steady_clock::now() - start;
+
+    streamPtr->WaitForBytesWritten(numberOfMessages * messageSize);
+    const auto totalDuration = std::chrono::steady_clock::now() - start;
+
+    // the peer must not be used by the strand anymore when it is destroyed
+    strand.Stop();
+
+    const auto publishNs = std::chrono::duration_cast<std::chrono::nanoseconds>(publishDuration).count();
+    const auto totalNs = std::chrono::duration_cast<std::chrono::nanoseconds>(totalDuration).count();
+    const auto messages = static_cast<double>(numberOfMessages);
+    const auto stats = peer.GetSendBatchStatistics();
+
+    std::cout << "publishing threads:           " << numberOfThreads << "\n"
+              << "messages:                     " << numberOfMessages << "\n"
+              << "writes:                       " << stats.numBatches << "\n"
+              << "messages per write:           " << messages / static_cast<double>(std::max<uint64_t>(stats.numBatches, 1)) << "\n"
+              << "publish nanoseconds/message:  " << static_cast<double>(publishNs) / messages << "\n"
+              << "total nanoseconds/message:    " << static_cast<double>(totalNs) / messages << "\n"
+              << "messages per second:          " << messages * 1e9 / static_cast<double>(totalNs) << std::endl;
+
+    return stats.numMessages == numberOfMessages ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -54,18 +54,44 @@ public:
     virtual void StartAsyncRead() = 0;
     //! Stops the IO loop of the peer
     virtual void Shutdown() = 0;
+    //! Keep the simulation data sent from now on within a BufferedSendScope in the sending queue, until
+    //! FlushSendBuffer is called
+    virtual void StartSendBuffering() = 0;
+    //! Write the messages buffered since StartSendBuffering
+    virtual void FlushSendBuffer() = 0;
     //! Version management for backward compatibility on network ser/des level
     virtual void SetProtocolVersion(ProtocolVersion v) = 0;
     virtual auto GetProtocolVersion() const -> ProtocolVersion = 0;
 };
 
 
+//! Marks the messages sent by the calling thread, while the scope is alive, as messages of a simulation step. A peer
+//! buffering its sending queue only holds back these messages, and only if they carry simulation data.
+class BufferedSendScope
+{
+public:
+    explicit BufferedSendScope(bool isBuffered);
+    ~BufferedSendScope();
+
+    BufferedSendScope(const BufferedSendScope&) = delete;
+    BufferedSendScope& operator=(const BufferedSendScope&) = delete;
+
+    //! True, if the calling thread sends the messages of a simulation step
+    static auto IsBuffered() -> bool;
+
+private:
+    bool _wasBuffered;
+};
+
+
 struct IVAsioPeerListener
 {
     virtual ~IVAsioPeerListener() = default;
 
     virtual void OnSocketData(IVAsioPeer* peer, SerializedMessage&& buffer) = 0;
     virtual void OnPeerShutdown(IVAsioPeer* peer) = 0;
+    //! The sending queue to the peer exceeded its limits (overflow is true), or is within its limits again.
+    virtual void OnPeerSendQueueOverflow(IVAsioPeer* peer, bool overflow) = 0;
 };
 
 
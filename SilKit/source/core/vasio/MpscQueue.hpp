@@ -0,0 +1,123 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+namespace SilKit {
+namespace Core {
+
+//! \brief Unbounded lock-free queue for multiple producers and a single consumer.
+//!
+//! Producers only perform a single atomic exchange per Push, they never wait for each other or for the consumer.
+//! Front, Pop, ForEach, and IsEmpty must only be called by the consumer (one thread at a time).
+//! The element type must be default-constructible, because the queue always keeps a (consumed) stub node.
+template <typename T>
+class MpscQueue
+{
+    struct Node
+    {
+        std::atomic<Node*> next{nullptr};
+        T value;
+    };
+
+public:
+    MpscQueue()
+        : _head{new Node{}}
+        , _tail{_head.load(std::memory_order_relaxed)}
+    {
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    ~MpscQueue()
+    {
+        while (_tail != nullptr)
+        {
+            auto* next = _tail->next.load(std::memory_order_relaxed);
+            delete _tail;
+            _tail = next;
+        }
+    }
+
+    //! Append the value to the queue. May be called from any thread.
+    void Push(T value)
+    {
+        auto* node = new Node{};
+        node->value = std::move(value);
+
+        // sequentially consistent, such that the users can combine IsEmpty with a flag of their own (see VAsioPeer)
+        auto* previous = _head.exchange(node);
+        // Until this store, the consumer cannot reach the node, but IsEmpty already returns false.
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    //! Returns the first element, or nullptr if there is none (or its Push has not completed yet).
+    auto Front() -> T*
+    {
+        auto* next = _tail->next.load(std::memory_order_acquire);
+        return next != nullptr ? &next->value : nullptr;
+    }
+
+    //! Remove the first element. Must only be called after Front returned an element.
+    void Pop()
+    {
+        auto* next = _tail->next.load(std::memory_order_acquire);
+        delete _tail;
+        // the popped node becomes the new stub, its value has been consumed
+        _tail = next;
+        _tail->value = T{};
+    }
+
+    //! Call the function with each element, from the first one to the last one whose Push has completed, until it
+    //! returns false. The function may modify the elements, but must not Pop them.
+    template <typename FunctionT>
+    void ForEach(FunctionT&& function)
+    {
+        for (auto* node = _tail->next.load(std::memory_order_acquire); node != nullptr;
+             node = node->next.load(std::memory_order_acquire))
+        {
+            if (!function(node->value))
+            {
+                return;
+            }
+        }
+    }
+
+    //! Returns true if no element has been pushed since the last Pop. A Push that has not completed yet already counts
+    //! as an element.
+    auto IsEmpty() const -> bool
+    {
+        return _head.load() == _tail;
+    }
+
+private:
+    //! Most recently pushed node, shared by all producers
+    std::atomic<Node*> _head;
+    //! Stub node in front of the first element, only accessed by the consumer
+    Node* _tail;
+};
+
+} // namespace Core
+} // namespace SilKit
@@ -31,9 +31,30 @@ SerializedMessage::SerializedMessage(std::vector<uint8_t>&& blob)
     ReadNetworkHeaders();
 }
 
+SerializedMessage::SerializedMessage(VAsioMsgKind messageKind, EndpointAddress endpointAddress, EndpointId remoteIndex,
+                                     SharedPayload sharedPayload, bool isUserData)
+    : _messageKind{messageKind}
+    , _isUserData{isUserData}
+    , _endpointAddress{endpointAddress}
+    , _remoteIndex{remoteIndex}
+    , _sharedPayload{std::move(sharedPayload)}
+{
+    if (!IsMwOrSim(_messageKind))
+    {
+        throw SilKitError("SerializedMessage: a shared payload is not supported for message kind: "
+                          + std::to_string((int)_messageKind));
+    }
+    WriteNetworkHeaders();
+    ReadNetworkHeaders();
+}
+
 auto SerializedMessage::ReleaseStorage() -> std::vector<uint8_t>
 {
     auto buffer = _buffer.ReleaseStorage();
+    if (_sharedPayload)
+    {
+        buffer.insert(buffer.end(), _sharedPayload->begin(), _sharedPayload->end());
+    }
     if (buffer.size() > std::numeric_limits<uint32_t>::max())
         throw SilKitError{"SerializedMessage::Serialize: message buffer is too large"};
 
@@ -43,6 +64,29 @@ auto SerializedMessage::ReleaseStorage() -> std::vector<uint8_t>
     return buffer;
 }
 
+auto SerializedMessage::ReleaseReceivedStorage() -> std::vector<uint8_t>
+{
+    return _buffer.ReleaseStorage();
+}
+
+auto SerializedMessage::ReleaseHeaderStorage() -> std::vector<uint8_t>
+{
+    auto buffer = _buffer.ReleaseStorage();
+    const auto payloadSize = _sharedPayload ? _sharedPayload->size() : size_t{0};
+    if (buffer.size() + payloadSize > std::numeric_limits<uint32_t>::max())
+        throw SilKitError{"SerializedMessage::Serialize: message buffer is too large"};
+
+    // the message size in the header covers the shared payload, which is transmitted separately
+    const auto bufferSize = static_cast<uint32_t>(buffer.size() + payloadSize);
+    memcpy(buffer.data(), &bufferSize, sizeof(uint32_t));
+    return buffer;
+}
+
+auto SerializedMessage::GetSharedPayload() const -> const SharedPayload&
+{
+    return _sharedPayload;
+}
+
 auto SerializedMessage::GetMessageKind() const -> VAsioMsgKind
 {
     return _messageKind;
@@ -63,6 +107,11 @@ auto SerializedMessage::GetRemoteIndex() const -> EndpointId
     return _remoteIndex;
 }
 
+auto SerializedMessage::IsUserData() const -> bool
+{
+    return _isUserData;
+}
+
 auto SerializedMessage::GetEndpointAddress() const -> EndpointAddress
 {
     if (!IsMwOrSim(_messageKind))
@@ -88,6 +137,16 @@ auto SerializedMessage::GetProxyMessageHeader() const -> ProxyMessageHeader
     return _proxyMessageHeader;
 }
 
+auto SerializedMessage::PeekProxyMessageRoute() -> ProxyMessageRoute
+{
+    if (_messageKind != VAsioMsgKind::SilKitProxyMessage)
+    {
+        throw SilKitError("SerializedMessage::PeekProxyMessageRoute called on wrong message kind: "
+                          + std::to_string((int)_messageKind));
+    }
+    return SilKit::Core::PeekProxyMessageRoute(_buffer);
+}
+
 void SerializedMessage::WriteNetworkHeaders()
 {
     _buffer << _messageSize; // placeholder for finalization via ReleaseStorage()
@@ -123,6 +182,7 @@ void SerializedMessage::ReadNetworkHeaders()
         case RegistryMessageKind::ParticipantAnnouncement:
         case RegistryMessageKind::KnownParticipants:
         case RegistryMessageKind::RemoteParticipantConnectRequest:
+        case RegistryMessageKind::SharedMemoryUpgrade:
             _registryMessageHeader = PeekRegistryMessageHeader(_buffer);
             break;
         case RegistryMessageKind::ParticipantAnnouncementReply:
@@ -19,6 +19,8 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
+#include <memory>
+
 #include "VAsioMsgKind.hpp"
 #include "VAsioDatatypes.hpp"
 #include "SerializedMessageTraits.hpp"
@@ -38,6 +40,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "LoggingSerdes.hpp"
 #include "DataSerdes.hpp"
 
+#include "traits/SilKitMsgTraits.hpp"
+
 namespace SilKit {
 namespace Core {
 
@@ -64,6 +68,10 @@ struct SerializedSize
     }
 };
 
+//! Serialized payload of a message without network headers. The payload is immutable, so it can be serialized once and
+//! shared between the SerializedMessages sent to multiple remote receivers, which only differ in their network headers.
+using SharedPayload = std::shared_ptr<const std::vector<uint8_t>>;
+
 // A serialized message used as binary wire format for the VAsio transport.
 class SerializedMessage
 {
@@ -81,11 +89,24 @@ public: // Sending a SerializedMessage: from T to binary blob
 	explicit SerializedMessage(const MessageT& message , EndpointAddress endpointAddress, EndpointId remoteIndex);
 	template<typename MessageT>
 	explicit SerializedMessage(ProtocolVersion version, const MessageT& message);
+	// Sim messages with a payload shared between multiple receivers:
+	explicit SerializedMessage(VAsioMsgKind messageKind, EndpointAddress endpointAddress, EndpointId remoteIndex,
+	                           SharedPayload sharedPayload, bool isUserData = false);
 
+	template<typename MessageT>
+	static auto MakeSharedPayload(const MessageT& message) -> SharedPayload;
+
+	//! Return the complete message. A shared payload is copied behind the network headers.
 	auto ReleaseStorage() -> std::vector<uint8_t>;
+	//! Return only the network headers of a message with a shared payload. The message size covers the shared payload,
+	//! which must be transmitted directly after the headers.
+	auto ReleaseHeaderStorage() -> std::vector<uint8_t>;
+	auto GetSharedPayload() const -> const SharedPayload&;
 
 public: // Receiving a SerializedMessage: from binary blob to SilKitMessage<T>
 	explicit SerializedMessage(std::vector<uint8_t>&& blob);
+	//! Return the received storage unmodified, e.g., to reuse its capacity for the next received message.
+	auto ReleaseReceivedStorage() -> std::vector<uint8_t>;
 
 	template<typename ApiMessageT>
 	auto Deserialize() -> ApiMessageT;
@@ -96,8 +117,12 @@ public: // Receiving a SerializedMessage: from binary blob to SilKitMessage<T>
 	auto GetRegistryKind() const -> RegistryMessageKind;
 	auto GetRemoteIndex() const -> EndpointId;
 	auto GetEndpointAddress() const -> EndpointAddress;
+	//! True, if the message carries user data (see SilKitMsgTraitUserData). Only user data may be discarded.
+	auto IsUserData() const -> bool;
 	void SetProtocolVersion(ProtocolVersion version);
     auto GetProxyMessageHeader() const -> ProxyMessageHeader;
+    //! Read the source and destination of a proxy message, without deserializing (or consuming) its payload.
+    auto PeekProxyMessageRoute() -> ProxyMessageRoute;
 	auto GetRegistryMessageHeader() const -> RegistryMsgHeader;
 
 private:
@@ -107,6 +132,8 @@ private:
 	uint32_t _messageSize{0};
 	VAsioMsgKind _messageKind{VAsioMsgKind::Invalid};
 	RegistryMessageKind _registryKind{RegistryMessageKind::Invalid};
+	// not part of the network headers, only known for the messages sent by this participant
+	bool _isUserData{false};
 	// For simMsg
 	EndpointAddress _endpointAddress{};
 	EndpointId _remoteIndex{0};
@@ -116,6 +143,7 @@ private:
     ProxyMessageHeader _proxyMessageHeader;
 
 	MessageBuffer _buffer;
+	SharedPayload _sharedPayload;
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -129,6 +157,7 @@ SerializedMessage::SerializedMessage(const MessageT& message)
 
     _messageKind = messageKind<MessageT>();
     _registryKind = registryMessageKind<MessageT>();
+    _isUserData = SilKitMsgTraitUserData<MessageT>::IsUserData();
     WriteNetworkHeaders();
     Serialize(_buffer, message);
     //Ensure we can directly Deserialize in unit tests by reading the header in again
@@ -143,6 +172,7 @@ SerializedMessage::SerializedMessage(ProtocolVersion version, const MessageT& me
 
     _messageKind = messageKind<MessageT>();
     _registryKind = registryMessageKind<MessageT>();
+    _isUserData = SilKitMsgTraitUserData<MessageT>::IsUserData();
     _buffer.SetProtocolVersion(version);
     WriteNetworkHeaders();
     Serialize(_buffer, message);
@@ -160,12 +190,24 @@ SerializedMessage::SerializedMessage(const MessageT& message, EndpointAddress en
     _endpointAddress = endpointAddress;
     _messageKind = messageKind<MessageT>();
     _registryKind = registryMessageKind<MessageT>();
+    _isUserData = SilKitMsgTraitUserData<MessageT>::IsUserData();
     WriteNetworkHeaders();
     Serialize(_buffer, message);
     //Ensure we can directly Deserialize in unit tests by reading the header in again
     ReadNetworkHeaders();
 }
 
+template <typename MessageT>
+auto SerializedMessage::MakeSharedPayload(const MessageT& message) -> SharedPayload
+{
+    static SerializedSize<MessageT> messageSize{message};
+
+    MessageBuffer buffer;
+    buffer.IncreaseCapacity(messageSize.Size());
+    Serialize(buffer, message);
+    return std::make_shared<const std::vector<uint8_t>>(buffer.ReleaseStorage());
+}
+
 template <typename ApiMessageT>
 auto SerializedMessage::Deserialize() -> ApiMessageT
 {
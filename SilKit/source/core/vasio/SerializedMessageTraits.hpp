@@ -41,12 +41,18 @@ template<>
 inline constexpr auto messageKind<KnownParticipants>() -> VAsioMsgKind { return VAsioMsgKind::SilKitRegistryMessage; }
 template<>
 inline constexpr auto messageKind<RemoteParticipantConnectRequest>() -> VAsioMsgKind { return VAsioMsgKind::SilKitRegistryMessage; }
+template<>
+inline constexpr auto messageKind<SharedMemoryUpgrade>() -> VAsioMsgKind { return VAsioMsgKind::SilKitRegistryMessage; }
 
 // Service subscription
 template<>
 inline constexpr auto messageKind<SubscriptionAcknowledge>() -> VAsioMsgKind { return VAsioMsgKind::SubscriptionAcknowledge; }
 template<>
 inline constexpr auto messageKind<VAsioMsgSubscriber>() -> VAsioMsgKind { return VAsioMsgKind::SubscriptionAnnouncement; }
+template<>
+inline constexpr auto messageKind<SubscriptionAnnouncementBatch>() -> VAsioMsgKind { return VAsioMsgKind::SubscriptionAnnouncementBatch; }
+template<>
+inline constexpr auto messageKind<SubscriptionAcknowledgeBatch>() -> VAsioMsgKind { return VAsioMsgKind::SubscriptionAcknowledgeBatch; }
 
 // Proxy messages
 template<>
@@ -65,6 +71,11 @@ inline constexpr auto registryMessageKind<RemoteParticipantConnectRequest>() ->
 {
     return RegistryMessageKind::RemoteParticipantConnectRequest;
 }
+template<>
+inline constexpr auto registryMessageKind<SharedMemoryUpgrade>() -> RegistryMessageKind
+{
+    return RegistryMessageKind::SharedMemoryUpgrade;
+}
 
 // Helper function to classify simulation messages based on message kind
 inline constexpr bool IsMwOrSim(VAsioMsgKind kind);
@@ -0,0 +1,159 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "MpscQueue.hpp"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using SilKit::Core::MpscQueue;
+
+TEST(Test_MpscQueue, elements_are_popped_in_push_order)
+{
+    MpscQueue<int> queue;
+    EXPECT_TRUE(queue.IsEmpty());
+    EXPECT_EQ(queue.Front(), nullptr);
+
+    queue.Push(1);
+    queue.Push(2);
+    queue.Push(3);
+    EXPECT_FALSE(queue.IsEmpty());
+
+    for (int expected = 1; expected <= 3; ++expected)
+    {
+        ASSERT_NE(queue.Front(), nullptr);
+        EXPECT_EQ(*queue.Front(), expected);
+        queue.Pop();
+    }
+
+    EXPECT_TRUE(queue.IsEmpty());
+    EXPECT_EQ(queue.Front(), nullptr);
+}
+
+TEST(Test_MpscQueue, popped_values_are_released)
+{
+    auto value = std::make_shared<int>(42);
+
+    MpscQueue<std::shared_ptr<int>> queue;
+    queue.Push(value);
+    queue.Push(value);
+    EXPECT_EQ(value.use_count(), 3);
+
+    auto front = std::move(*queue.Front());
+    queue.Pop();
+    front.reset();
+    EXPECT_EQ(value.use_count(), 2);
+
+    queue.Pop();
+    EXPECT_EQ(value.use_count(), 1);
+}
+
+TEST(Test_MpscQueue, destructor_releases_remaining_values)
+{
+    auto value = std::make_shared<int>(42);
+    {
+        MpscQueue<std::shared_ptr<int>> queue;
+        queue.Push(value);
+        queue.Push(value);
+    }
+    EXPECT_EQ(value.use_count(), 1);
+}
+
+TEST(Test_MpscQueue, for_each_visits_the_elements_in_push_order_until_stopped)
+{
+    MpscQueue<int> queue;
+    queue.Push(1);
+    queue.Push(2);
+    queue.Push(3);
+    queue.Pop();
+
+    std::vector<int> visited;
+    queue.ForEach([&visited](int& value) {
+        visited.push_back(value);
+        value *= 10;
+        return true;
+    });
+    EXPECT_EQ(visited, (std::vector<int>{2, 3}));
+
+    visited.clear();
+    queue.ForEach([&visited](int& value) {
+        visited.push_back(value);
+        return false;
+    });
+    EXPECT_EQ(visited, (std::vector<int>{20}));
+}
+
+TEST(Test_MpscQueue, concurrent_producers_keep_their_order)
+{
+    constexpr size_t numberOfProducers{4};
+    constexpr size_t numberOfValues{100000};
+
+    struct Value
+    {
+        size_t producer{0};
+        size_t index{0};
+    };
+
+    MpscQueue<Value> queue;
+
+    std::vector<std::thread> producers;
+    for (size_t producer = 0; producer != numberOfProducers; ++producer)
+    {
+        producers.emplace_back([&queue, producer] {
+            for (size_t index = 0; index != numberOfValues; ++index)
+            {
+                queue.Push(Value{producer, index});
+            }
+        });
+    }
+
+    std::vector<size_t> nextIndex(numberOfProducers, 0);
+    size_t mismatches{0};
+    for (size_t received = 0; received != numberOfProducers * numberOfValues;)
+    {
+        auto* value = queue.Front();
+        if (value == nullptr)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        mismatches += value->index != nextIndex[value->producer] ? 1 : 0;
+        nextIndex[value->producer] = value->index + 1;
+        queue.Pop();
+        ++received;
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_EQ(mismatches, 0u);
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+} // anonymous namespace
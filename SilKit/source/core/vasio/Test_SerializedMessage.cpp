@@ -20,6 +20,7 @@ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "SerializedMessage.hpp"
+#include "TestDataTraits.hpp"
 
 #include <cstdint>
 #include <array>
@@ -95,3 +96,79 @@ TEST(Test_SerializedMessage, packed_handshake_message)
 
     ASSERT_EQ(to_string(ptr->acceptorUri0, ptr->acceptorUri0Size), announcement.peerInfo.acceptorUris.at(0));
 }
+
+TEST(Test_SerializedMessage, shared_payload_matches_contiguous_message)
+{
+    SilKit::Core::Tests::TestFrameEvent msg;
+    msg.integer = 1234;
+    msg.str = "shared payload";
+
+    const EndpointAddress endpointAddress{5, 6};
+    const EndpointId remoteIndex{7};
+
+    auto expected = SerializedMessage{msg, endpointAddress, remoteIndex}.ReleaseStorage();
+
+    const auto sharedPayload = SerializedMessage::MakeSharedPayload(msg);
+
+    // the complete message is identical to the message serialized without a shared payload
+    SerializedMessage sharedMessage{VAsioMsgKind::SilKitMwMsg, endpointAddress, remoteIndex, sharedPayload};
+    ASSERT_EQ(sharedMessage.GetRemoteIndex(), remoteIndex);
+    ASSERT_EQ(sharedMessage.GetEndpointAddress(), endpointAddress);
+    ASSERT_EQ(sharedMessage.ReleaseStorage(), expected);
+
+    // the network headers announce the size of the complete message, followed by the shared payload
+    SerializedMessage splitMessage{VAsioMsgKind::SilKitMwMsg, endpointAddress, remoteIndex, sharedPayload};
+    ASSERT_EQ(splitMessage.GetSharedPayload(), sharedPayload);
+
+    auto headers = splitMessage.ReleaseHeaderStorage();
+    ASSERT_EQ(headers.size() + sharedPayload->size(), expected.size());
+
+    headers.insert(headers.end(), sharedPayload->begin(), sharedPayload->end());
+    ASSERT_EQ(headers, expected);
+
+    SerializedMessage received{std::move(headers)};
+    const auto receivedMsg = received.Deserialize<SilKit::Core::Tests::TestFrameEvent>();
+    ASSERT_EQ(receivedMsg.integer, msg.integer);
+    ASSERT_EQ(receivedMsg.str, msg.str);
+}
+
+TEST(Test_SerializedMessage, proxy_message_is_relayed_without_deserialization)
+{
+    ProxyMessage msg;
+    msg.source = "Source";
+    msg.destination = "Destination";
+    msg.payload = std::vector<uint8_t>(100, 0x5a);
+
+    const auto expected = SerializedMessage{msg}.ReleaseStorage();
+
+    // the route is read without consuming the message
+    SerializedMessage received{std::vector<uint8_t>{expected}};
+    const auto route = received.PeekProxyMessageRoute();
+    ASSERT_EQ(route.source, msg.source);
+    ASSERT_EQ(route.destination, msg.destination);
+
+    const auto deserialized = received.Deserialize<ProxyMessage>();
+    ASSERT_EQ(deserialized.source, msg.source);
+    ASSERT_EQ(deserialized.payload, msg.payload);
+
+    // the relayed message is identical to the received one
+    SerializedMessage relayed{std::vector<uint8_t>{expected}};
+    SerializedMessage forwarded{relayed.ReleaseReceivedStorage()};
+    ASSERT_EQ(forwarded.GetMessageKind(), VAsioMsgKind::SilKitProxyMessage);
+    ASSERT_EQ(forwarded.ReleaseStorage(), expected);
+}
+
+TEST(Test_SerializedMessage, only_user_data_may_be_discarded)
+{
+    const EndpointAddress endpointAddress{5, 6};
+    const EndpointId remoteIndex{7};
+
+    ASSERT_TRUE((SerializedMessage{SilKit::Core::Tests::TestFrameEvent{}, endpointAddress, remoteIndex}.IsUserData()));
+    ASSERT_FALSE((SerializedMessage{SilKit::Services::Orchestration::NextSimTask{}, endpointAddress, remoteIndex}
+                      .IsUserData()));
+    ASSERT_FALSE(SerializedMessage{VAsioMsgSubscriber{}}.IsUserData());
+
+    // received messages are never discarded, e.g., when they are relayed by the registry
+    const auto blob = SerializedMessage{SilKit::Core::Tests::TestFrameEvent{}, endpointAddress, remoteIndex}.ReleaseStorage();
+    ASSERT_FALSE(SerializedMessage{std::vector<uint8_t>{blob}}.IsUserData());
+}
@@ -158,6 +158,16 @@ struct DummyVAsioPeerBase : IVAsioPeer
         throw MethodNotImplementedError{};
     }
 
+    void StartSendBuffering() final
+    {
+        throw MethodNotImplementedError{};
+    }
+
+    void FlushSendBuffer() final
+    {
+        throw MethodNotImplementedError{};
+    }
+
     void SetProtocolVersion(ProtocolVersion) final
     {
         throw MethodNotImplementedError{};
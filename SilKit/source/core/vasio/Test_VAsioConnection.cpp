@@ -57,6 +57,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "ILogger.hpp"
 
 #include <chrono>
+#include <future>
+#include <thread>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -77,6 +79,9 @@ struct MockSilKitMessageReceiver
 {
     ServiceDescriptor _serviceDescriptor;
 
+    using SilKitReceiveMessagesTypes = std::tuple<Tests::TestFrameEvent>;
+    using SilKitSendMessagesTypes = std::tuple<>;
+
     MockSilKitMessageReceiver()
     {
         _serviceDescriptor.SetServiceId(1);
@@ -131,12 +136,44 @@ struct MockVAsioPeer
     MOCK_METHOD(void, SetProtocolVersion, (ProtocolVersion), (override));
     MOCK_METHOD(ProtocolVersion, GetProtocolVersion, (), (const, override));
     MOCK_METHOD(void, Shutdown, (), (override));
+    MOCK_METHOD(void, StartSendBuffering, (), (override));
+    MOCK_METHOD(void, FlushSendBuffer, (), (override));
 
     // IServiceEndpoint (via IVAsioPeer)
     MOCK_METHOD(void, SetServiceDescriptor, (const ServiceDescriptor& serviceDescriptor), (override));
     MOCK_METHOD(const ServiceDescriptor&, GetServiceDescriptor, (), (override, const));
 };
 
+struct SenderEndpoint : IServiceEndpoint
+{
+    ServiceDescriptor _serviceDescriptor;
+
+    SenderEndpoint(std::string networkName, EndpointId serviceId)
+    {
+        _serviceDescriptor.SetParticipantNameAndComputeId("Test_VAsioConnection");
+        _serviceDescriptor.SetNetworkName(std::move(networkName));
+        _serviceDescriptor.SetServiceId(serviceId);
+    }
+
+    void SetServiceDescriptor(const ServiceDescriptor& serviceDescriptor) override
+    {
+        _serviceDescriptor = serviceDescriptor;
+    }
+
+    auto GetServiceDescriptor() const -> const ServiceDescriptor& override
+    {
+        return _serviceDescriptor;
+    }
+};
+
+auto MakeSubscriptionAcknowledge(const VAsioMsgSubscriber& subscriber) -> SerializedMessage
+{
+    SubscriptionAcknowledge ack;
+    ack.status = SubscriptionAcknowledge::Status::Success;
+    ack.subscriber = subscriber;
+    return SerializedMessage{ack};
+}
+
 //////////////////////////////////////////////////////////////////////
 // Matchers
 //////////////////////////////////////////////////////////////////////
@@ -158,6 +195,42 @@ MATCHER_P(SubscriptionAcknowledgeMatcher, subscriber,
         ;
 }
 
+MATCHER_P(SubscriptionAcknowledgeBatchMatcher, subscribers,
+    "Deserialize the MessageBuffer from the SerializedMessage and check the acks of the subscription batch")
+{
+    SerializedMessage message = arg;
+    if (message.GetMessageKind() != VAsioMsgKind::SubscriptionAcknowledgeBatch)
+    {
+        return false;
+    }
+    auto reply = message.Deserialize<SubscriptionAcknowledgeBatch>();
+    if (reply.acknowledges.size() != subscribers.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < subscribers.size(); ++i)
+    {
+        if (reply.acknowledges[i].status != SubscriptionAcknowledge::Status::Success
+            || !(reply.acknowledges[i].subscriber == subscribers[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+MATCHER_P(SubscriptionAnnouncementBatchMatcher, numSubscribers,
+    "Deserialize the MessageBuffer from the SerializedMessage and check the number of announced subscriptions")
+{
+    SerializedMessage message = arg;
+    if (message.GetMessageKind() != VAsioMsgKind::SubscriptionAnnouncementBatch)
+    {
+        return false;
+    }
+    auto batch = message.Deserialize<SubscriptionAnnouncementBatch>();
+    return batch.subscribers.size() == static_cast<size_t>(numSubscribers);
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////
@@ -188,6 +261,84 @@ protected:
     {
         _connection.RegisterSilKitMsgReceiver<MessageT, ServiceT>(receiver);
     }
+
+    template<typename MessageT>
+    void RegisterSilKitMsgSender(const IServiceEndpoint* sender)
+    {
+        _connection.RegisterSilKitMsgSender<MessageT>(sender);
+    }
+
+    template<typename MessageT>
+    void RegisterSilKitMsgSender(VAsioConnection& connection, const IServiceEndpoint* sender)
+    {
+        connection.RegisterSilKitMsgSender<MessageT>(sender);
+    }
+
+    template<typename MessageT>
+    void SendMsgImpl(const IServiceEndpoint* from, const MessageT& message)
+    {
+        _connection.SendMsgImpl(from, message);
+    }
+
+    auto GetRemoteServiceEndpoint(IVAsioPeer* peer, EndpointId endpointId) -> const IServiceEndpoint*
+    {
+        return _connection.GetRemoteServiceEndpoint(peer, endpointId);
+    }
+
+    auto GetNumberOfRemoteServiceEndpoints(IVAsioPeer* peer) -> size_t
+    {
+        const auto it = _connection._remoteServiceEndpoints.find(peer);
+        return it == _connection._remoteServiceEndpoints.end() ? 0 : it->second.size();
+    }
+
+    void RemovePeerFromConnection(IVAsioPeer* peer)
+    {
+        _connection.RemovePeerFromConnection(peer);
+    }
+
+    void AddPeer(std::unique_ptr<IVAsioPeer> peer)
+    {
+        _connection.AddPeer(std::move(peer));
+    }
+
+    void SendPendingSubscriptions()
+    {
+        _connection.SendPendingSubscriptions();
+    }
+
+    auto GetNumberOfPendingSubscriptionAcknowledges() -> size_t
+    {
+        return _connection._pendingSubscriptionAcknowledges.size();
+    }
+
+    void EnableSendBuffering()
+    {
+        _connection._config.middleware.enableSendBuffering = true;
+    }
+
+    //! Runs the I/O context on the calling thread until it runs out of work.
+    void RunIoContext()
+    {
+        _connection._ioContext->Run();
+    }
+
+    //! Runs the I/O context on the calling thread until the predicate holds, e.g., while another thread waits for
+    //! the registration to complete. Returns false if the predicate does not hold within a few seconds.
+    template <typename PredicateT>
+    bool RunIoContextUntil(PredicateT predicate)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + 5s;
+        while (!predicate())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                return false;
+            }
+            RunIoContext();
+            std::this_thread::yield();
+        }
+        return true;
+    }
 };
 
 } // namespace Core
@@ -296,3 +447,317 @@ TEST_F(Test_VAsioConnection, DISABLED_versioned_send_testmessage)
 
     _connection.OnSocketData(&_from, std::move(buffer));
 }
+
+//////////////////////////////////////////////////////////////////////
+// Batched subscriptions
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(Test_VAsioConnection, subscription_announcement_batch_is_acknowledged_in_one_message)
+{
+    using MessageTrait = SilKit::Core::SilKitMsgTraits<Tests::TestFrameEvent>;
+
+    SubscriptionAnnouncementBatch batch;
+    for (const auto* networkName : {"A", "B", "C"})
+    {
+        VAsioMsgSubscriber subscriber;
+        subscriber.receiverIdx = static_cast<EndpointId>(batch.subscribers.size());
+        subscriber.networkName = networkName;
+        subscriber.msgTypeName = MessageTrait::SerdesName();
+        subscriber.version = MessageTrait::Version();
+        batch.subscribers.push_back(subscriber);
+    }
+
+    EXPECT_CALL(_from, SendSilKitMsg(SubscriptionAcknowledgeBatchMatcher(batch.subscribers))).Times(1);
+    _connection.OnSocketData(&_from, SerializedMessage{batch});
+}
+
+TEST_F(Test_VAsioConnection, pending_subscriptions_are_announced_in_one_batch_to_capable_peers)
+{
+    auto batchPeer = std::make_unique<MockVAsioPeer>();
+    batchPeer->_peerInfo.participantName = "BatchPeer";
+    {
+        VAsioCapabilities capabilities;
+        capabilities.AddCapability(Capabilities::SubscriptionBatch);
+        batchPeer->_peerInfo.capabilities = capabilities.ToCapabilitiesString();
+    }
+    EXPECT_CALL(*batchPeer, SendSilKitMsg(SubscriptionAnnouncementBatchMatcher(2))).Times(1);
+    EXPECT_CALL(*batchPeer, Subscribe(_)).Times(0);
+
+    auto legacyPeer = std::make_unique<MockVAsioPeer>();
+    legacyPeer->_peerInfo.participantName = "LegacyPeer";
+    EXPECT_CALL(*legacyPeer, SendSilKitMsg(_)).Times(0);
+    EXPECT_CALL(*legacyPeer, Subscribe(_)).Times(2);
+
+    AddPeer(std::move(batchPeer));
+    AddPeer(std::move(legacyPeer));
+
+    MockSilKitMessageReceiver receiverA;
+    receiverA._serviceDescriptor.SetNetworkName("A");
+    RegisterSilKitMsgReceiver<Tests::TestFrameEvent, MockSilKitMessageReceiver>(&receiverA);
+
+    MockSilKitMessageReceiver receiverB;
+    receiverB._serviceDescriptor.SetNetworkName("B");
+    RegisterSilKitMsgReceiver<Tests::TestFrameEvent, MockSilKitMessageReceiver>(&receiverB);
+
+    SendPendingSubscriptions();
+    EXPECT_EQ(GetNumberOfPendingSubscriptionAcknowledges(), 4u);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Registration batches
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(Test_VAsioConnection, registration_batch_defers_the_subscriptions_until_its_end)
+{
+    std::vector<VAsioMsgSubscriber> subscribers;
+    auto peer = std::make_unique<MockVAsioPeer>();
+    auto* peerPtr = peer.get();
+    EXPECT_CALL(*peer, Subscribe(_)).Times(2).WillRepeatedly([&subscribers](VAsioMsgSubscriber subscriber) {
+        subscribers.push_back(std::move(subscriber));
+    });
+    AddPeer(std::move(peer));
+
+    MockSilKitMessageReceiver receiverA;
+    receiverA._serviceDescriptor.SetNetworkName("A");
+    MockSilKitMessageReceiver receiverB;
+    receiverB._serviceDescriptor.SetNetworkName("B");
+
+    _connection.BeginRegistrationBatch();
+    _connection.RegisterSilKitService(&receiverA);
+    _connection.RegisterSilKitService(&receiverB);
+    RunIoContext();
+    EXPECT_TRUE(subscribers.empty());
+    EXPECT_EQ(GetNumberOfPendingSubscriptionAcknowledges(), 0u);
+
+    auto batchEnded = std::async(std::launch::async, [this] {
+        _connection.EndRegistrationBatch();
+    });
+    ASSERT_TRUE(RunIoContextUntil([&subscribers] { return subscribers.size() == 2; }));
+    EXPECT_EQ(GetNumberOfPendingSubscriptionAcknowledges(), 2u);
+
+    for (const auto& subscriber : subscribers)
+    {
+        _connection.OnSocketData(peerPtr, MakeSubscriptionAcknowledge(subscriber));
+    }
+    EXPECT_EQ(batchEnded.wait_for(5s), std::future_status::ready);
+}
+
+TEST_F(Test_VAsioConnection, registration_batch_waits_once_for_all_acknowledges_at_its_end)
+{
+    std::vector<VAsioMsgSubscriber> subscribers;
+    auto peer = std::make_unique<MockVAsioPeer>();
+    auto* peerPtr = peer.get();
+    EXPECT_CALL(*peer, Subscribe(_)).Times(2).WillRepeatedly([&subscribers](VAsioMsgSubscriber subscriber) {
+        subscribers.push_back(std::move(subscriber));
+    });
+    AddPeer(std::move(peer));
+
+    MockSilKitMessageReceiver receiverA;
+    receiverA._serviceDescriptor.SetNetworkName("A");
+    MockSilKitMessageReceiver receiverB;
+    receiverB._serviceDescriptor.SetNetworkName("B");
+
+    _connection.BeginRegistrationBatch();
+
+    // the registrations inside the batch return without waiting for acknowledges
+    auto registered = std::async(std::launch::async, [this, &receiverA, &receiverB] {
+        _connection.RegisterSilKitService(&receiverA);
+        _connection.RegisterSilKitService(&receiverB);
+    });
+    ASSERT_EQ(registered.wait_for(5s), std::future_status::ready);
+
+    auto batchEnded = std::async(std::launch::async, [this] {
+        _connection.EndRegistrationBatch();
+    });
+    ASSERT_TRUE(RunIoContextUntil([&subscribers] { return subscribers.size() == 2; }));
+    EXPECT_EQ(batchEnded.wait_for(100ms), std::future_status::timeout);
+
+    _connection.OnSocketData(peerPtr, MakeSubscriptionAcknowledge(subscribers[0]));
+    EXPECT_EQ(batchEnded.wait_for(100ms), std::future_status::timeout);
+
+    _connection.OnSocketData(peerPtr, MakeSubscriptionAcknowledge(subscribers[1]));
+    EXPECT_EQ(batchEnded.wait_for(5s), std::future_status::ready);
+}
+
+TEST_F(Test_VAsioConnection, nested_registration_batches_announce_the_subscriptions_at_the_outermost_end)
+{
+    std::vector<VAsioMsgSubscriber> subscribers;
+    auto peer = std::make_unique<MockVAsioPeer>();
+    auto* peerPtr = peer.get();
+    EXPECT_CALL(*peer, Subscribe(_)).Times(1).WillRepeatedly([&subscribers](VAsioMsgSubscriber subscriber) {
+        subscribers.push_back(std::move(subscriber));
+    });
+    AddPeer(std::move(peer));
+
+    MockSilKitMessageReceiver receiverA;
+    receiverA._serviceDescriptor.SetNetworkName("A");
+
+    _connection.BeginRegistrationBatch();
+    _connection.BeginRegistrationBatch();
+    _connection.RegisterSilKitService(&receiverA);
+
+    // the inner batch ends without announcing the subscriptions or waiting
+    auto innerBatchEnded = std::async(std::launch::async, [this] {
+        _connection.EndRegistrationBatch();
+    });
+    ASSERT_EQ(innerBatchEnded.wait_for(5s), std::future_status::ready);
+    RunIoContext();
+    EXPECT_TRUE(subscribers.empty());
+
+    auto outerBatchEnded = std::async(std::launch::async, [this] {
+        _connection.EndRegistrationBatch();
+    });
+    ASSERT_TRUE(RunIoContextUntil([&subscribers] { return subscribers.size() == 1; }));
+
+    _connection.OnSocketData(peerPtr, MakeSubscriptionAcknowledge(subscribers[0]));
+    EXPECT_EQ(outerBatchEnded.wait_for(5s), std::future_status::ready);
+}
+
+TEST_F(Test_VAsioConnection, ending_a_registration_batch_without_beginning_one_throws)
+{
+    EXPECT_THROW(_connection.EndRegistrationBatch(), SilKit::SilKitError);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Sending
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(Test_VAsioConnection, registered_sender_sends_on_its_link)
+{
+    MockSilKitMessageReceiver receiverA;
+    receiverA._serviceDescriptor.SetNetworkName("A");
+    RegisterSilKitMsgReceiver<Tests::TestFrameEvent, MockSilKitMessageReceiver>(&receiverA);
+
+    MockSilKitMessageReceiver receiverB;
+    receiverB._serviceDescriptor.SetNetworkName("B");
+    RegisterSilKitMsgReceiver<Tests::TestFrameEvent, MockSilKitMessageReceiver>(&receiverB);
+
+    SenderEndpoint sender{"A", 2};
+    RegisterSilKitMsgSender<Tests::TestFrameEvent>(&sender);
+
+    EXPECT_CALL(receiverA, ReceiveMsg(&sender, testing::An<const Tests::TestFrameEvent&>())).Times(1);
+    EXPECT_CALL(receiverB, ReceiveMsg(_, testing::An<const Tests::TestFrameEvent&>())).Times(0);
+    SendMsgImpl(&sender, Tests::TestFrameEvent{});
+}
+
+TEST_F(Test_VAsioConnection, sender_registered_on_multiple_links_sends_on_the_link_of_its_network)
+{
+    MockSilKitMessageReceiver receiverA;
+    receiverA._serviceDescriptor.SetNetworkName("A");
+    RegisterSilKitMsgReceiver<Tests::TestFrameEvent, MockSilKitMessageReceiver>(&receiverA);
+
+    MockSilKitMessageReceiver receiverB;
+    receiverB._serviceDescriptor.SetNetworkName("B");
+    RegisterSilKitMsgReceiver<Tests::TestFrameEvent, MockSilKitMessageReceiver>(&receiverB);
+
+    // like a bus simulator, which is registered once per simulated network
+    SenderEndpoint sender{"A", 2};
+    RegisterSilKitMsgSender<Tests::TestFrameEvent>(&sender);
+    sender._serviceDescriptor.SetNetworkName("B");
+    RegisterSilKitMsgSender<Tests::TestFrameEvent>(&sender);
+
+    EXPECT_CALL(receiverA, ReceiveMsg(_, testing::An<const Tests::TestFrameEvent&>())).Times(0);
+    EXPECT_CALL(receiverB, ReceiveMsg(&sender, testing::An<const Tests::TestFrameEvent&>())).Times(1);
+    SendMsgImpl(&sender, Tests::TestFrameEvent{});
+}
+
+TEST_F(Test_VAsioConnection, unregistered_sender_without_link_throws)
+{
+    SenderEndpoint sender{"C", 2};
+    EXPECT_THROW(SendMsgImpl(&sender, Tests::TestFrameEvent{}), SilKit::SilKitError);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Sending queue overflow
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(Test_VAsioConnection, sender_blocks_until_the_overflowing_send_queue_drained)
+{
+    SenderEndpoint sender{"A", 2};
+    MockVAsioPeer peer;
+
+    // the connection is destroyed first, its I/O worker sends the posted message while the sender still exists
+    SilKit::Config::ParticipantConfiguration config;
+    config.middleware.sendQueueOverflowPolicy = SilKit::Config::Middleware::SendQueueOverflowPolicy::Block;
+    VAsioConnection connection{nullptr, config, "Test_VAsioConnection", 1, &_timeProvider};
+    connection.SetLogger(&_dummyLogger);
+    RegisterSilKitMsgSender<Tests::TestFrameEvent>(connection, &sender);
+
+    connection.OnPeerSendQueueOverflow(&peer, true);
+
+    auto sent = std::async(std::launch::async, [&connection, &sender] {
+        connection.SendMsg(&sender, Tests::TestFrameEvent{});
+    });
+    EXPECT_EQ(sent.wait_for(std::chrono::milliseconds{100}), std::future_status::timeout);
+
+    // the peer reports that its sending queue drained to the low watermark
+    connection.OnPeerSendQueueOverflow(&peer, false);
+    EXPECT_EQ(sent.wait_for(std::chrono::seconds{5}), std::future_status::ready);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Send buffering
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(Test_VAsioConnection, service_registered_by_the_simulation_step_is_not_held_back_by_the_send_buffering)
+{
+    EnableSendBuffering();
+
+    std::vector<VAsioMsgSubscriber> subscribers;
+    auto peer = std::make_unique<MockVAsioPeer>();
+    auto* peerPtr = peer.get();
+    EXPECT_CALL(*peer, StartSendBuffering()).Times(1);
+    EXPECT_CALL(*peer, FlushSendBuffer()).Times(1);
+    EXPECT_CALL(*peer, Subscribe(_)).WillOnce([&subscribers](VAsioMsgSubscriber subscriber) {
+        // the subscriptions are written right away, otherwise the registration waits for the end of the step
+        EXPECT_FALSE(BufferedSendScope::IsBuffered());
+        subscribers.push_back(std::move(subscriber));
+    });
+    AddPeer(std::move(peer));
+
+    MockSilKitMessageReceiver receiver;
+    receiver._serviceDescriptor.SetNetworkName("A");
+    SenderEndpoint sender{"A", 2};
+    RegisterSilKitMsgSender<Tests::TestFrameEvent>(&sender);
+
+    EXPECT_CALL(receiver, ReceiveMsg(&sender, testing::An<const Tests::TestFrameEvent&>()))
+        .WillOnce([](const IServiceEndpoint*, const Tests::TestFrameEvent&) {
+            // the simulation data of the step is held back by the peers
+            EXPECT_TRUE(BufferedSendScope::IsBuffered());
+        });
+
+    // like a controller created by the simulation step handler
+    auto stepDone = std::async(std::launch::async, [this, &receiver, &sender] {
+        _connection.StartSendBuffering();
+        _connection.RegisterSilKitService(&receiver);
+        _connection.SendMsg(&sender, Tests::TestFrameEvent{});
+        _connection.FlushSendBuffers();
+    });
+    ASSERT_TRUE(RunIoContextUntil([&subscribers] { return subscribers.size() == 1; }));
+
+    _connection.OnSocketData(peerPtr, MakeSubscriptionAcknowledge(subscribers[0]));
+    ASSERT_EQ(stepDone.wait_for(5s), std::future_status::ready);
+    RunIoContext();
+}
+
+//////////////////////////////////////////////////////////////////////
+// Remote service endpoints
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(Test_VAsioConnection, remote_service_endpoint_is_cached_per_peer_and_endpoint_id)
+{
+    const auto* endpoint = GetRemoteServiceEndpoint(&_from, 5);
+    EXPECT_EQ(endpoint->GetServiceDescriptor().GetServiceId(), 5u);
+    EXPECT_EQ(endpoint->GetServiceDescriptor().GetParticipantId(), _from._serviceDescriptor.GetParticipantId());
+
+    EXPECT_EQ(GetRemoteServiceEndpoint(&_from, 5), endpoint);
+    EXPECT_NE(GetRemoteServiceEndpoint(&_from, 6), endpoint);
+    EXPECT_EQ(GetNumberOfRemoteServiceEndpoints(&_from), 2u);
+}
+
+TEST_F(Test_VAsioConnection, remote_service_endpoints_are_dropped_with_their_peer)
+{
+    GetRemoteServiceEndpoint(&_from, 5);
+    RemovePeerFromConnection(&_from);
+    EXPECT_EQ(GetNumberOfRemoteServiceEndpoints(&_from), 0u);
+}
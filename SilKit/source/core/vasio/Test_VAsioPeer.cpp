@@ -0,0 +1,1050 @@
+// Copyright (c) 2023 Vector Informatik GmbH
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+// LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+// OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "VAsioPeer.hpp"
+#include "VAsioCapabilities.hpp"
+#include "TestDataTraits.hpp"
+
+#include "MockLogger.hpp"
+
+#include "MockIoContext.hpp"
+#include "MockRawByteStream.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+
+namespace {
+
+
+using namespace SilKit::Core;
+
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+
+using SilKit::Services::Logging::MockLogger;
+using VSilKit::MockIoContextWithExecutionQueue;
+using VSilKit::MockRawByteStream;
+
+
+struct MockVAsioPeerListener : IVAsioPeerListener
+{
+    MOCK_METHOD(void, OnSocketData, (IVAsioPeer*, SerializedMessage&&), (override));
+    MOCK_METHOD(void, OnPeerShutdown, (IVAsioPeer*), (override));
+    MOCK_METHOD(void, OnPeerSendQueueOverflow, (IVAsioPeer*, bool), (override));
+};
+
+
+struct Test_VAsioPeer : ::testing::Test
+{
+    MockIoContextWithExecutionQueue ioContext;
+    NiceMock<MockLogger> logger;
+    MockVAsioPeerListener peerListener;
+
+    MockRawByteStream* rawByteStream{nullptr};
+    VSilKit::IRawByteStreamListener* rawByteStreamListener{nullptr};
+
+    //! Sizes of the buffers passed to each AsyncWriteSome call
+    std::vector<std::vector<size_t>> writes;
+    //! Buffer passed to the last AsyncReadSome call
+    VSilKit::MutableBuffer readBuffer;
+    //! Network names of the messages passed to OnSocketData
+    std::vector<std::string> receivedNetworkNames;
+
+    //! Create a peer on a mocked stream. The stream uses the I/O context as its strand, unless another one is given.
+    auto MakePeer(VAsioPeerSettings settings, VSilKit::IStrand* streamStrand = nullptr) -> std::unique_ptr<VAsioPeer>
+    {
+        auto stream{std::make_unique<NiceMock<MockRawByteStream>>()};
+        stream->strand = streamStrand != nullptr ? streamStrand : &ioContext;
+        rawByteStream = stream.get();
+
+        EXPECT_CALL(*stream, SetListener(_)).WillOnce(Invoke([this](VSilKit::IRawByteStreamListener& listener) {
+            rawByteStreamListener = &listener;
+        }));
+        ON_CALL(*stream, AsyncWriteSome(_)).WillByDefault(Invoke([this](VSilKit::ConstBufferSequence bufferSequence) {
+            std::vector<size_t> sizes;
+            for (const auto& buffer : bufferSequence)
+            {
+                sizes.push_back(buffer.GetSize());
+            }
+            writes.emplace_back(std::move(sizes));
+        }));
+        ON_CALL(*stream, AsyncReadSome(_)).WillByDefault(Invoke([this](VSilKit::MutableBufferSequence bufferSequence) {
+            ASSERT_EQ(bufferSequence.size(), 1u);
+            readBuffer = bufferSequence[0];
+        }));
+
+        return std::make_unique<VAsioPeer>(&peerListener, &ioContext, std::move(stream), &logger, settings);
+    }
+
+    static auto MakeMessage(const std::string& networkName) -> SerializedMessage
+    {
+        VAsioMsgSubscriber subscriber;
+        subscriber.receiverIdx = 1;
+        subscriber.networkName = networkName;
+        subscriber.msgTypeName = "SomeMessageType";
+        return SerializedMessage{subscriber};
+    }
+
+    static auto GetMessageSize(const std::string& networkName) -> size_t
+    {
+        return MakeMessage(networkName).ReleaseStorage().size();
+    }
+
+    //! Simulation data, the only messages held back by the send buffering
+    static auto MakeDataMessage(const std::string& str) -> SerializedMessage
+    {
+        Tests::TestFrameEvent msg;
+        msg.str = str;
+        return SerializedMessage{msg, EndpointAddress{1, 2}, EndpointId{3}};
+    }
+
+    static auto GetDataMessageSize(const std::string& str) -> size_t
+    {
+        return MakeDataMessage(str).ReleaseStorage().size();
+    }
+
+    //! Pass the data to the peer in chunks of at most the given size, limited by the size of the read buffer
+    void ReceiveData(const std::vector<uint8_t>& data, size_t chunkSize)
+    {
+        ASSERT_NE(rawByteStreamListener, nullptr);
+
+        size_t offset{0};
+        while (offset < data.size())
+        {
+            const auto size = std::min({chunkSize, data.size() - offset, readBuffer.GetSize()});
+            ASSERT_GT(size, 0u);
+            memcpy(readBuffer.GetData(), data.data() + offset, size);
+            offset += size;
+            rawByteStreamListener->OnAsyncReadSomeDone(*rawByteStream, size);
+        }
+    }
+
+    void ExpectReceivedNetworkNames(const std::vector<std::string>& networkNames)
+    {
+        EXPECT_CALL(peerListener, OnSocketData(_, _))
+            .Times(static_cast<int>(networkNames.size()))
+            .WillRepeatedly(Invoke([this](IVAsioPeer*, SerializedMessage&& message) {
+                receivedNetworkNames.push_back(message.Deserialize<VAsioMsgSubscriber>().networkName);
+            }));
+    }
+
+    void CompleteWrite(size_t bytesTransferred)
+    {
+        ASSERT_NE(rawByteStreamListener, nullptr);
+        rawByteStreamListener->OnAsyncWriteSomeDone(*rawByteStream, bytesTransferred);
+    }
+};
+
+
+TEST_F(Test_VAsioPeer, queued_messages_are_coalesced_into_a_single_write)
+{
+    auto peer{MakePeer(VAsioPeerSettings{})};
+
+    peer->SendSilKitMsg(MakeMessage("A"));
+    peer->SendSilKitMsg(MakeMessage("BB"));
+    peer->SendSilKitMsg(MakeMessage("CCC"));
+    ioContext.Run();
+
+    const std::vector<size_t> expected{GetMessageSize("A"), GetMessageSize("BB"), GetMessageSize("CCC")};
+    ASSERT_EQ(writes.size(), 1u);
+    EXPECT_EQ(writes[0], expected);
+
+    CompleteWrite(expected[0] + expected[1] + expected[2]);
+    EXPECT_EQ(writes.size(), 1u);
+
+    const auto stats{peer->GetSendBatchStatistics()};
+    EXPECT_EQ(stats.numBatches, 1u);
+    EXPECT_EQ(stats.numMessages, 3u);
+    EXPECT_EQ(stats.numBytes, expected[0] + expected[1] + expected[2]);
+    EXPECT_EQ(stats.maxBatchMessages, 3u);
+}
+
+TEST_F(Test_VAsioPeer, traffic_statistics_count_sent_and_received_messages)
+{
+    auto peer{MakePeer(VAsioPeerSettings{})};
+    rawByteStream->roundTripTime = std::chrono::microseconds{42};
+    peer->StartAsyncRead();
+
+    peer->SendSilKitMsg(MakeMessage("A"));
+    peer->SendSilKitMsg(MakeMessage("BB"));
+    ioContext.Run();
+
+    const auto sentBytes = GetMessageSize("A") + GetMessageSize("BB");
+    CompleteWrite(sentBytes);
+
+    const std::vector<std::string> networkNames{"CCC"};
+    const auto data{MakeMessage("CCC").ReleaseStorage()};
+    ExpectReceivedNetworkNames(networkNames);
+    ReceiveData(data, data.size());
+
+    const auto stats{peer->GetTrafficStatistics()};
+    EXPECT_EQ(stats.numSentMessages, 2u);
+    EXPECT_EQ(stats.numSentBytes, sentBytes);
+    EXPECT_EQ(stats.numReceivedMessages, 1u);
+    EXPECT_EQ(stats.numReceivedBytes, data.size());
+    EXPECT_EQ(stats.roundTripTime, std::chrono::microseconds{42});
+}
+
+TEST_F(Test_VAsioPeer, batch_respects_buffer_limit)
+{
+    VAsioPeerSettings settings;
+    settings.sendBatchMaxBuffers = 2;
+    auto peer{MakePeer(settings)};
+
+    peer->SendSilKitMsg(MakeMessage("A"));
+    peer->SendSilKitMsg(MakeMessage("B"));
+    peer->SendSilKitMsg(MakeMessage("C"));
+    ioContext.Run();
+
+    const auto size{GetMessageSize("A")};
+    ASSERT_EQ(writes.size(), 1u);
+    EXPECT_EQ(writes[0], (std::vector<size_t>{size, size}));
+
+    CompleteWrite(2 * size);
+    ASSERT_EQ(writes.size(), 2u);
+    EXPECT_EQ(writes[1], (std::vector<size_t>{size}));
+
+    const auto stats{peer->GetSendBatchStatistics()};
+    EXPECT_EQ(stats.numBatches, 2u);
+    EXPECT_EQ(stats.numMessages, 3u);
+    EXPECT_EQ(stats.maxBatchMessages, 2u);
+}
+
+TEST_F(Test_VAsioPeer, batch_respects_byte_limit_but_always_sends_one_message)
+{
+    const auto size{GetMessageSize("A")};
+
+    VAsioPeerSettings settings;
+    settings.sendBatchMaxBytes = size - 1;
+    auto peer{MakePeer(settings)};
+
+    peer->SendSilKitMsg(MakeMessage("A"));
+    peer->SendSilKitMsg(MakeMessage("B"));
+    ioContext.Run();
+
+    ASSERT_EQ(writes.size(), 1u);
+    EXPECT_EQ(writes[0], (std::vector<size_t>{size}));
+
+    CompleteWrite(size);
+    ASSERT_EQ(writes.size(), 2u);
+    EXPECT_EQ(writes[1], (std::vector<size_t>{size}));
+}
+
+TEST_F(Test_VAsioPeer, partial_write_continues_with_remaining_bytes)
+{
+    auto peer{MakePeer(VAsioPeerSettings{})};
+
+    peer->SendSilKitMsg(MakeMessage("A"));
+    peer->SendSilKitMsg(MakeMessage("B"));
+    ioContext.Run();
+
+    const auto size{GetMessageSize("A")};
+    ASSERT_EQ(writes.size(), 1u);
+
+    CompleteWrite(size + 3);
+    ASSERT_EQ(writes.size(), 2u);
+    EXPECT_EQ(writes[1], (std::vector<size_t>{size - 3}));
+
+    CompleteWrite(size - 3);
+    EXPECT_EQ(writes.size(), 2u);
+}
+
+TEST_F(Test_VAsioPeer, buffered_messages_are_written_on_flush)
+{
+    auto peer{MakePeer(VAsioPeerSettings{})};
+
+    peer->StartSendBuffering();
+    {
+        BufferedSendScope bufferedSend{true};
+        peer->SendSilKitMsg(MakeDataMessage("A"));
+        peer->SendSilKitMsg(MakeDataMessage("B"));
+    }
+    ioContext.Run();
+
+    EXPECT_TRUE(writes.empty());
+
+    peer->FlushSendBuffer();
+    ioContext.Run();
+
+    const auto size{GetDataMessageSize("A")};
+    ASSERT_EQ(writes.size(), 1u);
+    EXPECT_EQ(writes[0], (std::vector<size_t>{size, size}));
+
+    CompleteWrite(2 * size);
+
+    // after the flush, messages are written immediately again
+    {
+        BufferedSendScope bufferedSend{true};
+        peer->SendSilKitMsg(MakeDataMessage("C"));
+    }
+    ioContext.Run();
+    ASSERT_EQ(writes.size(), 2u);
+    EXPECT_EQ(writes[1], (std::vector<size_t>{size}));
+}
+
+TEST_F(Test_VAsioPeer, flush_without_buffered_messages_does_not_write)
+{
+    auto peer{MakePeer(VAsioPeerSettings{})};
+
+    peer->StartSendBuffering();
+    peer->FlushSendBuffer();
+    ioContext.Run();
+
+    EXPECT_TRUE(writes.empty());
+}
+
+TEST_F(Test_VAsioPeer, control_messages_are_written_while_buffering)
+{
+    auto peer{MakePeer(VAsioPeerSettings{})};
+
+    // e.g., a controller created by the step handler waits for the acknowledges of its subscriptions
+    peer->StartSendBuffering();
+    {
+        BufferedSendScope bufferedSend{true};
+        peer->SendSilKitMsg(MakeDataMessage("A"));
+        peer->SendSilKitMsg(MakeMessage("B"));
+    }
+    ioContext.Run();
+
+    // the subscription is written together with the data queued before it, keeping the order
+    ASSERT_EQ(writes.size(), 1u);
+    EXPECT_EQ(writes[0], (std::vector<size_t>{GetDataMessageSize("A"), GetMessageSize("B")}));
+}
+
+TEST_F(Test_VAsioPeer, messages_outside_of_the_simulation_step_are_not_buffered)
+{
+    auto peer{MakePeer(VAsioPeerSettings{})};
+
+    peer->StartSendBuffering();
+    peer->SendSilKitMsg(MakeDataMessage("A"));
+    ioContext.Run();
+
+    ASSERT_EQ(writes.size(), 1u);
+    EXPECT_EQ(writes[0], (std::vector<size_t>{GetDataMessageSize("A")}));
+}
+
+TEST_F(Test_VAsioPeer, send_queue_error_policy_discards_new_messages)
+{
+    VAsioPeerSettings settings;
+    settings.sendQueueMaxMessages = 2;
+    settings.sendQueueOverflowPolicy = SilKit::Config::Middleware::SendQueueOverflowPolicy::Error;
+    auto peer{MakePeer(settings)};
+
+    ::testing::InSequence sequence;
+    EXPECT_CALL(peerListener, OnPeerSendQueueOverflow(peer.get(), true)).Times(1);
+    EXPECT_CALL(peerListener, OnPeerSendQueueOverflow(peer.get(), false)).Times(1);
+
+    // the following messages queue up behind the write in progress
+    peer->SendSilKitMsg(MakeDataMessage("X"));
+    ioContext.Run();
+
+    peer->SendSilKitMsg(MakeDataMessage("A"));
+    peer->SendSilKitMsg(MakeDataMessage("BB"));
+    peer->SendSilKitMsg(MakeDataMessage("CCC"));
+    ioContext.Run();
+
+    EXPECT_TRUE(peer->IsSendQueueOverflowing());
+
+    CompleteWrite(GetDataMessageSize("X"));
+
+    ASSERT_EQ(writes.size(), 2u);
+    EXPECT_EQ(writes[1], (std::vector<size_t>{GetDataMessageSize("A"), GetDataMessageSize("BB")}));
+    EXPECT_FALSE(peer->IsSendQueueOverflowing());
+
+    const auto stats{peer->GetSendQueueStatistics()};
+    EXPECT_EQ(stats.queuedMessages, 0u);
+    EXPECT_EQ(stats.queuedBytes, 0u);
+    EXPECT_EQ(stats.maxQueuedMessages, 2u);
+    EXPECT_EQ(stats.numDroppedMessages, 1u);
+    EXPECT_EQ(stats.numOverflows, 1u);
+}
+
+TEST_F(Test_VAsioPeer, send_queue_drop_oldest_policy_discards_the_oldest_messages)
+{
+    VAsioPeerSettings settings;
+    settings.sendQueueMaxMessages = 2;
+    settings.sendQueueOverflowPolicy = SilKit::Config::Middleware::SendQueueOverflowPolicy::DropOldest;
+    auto peer{MakePeer(settings)};
+
+    EXPECT_CALL(peerListener, OnPeerSendQueueOverflow(peer.get(), _)).Times(2);
+
+    peer->SendSilKitMsg(MakeDataMessage("X"));
+    ioContext.Run();
+
+    peer->SendSilKitMsg(MakeDataMessage("A"));
+    peer->SendSilKitMsg(MakeDataMessage("BB"));
+    peer->SendSilKitMsg(MakeDataMessage("CCC"));
+    ioContext.Run();
+
+    CompleteWrite(GetDataMessageSize("X"));
+
+    ASSERT_EQ(writes.size(), 2u);
+    EXPECT_EQ(writes[1], (std::vector<size_t>{GetDataMessageSize("BB"), GetDataMessageSize("CCC")}));
+
+    const auto stats{peer->GetSendQueueStatistics()};
+    EXPECT_EQ(stats.numDroppedMessages, 1u);
+    EXPECT_EQ(stats.numOverflows, 1u);
+}
+
+TEST_F(Test_VAsioPeer, send_queue_error_policy_keeps_control_messages)
+{
+    VAsioPeerSettings settings;
+    settings.sendQueueMaxMessages = 1;
+    settings.sendQueueOverflowPolicy = SilKit::Config::Middleware::SendQueueOverflowPolicy::Error;
+    auto peer{MakePeer(settings)};
+
+    EXPECT_CALL(peerListener, OnPeerSendQueueOverflow(peer.get(), _)).Times(2);
+
+    peer->SendSilKitMsg(MakeDataMessage("X"));
+    ioContext.Run();
+
+    peer->SendSilKitMsg(MakeDataMessage("A"));
+    peer->SendSilKitMsg(MakeMessage("B"));
+    peer->SendSilKitMsg(MakeDataMessage("C"));
+    ioContext.Run();
+
+    CompleteWrite(GetDataMessageSize("X"));
+
+    ASSERT_EQ(writes.size(), 2u);
+    EXPECT_EQ(writes[1], (std::vector<size_t>{GetDataMessageSize("A"), GetMessageSize("B")}));
+    EXPECT_EQ(peer->GetSendQueueStatistics().numDroppedMessages, 1u);
+}
+
+TEST_F(Test_VAsioPeer, send_queue_drop_oldest_policy_keeps_control_messages)
+{
+    VAsioPeerSettings settings;
+    settings.sendQueueMaxMessages = 2;
+    settings.sendQueueOverflowPolicy = SilKit::Config::Middleware::SendQueueOverflowPolicy::DropOldest;
+    auto peer{MakePeer(settings)};
+
+    EXPECT_CALL(peerListener, OnPeerSendQueueOverflow(peer.get(), _)).Times(2);
+
+    peer->SendSilKitMsg(MakeDataMessage("X"));
+    ioContext.Run();
+
+    peer->SendSilKitMsg(MakeMessage("A"));
+    peer->SendSilKitMsg(MakeDataMessage("BB"));
+    peer->SendSilKitMsg(MakeDataMessage("CCC"));
+    peer->SendSilKitMsg(MakeDataMessage("DDDD"));
+    ioContext.Run();
+
+    CompleteWrite(GetDataMessageSize("X"));
+
+    // the oldest data messages are dropped, the older subscription is kept in its place
+    ASSERT_EQ(writes.size(), 2u);
+    EXPECT_EQ(writes[1], (std::vector<size_t>{GetMessageSize("A"), GetDataMessageSize("DDDD")}));
+
+    const auto stats{peer->GetSendQueueStatistics()};
+    EXPECT_EQ(stats.queuedMessages, 0u);
+    EXPECT_EQ(stats.queuedBytes, 0u);
+    EXPECT_EQ(stats.numDroppedMessages, 2u);
+}
+
+TEST_F(Test_VAsioPeer, send_queue_block_policy_keeps_all_messages_and_notifies_the_listener)
+{
+    const auto size{GetDataMessageSize("A")};
+
+    VAsioPeerSettings settings;
+    settings.sendQueueMaxBytes = 2 * size;
+    auto peer{MakePeer(settings)};
+
+    ::testing::InSequence sequence;
+    EXPECT_CALL(peerListener, OnPeerSendQueueOverflow(peer.get(), true)).Times(1);
+    EXPECT_CALL(peerListener, OnPeerSendQueueOverflow(peer.get(), false)).Times(1);
+
+    peer->SendSilKitMsg(MakeDataMessage("X"));
+    ioContext.Run();
+
+    peer->SendSilKitMsg(MakeDataMessage("A"));
+    peer->SendSilKitMsg(MakeDataMessage("B"));
+    peer->SendSilKitMsg(MakeDataMessage("C"));
+    ioContext.Run();
+
+    const auto queueStats{peer->GetSendQueueStatistics()};
+    EXPECT_EQ(queueStats.queuedMessages, 3u);
+    EXPECT_EQ(queueStats.queuedBytes, 3 * size);
+
+    CompleteWrite(size);
+
+    ASSERT_EQ(writes.size(), 2u);
+    EXPECT_EQ(writes[1], (std::vector<size_t>{size, size, size}));
+    EXPECT_EQ(peer->GetSendQueueStatistics().numDroppedMessages, 0u);
+}
+
+TEST_F(Test_VAsioPeer, send_queue_overflow_ends_the_send_buffering)
+{
+    const auto size{GetDataMessageSize("A")};
+
+    VAsioPeerSettings settings;
+    settings.sendQueueMaxMessages = 2;
+    auto peer{MakePeer(settings)};
+
+    ::testing::InSequence sequence;
+    EXPECT_CALL(peerListener, OnPeerSendQueueOverflow(peer.get(), true)).Times(1);
+    EXPECT_CALL(peerListener, OnPeerSendQueueOverflow(peer.get(), false)).Times(1);
+
+    // a sender blocked by the overflow must not wait for the end of the step, the queue drains without a flush
+    peer->StartSendBuffering();
+    {
+        BufferedSendScope bufferedSend{true};
+        peer->SendSilKitMsg(MakeDataMessage("A"));
+        peer->SendSilKitMsg(MakeDataMessage("B"));
+        ioContext.Run();
+        EXPECT_TRUE(writes.empty());
+
+        peer->SendSilKitMsg(MakeDataMessage("C"));
+        ioContext.Run();
+    }
+
+    ASSERT_EQ(writes.size(), 1u);
+    EXPECT_EQ(writes[0], (std::vector<size_t>{size, size, size}));
+    EXPECT_FALSE(peer->IsSendQueueOverflowing());
+    EXPECT_EQ(peer->GetSendQueueStatistics().numDroppedMessages, 0u);
+
+    // the following messages of the step are written right away
+    CompleteWrite(3 * size);
+    {
+        BufferedSendScope bufferedSend{true};
+        peer->SendSilKitMsg(MakeDataMessage("D"));
+    }
+    ioContext.Run();
+    ASSERT_EQ(writes.size(), 2u);
+}
+
+TEST_F(Test_VAsioPeer, receive_multiple_messages_in_a_single_read)
+{
+    auto peer{MakePeer(VAsioPeerSettings{})};
+    peer->StartAsyncRead();
+    ioContext.Run();
+
+    const std::vector<std::string> networkNames{"A", "BB", "CCC", "DDDD"};
+    std::vector<uint8_t> data;
+    for (const auto& networkName : networkNames)
+    {
+        const auto blob{MakeMessage(networkName).ReleaseStorage()};
+        data.insert(data.end(), blob.begin(), blob.end());
+    }
+
+    ExpectReceivedNetworkNames(networkNames);
+    ReceiveData(data, data.size());
+    EXPECT_EQ(receivedNetworkNames, networkNames);
+}
+
+TEST_F(Test_VAsioPeer, receive_messages_split_across_reads)
+{
+    auto peer{MakePeer(VAsioPeerSettings{})};
+    peer->StartAsyncRead();
+    ioContext.Run();
+
+    std::vector<std::string> networkNames;
+    std::vector<uint8_t> data;
+    for (size_t index = 0; index != 100; ++index)
+    {
+        networkNames.emplace_back(index % 10 == 0 ? std::string(10000, 'L') : std::to_string(index));
+        const auto blob{MakeMessage(networkNames.back()).ReleaseStorage()};
+        data.insert(data.end(), blob.begin(), blob.end());
+    }
+
+    ExpectReceivedNetworkNames(networkNames);
+    ReceiveData(data, 7);
+    EXPECT_EQ(receivedNetworkNames, networkNames);
+}
+
+TEST_F(Test_VAsioPeer, receive_large_message)
+{
+    auto peer{MakePeer(VAsioPeerSettings{})};
+    peer->StartAsyncRead();
+    ioContext.Run();
+
+    const std::vector<std::string> networkNames{std::string(100000, 'L'), "S", std::string(50000, 'M')};
+    std::vector<uint8_t> data;
+    for (const auto& networkName : networkNames)
+    {
+        const auto blob{MakeMessage(networkName).ReleaseStorage()};
+        data.insert(data.end(), blob.begin(), blob.end());
+    }
+
+    ExpectReceivedNetworkNames(networkNames);
+    ReceiveData(data, data.size());
+    EXPECT_EQ(receivedNetworkNames, networkNames);
+}
+
+TEST_F(Test_VAsioPeer, invalid_compressed_message_shuts_the_connection_down)
+{
+    auto peer{MakePeer(VAsioPeerSettings{})};
+    peer->StartAsyncRead();
+    ioContext.Run();
+
+    // header of a compressed message (size, kind, decompressed size) followed by garbage
+    std::vector<uint8_t> data(64, 0xEE);
+    const uint32_t size{static_cast<uint32_t>(data.size())};
+    const uint32_t decompressedSize{1000};
+    memcpy(data.data(), &size, sizeof size);
+    data[sizeof size] = static_cast<uint8_t>(VAsioMsgKind::SilKitCompressedMessage);
+    memcpy(data.data() + sizeof size + 1, &decompressedSize, sizeof decompressedSize);
+
+    EXPECT_CALL(peerListener, OnSocketData(_, _)).Times(0);
+    EXPECT_CALL(*rawByteStream, Shutdown()).Times(1);
+    ReceiveData(data, data.size());
+    ioContext.Run();
+}
+
+TEST_F(Test_VAsioPeer, multi_threaded_io_delivers_messages_on_the_main_strand)
+{
+    // the stream has its own strand, the peer must hand the received messages over to the I/O context
+    MockIoContextWithExecutionQueue streamStrand;
+
+    VAsioPeerSettings settings;
+    settings.multiThreadedIo = true;
+    auto peer{MakePeer(settings, &streamStrand)};
+
+    peer->StartAsyncRead();
+    streamStrand.Run();
+
+    const std::vector<std::string> networkNames{"A", "BB", "CCC"};
+    std::vector<uint8_t> data;
+    for (const auto& networkName : networkNames)
+    {
+        const auto blob{MakeMessage(networkName).ReleaseStorage()};
+        data.insert(data.end(), blob.begin(), blob.end());
+    }
+
+    ExpectReceivedNetworkNames(networkNames);
+    ReceiveData(data, 5);
+    EXPECT_TRUE(receivedNetworkNames.empty());
+
+    bool shutdown{false};
+    EXPECT_CALL(peerListener, OnPeerShutdown(peer.get())).WillOnce(Invoke([this, &shutdown](IVAsioPeer*) {
+        // all messages were delivered before the shutdown
+        EXPECT_EQ(receivedNetworkNames.size(), 3u);
+        shutdown = true;
+    }));
+    rawByteStreamListener->OnShutdown(*rawByteStream);
+    EXPECT_FALSE(shutdown);
+
+    ioContext.Run();
+    EXPECT_EQ(receivedNetworkNames, networkNames);
+    EXPECT_TRUE(shutdown);
+}
+
+
+//! In-memory local-domain socket, connected to another instance. All completions are posted to the strand.
+struct LoopbackRawByteStream : VSilKit::IRawByteStream
+{
+    LoopbackRawByteStream* remote{nullptr};
+    VSilKit::IRawByteStreamListener* listener{nullptr};
+    VSilKit::IStrand* strand{nullptr};
+
+    std::deque<uint8_t> received;
+    VSilKit::MutableBuffer readBuffer;
+    bool reading{false};
+    bool readPosted{false};
+    bool remoteClosed{false};
+    bool closed{false};
+
+    //! Total number of bytes written into this stream
+    size_t bytesWritten{0};
+
+    void SetListener(VSilKit::IRawByteStreamListener& streamListener) override
+    {
+        listener = &streamListener;
+    }
+
+    auto GetLocalEndpoint() const -> std::string override
+    {
+        return "local:///tmp/loopback";
+    }
+
+    auto GetRemoteEndpoint() const -> std::string override
+    {
+        return "local:///tmp/loopback";
+    }
+
+    auto GetStrand() -> VSilKit::IStrand& override
+    {
+        return *strand;
+    }
+
+    void AsyncReadSome(VSilKit::MutableBufferSequence bufferSequence) override
+    {
+        if (closed)
+        {
+            return;
+        }
+
+        readBuffer = bufferSequence[0];
+        reading = true;
+        PostReadIfPossible();
+    }
+
+    void AsyncWriteSome(VSilKit::ConstBufferSequence bufferSequence) override
+    {
+        if (closed)
+        {
+            return;
+        }
+
+        size_t size{0};
+        for (const auto& buffer : bufferSequence)
+        {
+            const auto* data = static_cast<const uint8_t*>(buffer.GetData());
+            remote->received.insert(remote->received.end(), data, data + buffer.GetSize());
+            size += buffer.GetSize();
+        }
+        bytesWritten += size;
+
+        remote->PostReadIfPossible();
+        strand->Post([this, size] {
+            listener->OnAsyncWriteSomeDone(*this, size);
+        });
+    }
+
+    void Shutdown() override
+    {
+        if (closed)
+        {
+            return;
+        }
+
+        closed = true;
+        reading = false;
+        strand->Post([this] {
+            listener->OnShutdown(*this);
+        });
+
+        remote->remoteClosed = true;
+        remote->PostReadIfPossible();
+    }
+
+    auto GetRoundTripTime() const -> std::chrono::microseconds override
+    {
+        return std::chrono::microseconds{0};
+    }
+
+    void PostReadIfPossible()
+    {
+        if (!reading || readPosted || (received.empty() && !remoteClosed))
+        {
+            return;
+        }
+
+        readPosted = true;
+        strand->Post([this] {
+            readPosted = false;
+            if (!reading)
+            {
+                return;
+            }
+
+            if (received.empty())
+            {
+                // end of stream
+                Shutdown();
+                return;
+            }
+
+            const auto size = std::min(readBuffer.GetSize(), received.size());
+            std::copy_n(received.begin(), size, static_cast<uint8_t*>(readBuffer.GetData()));
+            received.erase(received.begin(), received.begin() + static_cast<std::ptrdiff_t>(size));
+
+            reading = false;
+            listener->OnAsyncReadSomeDone(*this, size);
+        });
+    }
+};
+
+
+struct Test_VAsioPeerSharedMemory : ::testing::Test
+{
+    MockIoContextWithExecutionQueue ioContext;
+    NiceMock<MockLogger> logger;
+
+    struct Side
+    {
+        MockVAsioPeerListener listener;
+        LoopbackRawByteStream* stream{nullptr};
+        std::unique_ptr<VAsioPeer> peer;
+        std::vector<std::string> receivedNetworkNames;
+        bool shutdown{false};
+    };
+
+    Side connector;
+    Side acceptor;
+
+    void MakePeers(bool connectorEnablesSharedMemory, bool acceptorEnablesSharedMemory)
+    {
+        auto connectorStream{std::make_unique<LoopbackRawByteStream>()};
+        auto acceptorStream{std::make_unique<LoopbackRawByteStream>()};
+        connectorStream->strand = &ioContext;
+        connectorStream->remote = acceptorStream.get();
+        acceptorStream->strand = &ioContext;
+        acceptorStream->remote = connectorStream.get();
+
+        connector.stream = connectorStream.get();
+        acceptor.stream = acceptorStream.get();
+
+        MakePeer(connector, std::move(connectorStream), connectorEnablesSharedMemory);
+        MakePeer(acceptor, std::move(acceptorStream), acceptorEnablesSharedMemory);
+    }
+
+    void MakePeer(Side& side, std::unique_ptr<LoopbackRawByteStream> stream, bool enableSharedMemory)
+    {
+        VAsioPeerSettings settings;
+        settings.enableSharedMemory = enableSharedMemory;
+        // small ring buffers, such that large messages must wait for the remote side
+        settings.sharedMemoryRingBufferCapacity = 4096;
+
+        ON_CALL(side.listener, OnSocketData(_, _))
+            .WillByDefault(Invoke([&side](IVAsioPeer*, SerializedMessage&& message) {
+                side.receivedNetworkNames.push_back(message.Deserialize<VAsioMsgSubscriber>().networkName);
+            }));
+        ON_CALL(side.listener, OnPeerShutdown(_)).WillByDefault(Invoke([&side](IVAsioPeer*) {
+            side.shutdown = true;
+        }));
+
+        side.peer = std::make_unique<VAsioPeer>(&side.listener, &ioContext, std::move(stream), &logger, settings);
+
+        // both sides announce the capability, the connector might still have shared memory disabled locally
+        VAsioCapabilities capabilities;
+        capabilities.AddCapability(Capabilities::SharedMemory);
+        VAsioPeerInfo info;
+        info.capabilities = capabilities.ToCapabilitiesString();
+        side.peer->SetInfo(info);
+
+        side.peer->StartAsyncRead();
+    }
+
+    static auto MakeNetworkNames(const std::string& prefix, size_t count) -> std::vector<std::string>
+    {
+        std::vector<std::string> networkNames;
+        for (size_t index = 0; index != count; ++index)
+        {
+            // every tenth message does not fit into the ring buffer
+            networkNames.emplace_back(index % 10 == 5 ? std::string(10000, 'L') : prefix + std::to_string(index));
+        }
+        return networkNames;
+    }
+
+    static void Send(VAsioPeer& peer, const std::vector<std::string>& networkNames)
+    {
+        for (const auto& networkName : networkNames)
+        {
+            VAsioMsgSubscriber subscriber;
+            subscriber.receiverIdx = 1;
+            subscriber.networkName = networkName;
+            subscriber.msgTypeName = "SomeMessageType";
+            peer.SendSilKitMsg(SerializedMessage{subscriber});
+        }
+    }
+};
+
+
+TEST_F(Test_VAsioPeerSharedMemory, upgrade_moves_traffic_into_shared_memory)
+{
+    MakePeers(true, true);
+    EXPECT_CALL(connector.listener, OnSocketData(_, _)).Times(::testing::AnyNumber());
+    EXPECT_CALL(acceptor.listener, OnSocketData(_, _)).Times(::testing::AnyNumber());
+
+    const auto toAcceptorBefore{MakeNetworkNames("before", 20)};
+    const auto toConnectorBefore{MakeNetworkNames("before", 20)};
+
+    // messages sent while switching over must arrive in order
+    acceptor.peer->StartSharedMemoryUpgrade();
+    Send(*connector.peer, toAcceptorBefore);
+    Send(*acceptor.peer, toConnectorBefore);
+    ioContext.Run();
+
+    ASSERT_TRUE(connector.peer->IsUsingSharedMemory());
+    ASSERT_TRUE(acceptor.peer->IsUsingSharedMemory());
+    EXPECT_EQ(acceptor.receivedNetworkNames, toAcceptorBefore);
+    EXPECT_EQ(connector.receivedNetworkNames, toConnectorBefore);
+
+    const auto connectorBytesWritten{connector.stream->bytesWritten};
+    const auto acceptorBytesWritten{acceptor.stream->bytesWritten};
+
+    const auto toAcceptor{MakeNetworkNames("after", 200)};
+    const auto toConnector{MakeNetworkNames("after", 200)};
+    Send(*connector.peer, toAcceptor);
+    Send(*acceptor.peer, toConnector);
+    ioContext.Run();
+
+    auto expectedToAcceptor{toAcceptorBefore};
+    expectedToAcceptor.insert(expectedToAcceptor.end(), toAcceptor.begin(), toAcceptor.end());
+    auto expectedToConnector{toConnectorBefore};
+    expectedToConnector.insert(expectedToConnector.end(), toConnector.begin(), toConnector.end());
+    EXPECT_EQ(acceptor.receivedNetworkNames, expectedToAcceptor);
+    EXPECT_EQ(connector.receivedNetworkNames, expectedToConnector);
+
+    // the sockets only carried (single-byte) doorbells
+    EXPECT_LT(connector.stream->bytesWritten - connectorBytesWritten, toAcceptor.size());
+    EXPECT_LT(acceptor.stream->bytesWritten - acceptorBytesWritten, toConnector.size());
+}
+
+TEST_F(Test_VAsioPeerSharedMemory, rejected_upgrade_keeps_using_the_socket)
+{
+    MakePeers(false, true);
+    EXPECT_CALL(connector.listener, OnSocketData(_, _)).Times(::testing::AnyNumber());
+    EXPECT_CALL(acceptor.listener, OnSocketData(_, _)).Times(::testing::AnyNumber());
+
+    acceptor.peer->StartSharedMemoryUpgrade();
+    ioContext.Run();
+
+    const auto networkNames{MakeNetworkNames("name", 20)};
+    Send(*connector.peer, networkNames);
+    Send(*acceptor.peer, networkNames);
+    ioContext.Run();
+
+    EXPECT_FALSE(connector.peer->IsUsingSharedMemory());
+    EXPECT_FALSE(acceptor.peer->IsUsingSharedMemory());
+    EXPECT_EQ(acceptor.receivedNetworkNames, networkNames);
+    EXPECT_EQ(connector.receivedNetworkNames, networkNames);
+}
+
+TEST_F(Test_VAsioPeerSharedMemory, data_in_shared_memory_is_delivered_before_shutdown)
+{
+    MakePeers(true, true);
+    EXPECT_CALL(acceptor.listener, OnSocketData(_, _)).Times(::testing::AnyNumber());
+
+    acceptor.peer->StartSharedMemoryUpgrade();
+    ioContext.Run();
+    ASSERT_TRUE(connector.peer->IsUsingSharedMemory());
+
+    EXPECT_CALL(connector.listener, OnPeerShutdown(connector.peer.get())).Times(1);
+    EXPECT_CALL(acceptor.listener, OnPeerShutdown(acceptor.peer.get())).Times(1);
+
+    const auto networkNames{MakeNetworkNames("name", 50)};
+    Send(*connector.peer, networkNames);
+    connector.peer->Shutdown();
+    ioContext.Run();
+
+    EXPECT_EQ(acceptor.receivedNetworkNames, networkNames);
+    EXPECT_TRUE(acceptor.shutdown);
+    EXPECT_TRUE(connector.shutdown);
+}
+
+
+struct Test_VAsioPeerCompression : ::testing::Test
+{
+    MockIoContextWithExecutionQueue ioContext;
+    NiceMock<MockLogger> logger;
+
+    NiceMock<MockVAsioPeerListener> senderListener;
+    NiceMock<MockVAsioPeerListener> receiverListener;
+    LoopbackRawByteStream* senderStream{nullptr};
+    std::unique_ptr<VAsioPeer> sender;
+    std::unique_ptr<VAsioPeer> receiver;
+    std::vector<std::string> receivedNetworkNames;
+
+    void MakePeers(size_t compressionThreshold, bool receiverSupportsCompression)
+    {
+        auto senderStreamPtr{std::make_unique<LoopbackRawByteStream>()};
+        auto receiverStreamPtr{std::make_unique<LoopbackRawByteStream>()};
+        senderStreamPtr->strand = &ioContext;
+        senderStreamPtr->remote = receiverStreamPtr.get();
+        receiverStreamPtr->strand = &ioContext;
+        receiverStreamPtr->remote = senderStreamPtr.get();
+        senderStream = senderStreamPtr.get();
+
+        ON_CALL(receiverListener, OnSocketData(_, _))
+            .WillByDefault(Invoke([this](IVAsioPeer*, SerializedMessage&& message) {
+                receivedNetworkNames.push_back(message.Deserialize<VAsioMsgSubscriber>().networkName);
+            }));
+
+        VAsioPeerSettings settings;
+        settings.compressionThreshold = compressionThreshold;
+        sender = std::make_unique<VAsioPeer>(&senderListener, &ioContext, std::move(senderStreamPtr), &logger,
+                                             settings);
+        receiver = std::make_unique<VAsioPeer>(&receiverListener, &ioContext, std::move(receiverStreamPtr), &logger,
+                                               VAsioPeerSettings{});
+
+        VAsioCapabilities capabilities;
+        if (receiverSupportsCompression)
+        {
+            capabilities.AddCapability(Capabilities::PayloadCompression);
+        }
+        VAsioPeerInfo receiverInfo;
+        receiverInfo.capabilities = capabilities.ToCapabilitiesString();
+        sender->SetInfo(receiverInfo);
+
+        sender->StartAsyncRead();
+        receiver->StartAsyncRead();
+        ioContext.Run();
+    }
+
+    void Send(const std::vector<std::string>& networkNames)
+    {
+        for (const auto& networkName : networkNames)
+        {
+            VAsioMsgSubscriber subscriber;
+            subscriber.receiverIdx = 1;
+            subscriber.networkName = networkName;
+            subscriber.msgTypeName = "SomeMessageType";
+            sender->SendSilKitMsg(SerializedMessage{subscriber});
+        }
+        ioContext.Run();
+    }
+};
+
+TEST_F(Test_VAsioPeerCompression, large_messages_are_compressed_if_the_remote_peer_supports_it)
+{
+    MakePeers(1000, true);
+
+    const std::vector<std::string> networkNames{"A", std::string(100000, 'L'), "B", std::string(50000, 'M')};
+    Send(networkNames);
+
+    EXPECT_EQ(receivedNetworkNames, networkNames);
+    EXPECT_LT(senderStream->bytesWritten, 10000u);
+    EXPECT_EQ(sender->GetSendBatchStatistics().numCompressedMessages, 2u);
+}
+
+TEST_F(Test_VAsioPeerCompression, messages_are_not_compressed_without_the_capability)
+{
+    MakePeers(1000, false);
+
+    const std::vector<std::string> networkNames{"A", std::string(100000, 'L')};
+    Send(networkNames);
+
+    EXPECT_EQ(receivedNetworkNames, networkNames);
+    EXPECT_GT(senderStream->bytesWritten, 100000u);
+    EXPECT_EQ(sender->GetSendBatchStatistics().numCompressedMessages, 0u);
+}
+
+TEST_F(Test_VAsioPeerCompression, messages_below_the_threshold_are_not_compressed)
+{
+    MakePeers(200000, true);
+
+    const std::vector<std::string> networkNames{std::string(100000, 'L')};
+    Send(networkNames);
+
+    EXPECT_EQ(receivedNetworkNames, networkNames);
+    EXPECT_EQ(sender->GetSendBatchStatistics().numCompressedMessages, 0u);
+}
+
+
+} // anonymous namespace
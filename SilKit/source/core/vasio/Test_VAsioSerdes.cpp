@@ -50,6 +50,11 @@ bool operator==(const KnownParticipants& lhs, const KnownParticipants& rhs)
     return lhs.messageHeader == rhs.messageHeader && lhs.peerInfos == rhs.peerInfos;
 }
 
+bool operator==(const SharedMemoryUpgrade& lhs, const SharedMemoryUpgrade& rhs)
+{
+    return lhs.messageHeader == rhs.messageHeader && lhs.status == rhs.status && lhs.segmentName == rhs.segmentName;
+}
+
 } // namespace Core
 } // namespace SilKit
 
@@ -105,6 +110,38 @@ TEST(Test_VAsioSerdes, vasio_VasioMsgSubscribers)
 
     EXPECT_EQ(in, out);
 }
+
+TEST(Test_VAsioSerdes, vasio_subscriptionBatches)
+{
+    MessageBuffer buffer;
+    SubscriptionAnnouncementBatch inAnnouncement{}, outAnnouncement{};
+    SubscriptionAcknowledgeBatch inAcknowledge{}, outAcknowledge{};
+
+    for (auto i = 0; i < 10; i++)
+    {
+        inAnnouncement.subscribers.push_back(MakeSubscriber());
+        inAnnouncement.subscribers.back().receiverIdx = i;
+
+        SubscriptionAcknowledge ack;
+        ack.status = (i % 2 == 0) ? SubscriptionAcknowledge::Status::Success : SubscriptionAcknowledge::Status::Failed;
+        ack.subscriber = inAnnouncement.subscribers.back();
+        inAcknowledge.acknowledges.push_back(ack);
+    }
+
+    Serialize(buffer, inAnnouncement);
+    Serialize(buffer, inAcknowledge);
+    Deserialize(buffer, outAnnouncement);
+    Deserialize(buffer, outAcknowledge);
+
+    EXPECT_EQ(inAnnouncement.subscribers, outAnnouncement.subscribers);
+    ASSERT_EQ(inAcknowledge.acknowledges.size(), outAcknowledge.acknowledges.size());
+    for (size_t i = 0; i < inAcknowledge.acknowledges.size(); i++)
+    {
+        EXPECT_EQ(inAcknowledge.acknowledges[i].status, outAcknowledge.acknowledges[i].status);
+        EXPECT_EQ(inAcknowledge.acknowledges[i].subscriber, outAcknowledge.acknowledges[i].subscriber);
+    }
+}
+
 TEST(Test_VAsioSerdes, vasio_participantAnouncementReply)
 {
     MessageBuffer buffer;
@@ -143,4 +180,20 @@ TEST(Test_VAsioSerdes, vasio_knownParticipants)
     EXPECT_EQ(in, out);
 }
 
+TEST(Test_VAsioSerdes, vasio_sharedMemoryUpgrade)
+{
+    MessageBuffer buffer;
+    SharedMemoryUpgrade in{};
+    SharedMemoryUpgrade out{};
+
+    in.messageHeader = RegistryMsgHeader{};
+    in.status = SharedMemoryUpgrade::OFFER;
+    in.segmentName = "/silkit-1234-abcdef01";
+
+    Serialize(buffer, in);
+    Deserialize(buffer, out);
+
+    EXPECT_EQ(in, out);
+}
+
 } // namespace
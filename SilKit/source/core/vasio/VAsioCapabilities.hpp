@@ -19,6 +19,8 @@
 // OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 // WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
+#pragma once
+
 #include <string>
 #include <unordered_set>
 
@@ -50,6 +52,11 @@ namespace Capabilities {
 const auto ProxyMessage = CapabilityLiteral{"proxy-message"};
 const auto AutonomousSynchronous = CapabilityLiteral{"autonomous-synchronous"};
 const auto RequestParticipantConnection = CapabilityLiteral{"request-participant-connection-v2"};
+const auto SharedMemory = CapabilityLiteral{"shared-memory"};
+const auto PayloadCompression = CapabilityLiteral{"payload-compression"};
+const auto SubscriptionBatch = CapabilityLiteral{"subscription-batch"};
+const auto EventDrivenTimeSync = CapabilityLiteral{"event-driven-time-sync"};
+const auto TimeCoordinator = CapabilityLiteral{"time-coordinator"};
 } // namespace Capabilities
 
 
@@ -31,12 +31,14 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <functional>
 #include <cctype>
 #include <map>
+#include <system_error>
 
 #include "ILogger.hpp"
 #include "VAsioPeer.hpp"
 #include "VAsioProxyPeer.hpp"
 #include "Filesystem.hpp"
 #include "SetThreadName.hpp"
+#include "SetThreadScheduling.hpp"
 #include "Uri.hpp"
 #include "Assert.hpp"
 #include "TransformAcceptorUris.hpp"
@@ -180,6 +182,10 @@ auto MakeCapabilitiesFromConfiguration(const SilKit::Config::ParticipantConfigur
     SilKit::Core::VAsioCapabilities capabilities;
 
     capabilities.AddCapability(SilKit::Core::Capabilities::AutonomousSynchronous);
+    // NextSimTask messages of event-driven participants are understood
+    capabilities.AddCapability(SilKit::Core::Capabilities::EventDrivenTimeSync);
+    // Time grants of a time coordinator are understood
+    capabilities.AddCapability(SilKit::Core::Capabilities::TimeCoordinator);
 
     if (participantConfiguration.middleware.registryAsFallbackProxy)
     {
@@ -191,6 +197,15 @@ auto MakeCapabilitiesFromConfiguration(const SilKit::Config::ParticipantConfigur
         capabilities.AddCapability(SilKit::Core::Capabilities::RequestParticipantConnection);
     }
 
+    if (participantConfiguration.middleware.enableSharedMemory && SilKit::Core::SharedMemorySegment::IsSupported())
+    {
+        capabilities.AddCapability(SilKit::Core::Capabilities::SharedMemory);
+    }
+
+    // compressed messages are always accepted, sending them depends on the configured threshold
+    capabilities.AddCapability(SilKit::Core::Capabilities::PayloadCompression);
+    capabilities.AddCapability(SilKit::Core::Capabilities::SubscriptionBatch);
+
     return capabilities;
 }
 
@@ -210,11 +225,63 @@ auto MakeAsioSocketOptionsFromConfiguration(const SilKit::Config::ParticipantCon
     socketOptions.tcp.noDelay = participantConfiguration.middleware.tcpNoDelay;
     socketOptions.tcp.sendBufferSize = participantConfiguration.middleware.tcpSendBufferSize;
     socketOptions.tcp.receiveBufferSize = participantConfiguration.middleware.tcpReceiveBufferSize;
+    socketOptions.tcp.busyPollMicroseconds = participantConfiguration.middleware.tcpBusyPollMicroseconds;
 
     return socketOptions;
 }
 
 
+auto MakeIoPollingOptionsFromConfiguration(const SilKit::Config::ParticipantConfiguration& participantConfiguration)
+    -> SilKit::Core::IoPollingOptions
+{
+    SilKit::Core::IoPollingOptions pollingOptions{};
+    pollingOptions.enabled = participantConfiguration.middleware.ioBusyPoll;
+    pollingOptions.spinDuration =
+        std::chrono::microseconds{std::max(participantConfiguration.middleware.ioBusyPollSpinMicroseconds, 0)};
+
+    return pollingOptions;
+}
+
+
+auto MakeIoContextFromConfiguration(const SilKit::Config::ParticipantConfiguration& participantConfiguration)
+    -> std::unique_ptr<SilKit::Core::IIoContext>
+{
+    const auto socketOptions{MakeAsioSocketOptionsFromConfiguration(participantConfiguration)};
+    const auto threadCount{static_cast<size_t>(std::max(participantConfiguration.middleware.ioWorkerThreads, 1))};
+    const auto pollingOptions{MakeIoPollingOptionsFromConfiguration(participantConfiguration)};
+
+    if (participantConfiguration.middleware.ioBackend == SilKit::Config::Middleware::IoBackend::IoUring
+        && SilKit::Core::IsUringIoContextSupported())
+    {
+        return SilKit::Core::MakeUringIoContext(socketOptions, threadCount, pollingOptions);
+    }
+
+    return SilKit::Core::MakeAsioIoContext(socketOptions, threadCount, pollingOptions);
+}
+
+
+auto MakeVAsioPeerSettingsFromConfiguration(const SilKit::Config::ParticipantConfiguration& participantConfiguration)
+    -> SilKit::Core::VAsioPeerSettings
+{
+    SilKit::Core::VAsioPeerSettings settings{};
+    settings.sendBatchMaxBytes =
+        static_cast<size_t>(std::max(participantConfiguration.middleware.sendBatchMaxBytes, 0));
+    settings.sendBatchMaxBuffers =
+        static_cast<size_t>(std::max(participantConfiguration.middleware.sendBatchMaxBuffers, 0));
+    settings.enableSharedMemory = participantConfiguration.middleware.enableSharedMemory;
+    settings.multiThreadedIo = participantConfiguration.middleware.ioWorkerThreads > 1;
+    settings.compressionThreshold =
+        static_cast<size_t>(std::max(participantConfiguration.middleware.compressionThreshold, 0));
+    settings.sendQueueMaxBytes =
+        static_cast<size_t>(std::max(participantConfiguration.middleware.sendQueueMaxBytes, 0));
+    settings.sendQueueMaxMessages =
+        static_cast<size_t>(std::max(participantConfiguration.middleware.sendQueueMaxMessages, 0));
+    settings.sendQueueOverflowPolicy = participantConfiguration.middleware.sendQueueOverflowPolicy;
+
+    return settings;
+}
+
+
 auto MakeConnectKnownParticipantsSettings()
     -> SilKit::Core::ConnectKnownParticipantsSettings
 {
@@ -257,7 +324,7 @@ VAsioConnection::VAsioConnection(
     , _participantId{participantId}
     , _timeProvider{timeProvider}
     , _capabilities{MakeCapabilitiesFromConfiguration(_config)}
-    , _ioContext{MakeAsioIoContext(MakeAsioSocketOptionsFromConfiguration(_config))}
+    , _ioContext{MakeIoContextFromConfiguration(_config)}
     , _connectKnownParticipants{*_ioContext, *this, *this, MakeConnectKnownParticipantsSettings()}
     , _remoteConnectionManager{*this, MakeRemoteConnectionManagerSettings()}
     , _version{version}
@@ -311,6 +378,12 @@ void VAsioConnection::SetLogger(Services::Logging::ILogger* logger)
 
     _ioContext->SetLogger(*_logger);
     _connectKnownParticipants.SetLogger(*_logger);
+
+    if (_config.middleware.ioBackend == SilKit::Config::Middleware::IoBackend::IoUring && !IsUringIoContextSupported())
+    {
+        SilKit::Services::Logging::Warn(_logger,
+                                        "io_uring is not available on this system, the connections use asio instead");
+    }
 }
 
 auto VAsioConnection::GetLogger() -> SilKit::Services::Logging::ILogger*
@@ -428,6 +501,11 @@ void VAsioConnection::JoinSimulation(std::string connectUri)
 {
     SILKIT_ASSERT(_logger);
 
+    JoinPhaseClock phaseClock{std::chrono::steady_clock::now(), GetNumberOfReceivedMessages()};
+    const auto finishPhase = [this, &phaseClock](JoinPhaseStatistics& phase) {
+        phaseClock.FinishPhase(phase, std::chrono::steady_clock::now(), GetNumberOfReceivedMessages());
+    };
+
     // Open all configured acceptors and start accepting connections.
     OpenParticipantAcceptors(connectUri);
 
@@ -437,12 +515,24 @@ void VAsioConnection::JoinSimulation(std::string connectUri)
     // Wait for a fixed amount of time for the registry connection to complete.
     WaitForRegistryHandshakeToComplete(REGISTRY_HANDSHAKE_TIMEOUT);
 
+    finishPhase(_joinSimulationStatistics.registryHandshake);
+
     // Start connecting and initiate the handshakes with all known participants.
     ConnectToKnownParticipants();
 
     // Wait for a fixed amount of time for all handshakes to complete.
     WaitForAllReplies(ALL_KNOWN_PARTICIPANT_REPLIED_TIMEOUT);
 
+    finishPhase(_joinSimulationStatistics.connectKnownParticipants);
+
+    {
+        std::lock_guard<decltype(_mutex)> lock{_mutex};
+        for (const auto& pair : _participantNameToPeer)
+        {
+            _joinSimulationStatistics.knownParticipantNames.push_back(pair.first);
+        }
+    }
+
     _logger->Debug("Connected to all known participants");
 }
 
@@ -699,6 +789,12 @@ void VAsioConnection::ReceiveParticipantAnnouncement(IVAsioPeer* from, Serialize
 
     AssociateParticipantNameAndPeer(announcement.peerInfo.participantName, from);
     SendParticipantAnnouncementReply(from);
+
+    // the accepting side offers to move the connection into shared memory, if both sides support it
+    if (auto* vasioPeer = dynamic_cast<VAsioPeer*>(from))
+    {
+        vasioPeer->StartSharedMemoryUpgrade();
+    }
 }
 
 void VAsioConnection::SendParticipantAnnouncementReply(IVAsioPeer* peer)
@@ -1069,6 +1165,18 @@ void VAsioConnection::StartIoWorker()
     _ioWorker = std::thread{[this]() {
         SilKit::Util::SetThreadName(("IO " + _participantName).substr(0, 15));
 
+        // additional I/O worker threads are started from this thread and inherit its affinity and scheduling (POSIX)
+        const auto& threadSettings{_config.middleware.threads.io};
+        try
+        {
+            SilKit::Util::SetThreadScheduling(threadSettings.cpuAffinity, threadSettings.schedulingPolicy,
+                                              threadSettings.schedulingPriority);
+        }
+        catch (const std::system_error& error)
+        {
+            Services::Logging::Warn(_logger, "SilKit-IOWorker: Cannot apply the thread settings: {}", error.what());
+        }
+
         while (true)
         {
             try
@@ -1190,6 +1298,9 @@ void VAsioConnection::RegisterPeerShutdownCallback(std::function<void(IVAsioPeer
 
 void VAsioConnection::OnPeerShutdown(IVAsioPeer* peer)
 {
+    // nothing is sent to the peer anymore, senders must not wait for it
+    OnPeerSendQueueOverflow(peer, false);
+
     if (!_isShuttingDown)
     {
         std::vector<IVAsioPeer*> proxyPeers;
@@ -1273,6 +1384,8 @@ void VAsioConnection::RemovePeerFromConnection(IVAsioPeer* peer)
         _participantNameToPeer.erase(peer->GetInfo().participantName);
     }
 
+    _remoteServiceEndpoints.erase(peer);
+
     auto it{std::find_if(_peers.begin(), _peers.end(), [needle = peer](const auto& hay) {
         return hay.get() == needle;
     })};
@@ -1286,10 +1399,50 @@ void VAsioConnection::RemovePeerFromConnection(IVAsioPeer* peer)
 void VAsioConnection::NotifyShutdown()
 {
     _isShuttingDown = true;
+
+    // release the senders waiting for an overflowing sending queue
+    std::unique_lock<decltype(_sendQueueMutex)> lock{_sendQueueMutex};
+    _sendQueueCondition.notify_all();
+}
+
+void VAsioConnection::OnPeerSendQueueOverflow(IVAsioPeer* peer, bool overflow)
+{
+    if (_config.middleware.sendQueueOverflowPolicy != SilKit::Config::Middleware::SendQueueOverflowPolicy::Block)
+    {
+        return;
+    }
+
+    std::unique_lock<decltype(_sendQueueMutex)> lock{_sendQueueMutex};
+
+    if (overflow)
+    {
+        _overflowingSendQueues.insert(peer);
+    }
+    else if (_overflowingSendQueues.erase(peer) != 0)
+    {
+        _sendQueueCondition.notify_all();
+    }
+
+    _numOverflowingSendQueues = _overflowingSendQueues.size();
+}
+
+void VAsioConnection::WaitForSendQueues()
+{
+    if (_ioContext->IsRunningInThisThread())
+    {
+        return;
+    }
+
+    std::unique_lock<decltype(_sendQueueMutex)> lock{_sendQueueMutex};
+    _sendQueueCondition.wait(lock, [this] {
+        return _overflowingSendQueues.empty() || _isShuttingDown;
+    });
 }
 
 void VAsioConnection::OnSocketData(IVAsioPeer* from, SerializedMessage&& buffer)
 {
+    _numReceivedMessages.fetch_add(1, std::memory_order_relaxed);
+
     auto messageKind = buffer.GetMessageKind();
     switch (messageKind)
     {
@@ -1308,6 +1461,14 @@ void VAsioConnection::OnSocketData(IVAsioPeer* from, SerializedMessage&& buffer)
         return ReceiveRegistryMessage(from, std::move(buffer));
     case VAsioMsgKind::SilKitProxyMessage:
         return ReceiveProxyMessage(from, std::move(buffer));
+    case VAsioMsgKind::SilKitCompressedMessage:
+        // decompressed by the VAsioPeer before being passed on
+        _logger->Warn("Received message with VAsioMsgKind::SilKitCompressedMessage");
+        break;
+    case VAsioMsgKind::SubscriptionAnnouncementBatch:
+        return ReceiveSubscriptionAnnouncementBatch(from, std::move(buffer));
+    case VAsioMsgKind::SubscriptionAcknowledgeBatch:
+        return ReceiveSubscriptionAcknowledgeBatch(from, std::move(buffer));
     }
 }
 
@@ -1324,7 +1485,8 @@ void VAsioConnection::ReceiveProxyMessage(IVAsioPeer* from, SerializedMessage&&
         return;
     }
 
-    auto proxyMessage = buffer.Deserialize<ProxyMessage>();
+    // only the route is read, the payload is deserialized if this participant is the destination
+    const auto route = buffer.PeekProxyMessageRoute();
 
     if (!_capabilities.HasProxyMessageCapability())
     {
@@ -1332,38 +1494,42 @@ void VAsioConnection::ReceiveProxyMessage(IVAsioPeer* from, SerializedMessage&&
         SilKit::Services::Logging::Warn(
             _logger, onceFlag,
             "Ignoring VAsioMsgKind::SilKitProxyMessage because feature is disabled via configuration: From {}, To {}",
-            proxyMessage.source, proxyMessage.destination);
+            route.source, route.destination);
         return;
     }
 
     SilKit::Services::Logging::Trace(_logger,
                                      "Received message with VAsioMsgKind::SilKitProxyMessage: From {}, To {}",
-                                     proxyMessage.source, proxyMessage.destination);
+                                     route.source, route.destination);
 
-    const bool fromIsSource = from->GetInfo().participantName == proxyMessage.source;
+    const bool fromIsSource = from->GetInfo().participantName == route.source;
     if (fromIsSource)
     {
-        auto peer{FindPeerByName(proxyMessage.destination)};
+        auto peer{FindPeerByName(route.destination)};
         if (peer == nullptr)
         {
             SilKit::Services::Logging::Error(_logger, "Unable to deliver proxy message from {} to {}",
-                                             proxyMessage.source, proxyMessage.destination);
+                                             route.source, route.destination);
             return;
         }
 
-        peer->SendSilKitMsg(SerializedMessage{proxyMessage});
+        // The received bytes are forwarded unchanged, the message is neither deserialized nor serialized again. The
+        // sender overwrites the message size with the same value.
+        peer->SendSilKitMsg(SerializedMessage{buffer.ReleaseReceivedStorage()});
 
         // We are relaying a message from source to destination and acting as a proxy. Record the association between
         // source and destination. This is used during disconnects, where we create empty ProxyMessages on behalf of
         // the disconnected peer, to inform the destination that the source peer has disconnected.
-        _proxySourceToDestinations[proxyMessage.source].insert(proxyMessage.destination);
+        _proxySourceToDestinations[route.source].insert(route.destination);
 
         return;
     }
 
-    const bool isDestination = _participantName == proxyMessage.destination;
+    const bool isDestination = _participantName == route.destination;
     if (isDestination)
     {
+        auto proxyMessage = buffer.Deserialize<ProxyMessage>();
+
         auto peer{FindPeerByName(proxyMessage.source)};
 
         if (peer == nullptr)
@@ -1391,6 +1557,28 @@ void VAsioConnection::ReceiveProxyMessage(IVAsioPeer* from, SerializedMessage&&
 }
 
 void VAsioConnection::ReceiveSubscriptionAnnouncement(IVAsioPeer* from, SerializedMessage&& buffer)
+{
+    auto subscriber = buffer.Deserialize<VAsioMsgSubscriber>();
+    auto ack = AcknowledgeSubscription(from, std::move(subscriber));
+    from->SendSilKitMsg(SerializedMessage{from->GetProtocolVersion(), ack});
+}
+
+void VAsioConnection::ReceiveSubscriptionAnnouncementBatch(IVAsioPeer* from, SerializedMessage&& buffer)
+{
+    auto batch = buffer.Deserialize<SubscriptionAnnouncementBatch>();
+
+    SubscriptionAcknowledgeBatch acks;
+    acks.acknowledges.reserve(batch.subscribers.size());
+    for (auto& subscriber : batch.subscribers)
+    {
+        acks.acknowledges.emplace_back(AcknowledgeSubscription(from, std::move(subscriber)));
+    }
+
+    from->SendSilKitMsg(SerializedMessage{from->GetProtocolVersion(), acks});
+}
+
+auto VAsioConnection::AcknowledgeSubscription(IVAsioPeer* from, VAsioMsgSubscriber subscriber)
+    -> SubscriptionAcknowledge
 {
     // Note: there may be multiple types that match the SerdesName
     // we try to find a version to match it, for backward compatibility.
@@ -1412,7 +1600,6 @@ void VAsioConnection::ReceiveSubscriptionAnnouncement(IVAsioPeer* from, Serializ
         return subscriptionVersion;
     };
 
-    auto subscriber = buffer.Deserialize<VAsioMsgSubscriber>();
     bool wasAdded = TryAddRemoteSubscriber(from, subscriber);
 
     // check our Message version against the remote participant's version
@@ -1429,20 +1616,31 @@ void VAsioConnection::ReceiveSubscriptionAnnouncement(IVAsioPeer* from, Serializ
         // Tell our peer what version of the given message type we have
         subscriber.version = myMessageVersion;
     }
-    // send acknowledge
     SubscriptionAcknowledge ack;
     ack.subscriber = std::move(subscriber);
     ack.status = wasAdded
         ? SubscriptionAcknowledge::Status::Success
         : SubscriptionAcknowledge::Status::Failed;
-
-    from->SendSilKitMsg(SerializedMessage{from->GetProtocolVersion(), ack});
+    return ack;
 }
 
 void VAsioConnection::ReceiveSubscriptionAcknowledge(IVAsioPeer* from, SerializedMessage&& buffer)
 {
     auto ack = buffer.Deserialize<SubscriptionAcknowledge>();
+    HandleSubscriptionAcknowledge(from, ack);
+}
+
+void VAsioConnection::ReceiveSubscriptionAcknowledgeBatch(IVAsioPeer* from, SerializedMessage&& buffer)
+{
+    auto batch = buffer.Deserialize<SubscriptionAcknowledgeBatch>();
+    for (const auto& ack : batch.acknowledges)
+    {
+        HandleSubscriptionAcknowledge(from, ack);
+    }
+}
 
+void VAsioConnection::HandleSubscriptionAcknowledge(IVAsioPeer* from, const SubscriptionAcknowledge& ack)
+{
     if (ack.status != SubscriptionAcknowledge::Status::Success)
     {
         Services::Logging::Error(_logger, "Failed to subscribe [{}] {} from {}"
@@ -1455,6 +1653,111 @@ void VAsioConnection::ReceiveSubscriptionAcknowledge(IVAsioPeer* from, Serialize
     RemovePendingSubscription({from, ack.subscriber});
 }
 
+void VAsioConnection::BeginRegistrationBatch()
+{
+    if (_registrationBatchDepth++ > 0)
+    {
+        return;
+    }
+
+    _ioContext->Post([this] {
+        _isRegistrationBatchActive = true;
+    });
+}
+
+void VAsioConnection::EndRegistrationBatch()
+{
+    auto depth = _registrationBatchDepth.load();
+    do
+    {
+        if (depth == 0)
+        {
+            throw SilKitError{"EndRegistrationBatch: No registration batch is active"};
+        }
+    } while (!_registrationBatchDepth.compare_exchange_weak(depth, depth - 1));
+
+    if (depth > 1)
+    {
+        return;
+    }
+
+    SILKIT_ASSERT(_pendingSubscriptionAcknowledges.empty());
+    _receivedAllSubscriptionAcknowledges = std::promise<void>{};
+    auto allAcked = _receivedAllSubscriptionAcknowledges.get_future();
+
+    _ioContext->Post([this] {
+        _isRegistrationBatchActive = false;
+
+        const auto numSubscriptions = _pendingSubscriptionAnnouncements.size();
+        SendPendingSubscriptions();
+
+        Services::Logging::Debug(_logger, "Registration batch: Announced {} subscriptions, waiting for {} acknowledges",
+                                 numSubscriptions, _pendingSubscriptionAcknowledges.size());
+
+        if (_pendingSubscriptionAcknowledges.empty())
+        {
+            SyncSubscriptionsCompleted();
+        }
+        if (_hasPendingAsyncSubscriptions && _pendingAsyncSubscriptionAcknowledges.empty())
+        {
+            AsyncSubscriptionsCompleted();
+        }
+    });
+
+    Services::Logging::Trace(_logger, "SIL Kit waiting for the subscription acknowledges of the registration batch.");
+    allAcked.wait();
+    Services::Logging::Trace(_logger, "SIL Kit received all subscription acknowledges of the registration batch.");
+}
+
+void VAsioConnection::SendPendingSubscriptions()
+{
+    if (_pendingSubscriptionAnnouncements.empty())
+    {
+        return;
+    }
+
+    std::unique_lock<decltype(_peersLock)> lock{_peersLock};
+
+    for (auto&& peer : _peers)
+    {
+        for (const auto& pending : _pendingSubscriptionAnnouncements)
+        {
+            PendingAcksIdentifier ackPair{peer.get(), pending.subscriber};
+            if (!pending.useAsyncRegistration)
+            {
+                _pendingSubscriptionAcknowledges.emplace_back(std::move(ackPair));
+            }
+            else
+            {
+                _pendingAsyncSubscriptionAcknowledges.emplace_back(std::move(ackPair));
+            }
+        }
+
+        if (VAsioCapabilities{peer->GetInfo().capabilities}.HasCapability(Capabilities::SubscriptionBatch))
+        {
+            SubscriptionAnnouncementBatch batch;
+            batch.subscribers.reserve(_pendingSubscriptionAnnouncements.size());
+            for (const auto& pending : _pendingSubscriptionAnnouncements)
+            {
+                batch.subscribers.push_back(pending.subscriber);
+            }
+
+            Services::Logging::Debug(_logger, "Subscribing to {} message types from participant '{}'",
+                                     batch.subscribers.size(), peer->GetInfo().participantName);
+            peer->SendSilKitMsg(SerializedMessage{batch});
+        }
+        else
+        {
+            for (const auto& pending : _pendingSubscriptionAnnouncements)
+            {
+                peer->Subscribe(pending.subscriber);
+            }
+        }
+    }
+
+    _pendingSubscriptionAnnouncements.clear();
+}
+
 void VAsioConnection::RemovePendingSubscription(const PendingAcksIdentifier& ackId)
 {
     auto iterPendingSync =
@@ -1529,13 +1832,43 @@ void VAsioConnection::ReceiveRawSilKitMessage(IVAsioPeer* from, SerializedMessag
         return;
     }
 
-    auto endpoint = buffer.GetEndpointAddress(); //ExtractEndpointAddress(buffer);
+    const auto endpoint = buffer.GetEndpointAddress();
+    const auto* remoteEndpoint = GetRemoteServiceEndpoint(from, endpoint.endpoint);
 
-    auto* fromService = dynamic_cast<IServiceEndpoint*>(from);
-    ServiceDescriptor tmpService(fromService->GetServiceDescriptor());
-    tmpService.SetServiceId(endpoint.endpoint);
+    _vasioReceivers[receiverIdx]->ReceiveRawMsg(from, remoteEndpoint, std::move(buffer));
+}
+
+auto VAsioConnection::GetRemoteServiceEndpoint(IVAsioPeer* peer, EndpointId endpointId) -> const IServiceEndpoint*
+{
+    auto&& endpoints = _remoteServiceEndpoints[peer];
 
-    _vasioReceivers[receiverIdx]->ReceiveRawMsg(from, tmpService, std::move(buffer));
+    auto it = endpoints.find(endpointId);
+    if (it == endpoints.end())
+    {
+        ServiceDescriptor descriptor{peer->GetServiceDescriptor()};
+        descriptor.SetServiceId(endpointId);
+
+        it = endpoints.emplace(endpointId, RemoteServiceEndpoint{descriptor}).first;
+    }
+
+    return &it->second;
+}
+
+void VAsioConnection::RemoveRemoteServiceEndpoint(const ServiceDescriptor& serviceDescriptor)
+{
+    ExecuteOnIoThread([this, participantId = serviceDescriptor.GetParticipantId(),
+                       endpointId = serviceDescriptor.GetServiceId()] {
+        for (auto&& kv : _remoteServiceEndpoints)
+        {
+            auto&& endpoints = kv.second;
+
+            const auto it = endpoints.find(endpointId);
+            if (it != endpoints.end() && it->second.GetServiceDescriptor().GetParticipantId() == participantId)
+            {
+                endpoints.erase(it);
+            }
+        }
+    });
 }
 
 void VAsioConnection::RegisterMessageReceiver(std::function<void(IVAsioPeer* peer, ParticipantAnnouncement)> callback)
@@ -1592,6 +1925,11 @@ void VAsioConnection::ReceiveRegistryMessage(IVAsioPeer* from, SerializedMessage
         return ReceiveKnownParticpants(from, std::move(buffer));
     case RegistryMessageKind::RemoteParticipantConnectRequest:
         return ReceiveRemoteParticipantConnectRequest(from, std::move(buffer));
+    case RegistryMessageKind::SharedMemoryUpgrade:
+        // handled by the VAsioPeer itself, since it changes how the peer reads and writes
+        Services::Logging::Warn(_logger, "Ignoring unexpected SharedMemoryUpgrade message from '{}'",
+                                from->GetInfo().participantName);
+        return;
     }
 }
 
@@ -1607,6 +1945,101 @@ void VAsioConnection::SetAsyncSubscriptionsCompletionHandler(std::function<void(
     }
 }
 
+void VAsioConnection::StartSendBuffering()
+{
+    if (!_config.middleware.enableSendBuffering)
+    {
+        return;
+    }
+
+    _sendBufferingThread = std::this_thread::get_id();
+
+    ExecuteOnIoThread([this] {
+        std::unique_lock<decltype(_peersLock)> lock{_peersLock};
+
+        for (const auto& peer : _peers)
+        {
+            peer->StartSendBuffering();
+        }
+
+        if (_registry != nullptr)
+        {
+            _registry->StartSendBuffering();
+        }
+    });
+}
+
+void VAsioConnection::FlushSendBuffers()
+{
+    if (!_config.middleware.enableSendBuffering)
+    {
+        return;
+    }
+
+    _sendBufferingThread = std::thread::id{};
+
+    ExecuteOnIoThread([this] {
+        std::unique_lock<decltype(_peersLock)> lock{_peersLock};
+
+        for (const auto& peer : _peers)
+        {
+            peer->FlushSendBuffer();
+        }
+
+        if (_registry != nullptr)
+        {
+            _registry->FlushSendBuffer();
+        }
+    });
+}
+
+auto VAsioConnection::GetPeerStatistics() -> std::vector<Experimental::Participant::PeerStatistics>
+{
+    const auto makePeerStatistics = [](const VAsioPeer& peer) {
+        const auto traffic = peer.GetTrafficStatistics();
+        const auto queue = peer.GetSendQueueStatistics();
+        const auto batches = peer.GetSendBatchStatistics();
+
+        Experimental::Participant::PeerStatistics statistics;
+        statistics.participantName = peer.GetInfo().participantName;
+        statistics.sentMessages = traffic.numSentMessages;
+        statistics.sentBytes = traffic.numSentBytes;
+        statistics.receivedMessages = traffic.numReceivedMessages;
+        statistics.receivedBytes = traffic.numReceivedBytes;
+        statistics.sendQueueMessages = queue.queuedMessages;
+        statistics.sendQueueBytes = queue.queuedBytes;
+        statistics.peakSendQueueMessages = queue.maxQueuedMessages;
+        statistics.peakSendQueueBytes = queue.maxQueuedBytes;
+        statistics.sendBatches = batches.numBatches;
+        statistics.maxSendBatchMessages = batches.maxBatchMessages;
+        statistics.maxSendBatchBytes = batches.maxBatchBytes;
+        statistics.roundTripTime = traffic.roundTripTime;
+        return statistics;
+    };
+
+    std::vector<Experimental::Participant::PeerStatistics> peerStatistics;
+
+    std::unique_lock<decltype(_peersLock)> lock{_peersLock};
+
+    // proxy peers share the connection of the peer they are routed through, which is reported instead
+    for (const auto& peer : _peers)
+    {
+        const auto* vasioPeer = dynamic_cast<const VAsioPeer*>(peer.get());
+        if (vasioPeer != nullptr)
+        {
+            peerStatistics.emplace_back(makePeerStatistics(*vasioPeer));
+        }
+    }
+
+    const auto* registryPeer = dynamic_cast<const VAsioPeer*>(_registry.get());
+    if (registryPeer != nullptr)
+    {
+        peerStatistics.emplace_back(makePeerStatistics(*registryPeer));
+    }
+
+    return peerStatistics;
+}
+
 auto VAsioConnection::GetNumberOfRemoteReceivers(const IServiceEndpoint* service, const std::string& msgTypeName)
     -> size_t
 {
@@ -1751,7 +2184,8 @@ auto VAsioConnection::MakeConnectPeer(const VAsioPeerInfo& peerInfo) -> std::uni
 
 auto VAsioConnection::MakeVAsioPeer(std::unique_ptr<IRawByteStream> stream) -> std::unique_ptr<IVAsioPeer>
 {
-    auto vAsioPeer{std::make_unique<VAsioPeer>(this, _ioContext.get(), std::move(stream), _logger)};
+    auto vAsioPeer{std::make_unique<VAsioPeer>(this, _ioContext.get(), std::move(stream), _logger,
+                                               MakeVAsioPeerSettingsFromConfiguration(_config))};
     return vAsioPeer;
 }
 
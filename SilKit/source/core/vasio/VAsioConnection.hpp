@@ -33,6 +33,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <list>
 #include <set>
 #include <condition_variable>
+#include <thread>
 
 #include "ParticipantConfiguration.hpp"
 
@@ -53,8 +54,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "silkit/services/orchestration/string_utils.hpp"
 #include "silkit/services/can/string_utils.hpp"
+#include "silkit/experimental/participant/ParticipantDatatypesExtensions.hpp"
 
 #include "ProtocolVersion.hpp"
+#include "JoinSimulationStatistics.hpp"
 #include "SerializedMessage.hpp"
 #include "Assert.hpp"
 #include "ILogger.hpp"
@@ -66,6 +69,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "IConnectionMethods.hpp"
 #include "IConnectPeer.hpp"
 #include "MakeAsioIoContext.hpp"
+#include "MakeUringIoContext.hpp"
 #include "ConnectKnownParticipants.hpp"
 #include "RemoteConnectionManager.hpp"
 
@@ -119,8 +123,18 @@ public:
     template <class SilKitServiceT>
     void RegisterSilKitService(SilKitServiceT* service)
     {
+        // inside a registration batch, the subscriptions are announced and awaited by EndRegistrationBatch
+        const bool isBatched = _registrationBatchDepth > 0;
+
         std::future<void> allAcked;
-        if (!SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration())
+        if (isBatched)
+        {
+            if (SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration())
+            {
+                _hasPendingAsyncSubscriptions = true;
+            }
+        }
+        else if (!SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration())
         {
             SILKIT_ASSERT(_pendingSubscriptionAcknowledges.empty());
             _receivedAllSubscriptionAcknowledges = std::promise<void>{};
@@ -135,7 +149,7 @@ public:
             this->RegisterSilKitServiceImpl<SilKitServiceT>(service);
         });
 
-        if (!SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration())
+        if (!isBatched && !SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration())
         {
             Trace(_logger, "SIL Kit waiting for subscription acknowledges for SilKitService {}.", typeid(*service).name());
             allAcked.wait();
@@ -143,6 +157,13 @@ public:
         }
     }
 
+    //! Defer the subscriptions of the services registered until the matching EndRegistrationBatch. Batches nest, only
+    //! the outermost one is effective.
+    void BeginRegistrationBatch();
+    //! Announce the subscriptions of all services registered since BeginRegistrationBatch to the peers, and wait once
+    //! until the subscriptions of the synchronously registered services are acknowledged.
+    void EndRegistrationBatch();
+
     template <class SilKitServiceT>
     void SetHistoryLengthForLink(size_t historyLength, SilKitServiceT* service)
     {
@@ -160,13 +181,37 @@ public:
     template<typename SilKitMessageT>
     void SendMsg(const IServiceEndpoint* from, SilKitMessageT&& msg)
     {
-        ExecuteOnIoThread(&VAsioConnection::SendMsgImpl<SilKitMessageT>, from, std::forward<SilKitMessageT>(msg));
+        using MessageT = std::decay_t<SilKitMessageT>;
+
+        if (_numOverflowingSendQueues != 0)
+        {
+            WaitForSendQueues();
+        }
+
+        // The message is copied (or moved) into the task once, and moved from there on. Tasks for small messages do
+        // not allocate.
+        ExecuteOnIoThread([this, from, isBuffered = IsSendBufferingThread(),
+                           msg = MessageT{std::forward<SilKitMessageT>(msg)}]() mutable {
+            BufferedSendScope bufferedSend{isBuffered};
+            SendMsgImpl(from, std::move(msg));
+        });
     }
 
     template<typename SilKitMessageT>
     void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName, SilKitMessageT&& msg)
     {
-        ExecuteOnIoThread(&VAsioConnection::SendMsgToTargetImpl<SilKitMessageT>, from, targetParticipantName, std::forward<SilKitMessageT>(msg));
+        using MessageT = std::decay_t<SilKitMessageT>;
+
+        if (_numOverflowingSendQueues != 0)
+        {
+            WaitForSendQueues();
+        }
+
+        ExecuteOnIoThread([this, from, targetParticipantName, isBuffered = IsSendBufferingThread(),
+                           msg = MessageT{std::forward<SilKitMessageT>(msg)}]() mutable {
+            BufferedSendScope bufferedSend{isBuffered};
+            SendMsgToTargetImpl(from, targetParticipantName, std::move(msg));
+        });
     }
 
     inline void OnAllMessagesDelivered(const std::function<void()>& callback)
@@ -174,7 +219,12 @@ public:
         callback();
     }
 
-    void FlushSendBuffers() {}
+    //! Buffer the messages sent by the calling thread from now on, until FlushSendBuffers is called. Only simulation
+    //! data is buffered, control traffic (e.g., subscriptions) is sent right away. Does nothing, unless
+    //! Middleware/EnableSendBuffering is set.
+    void StartSendBuffering();
+    //! Write the messages buffered since StartSendBuffering. Both calls are ordered with the messages sent in between.
+    void FlushSendBuffers();
     void ExecuteDeferred(std::function<void()> function)
     {
         _ioContext->Post(std::move(function));
@@ -206,6 +256,21 @@ public:
     // Register handlers for completion of async service creation
     void SetAsyncSubscriptionsCompletionHandler(std::function<void()> handler);
 
+    //! Durations of the phases of JoinSimulation, and the participants which are known after it.
+    auto GetJoinSimulationStatistics() const -> JoinSimulationStatistics
+    {
+        return _joinSimulationStatistics;
+    }
+
+    //! Transport statistics of the connections to all peers and to the registry.
+    auto GetPeerStatistics() -> std::vector<Experimental::Participant::PeerStatistics>;
+
+    //! Number of messages received from all peers.
+    auto GetNumberOfReceivedMessages() const -> uint64_t
+    {
+        return _numReceivedMessages.load(std::memory_order_relaxed);
+    }
+
     size_t GetNumberOfConnectedParticipants()
     {
         return _peers.size();
@@ -217,9 +282,13 @@ public:
 
     bool ParticipantHasCapability(const std::string& participantName, const std::string& capability) const;
 
+    //! Drop the cached endpoint of a removed remote service, see GetRemoteServiceEndpoint.
+    void RemoveRemoteServiceEndpoint(const ServiceDescriptor& serviceDescriptor);
+
 public: // IVAsioPeerListener
     void OnSocketData(IVAsioPeer* from, SerializedMessage&& buffer) override;
     void OnPeerShutdown(IVAsioPeer* peer) override;
+    void OnPeerSendQueueOverflow(IVAsioPeer* peer, bool overflow) override;
 
 public: //members
     static constexpr const ParticipantId RegistryParticipantId { 0 };
@@ -231,6 +300,11 @@ private: // data types
     template <class MsgT>
     using SilKitServiceToLinkMap = std::map<std::string, std::shared_ptr<SilKitLink<MsgT>>>;
 
+    //! Link of each registered sender, resolved once during the registration. Null if the endpoint was registered on
+    //! more than one network (e.g., a bus simulator), its link is then looked up by the network name.
+    template <class MsgT>
+    using SilKitEndpointToLinkMap = std::unordered_map<const IServiceEndpoint*, SilKitLink<MsgT>*>;
+
     using ParticipantAnnouncementReceiver = std::function<void(IVAsioPeer* peer, ParticipantAnnouncement)>;
 
     using SilKitMessageTypes = std::tuple<
@@ -283,8 +357,14 @@ private:
     // ----------------------------------------
     // private methods
     void ReceiveRawSilKitMessage(IVAsioPeer* from, SerializedMessage&& buffer);
+    //! Returns the cached endpoint of the remote service, which is created on the first message it sent.
+    auto GetRemoteServiceEndpoint(IVAsioPeer* peer, EndpointId endpointId) -> const IServiceEndpoint*;
     void ReceiveSubscriptionAnnouncement(IVAsioPeer* from, SerializedMessage&& buffer);
     void ReceiveSubscriptionAcknowledge(IVAsioPeer* from, SerializedMessage&& buffer);
+    void ReceiveSubscriptionAnnouncementBatch(IVAsioPeer* from, SerializedMessage&& buffer);
+    void ReceiveSubscriptionAcknowledgeBatch(IVAsioPeer* from, SerializedMessage&& buffer);
+    auto AcknowledgeSubscription(IVAsioPeer* from, VAsioMsgSubscriber subscriber) -> SubscriptionAcknowledge;
+    void HandleSubscriptionAcknowledge(IVAsioPeer* from, const SubscriptionAcknowledge& ack);
     void ReceiveRegistryMessage(IVAsioPeer* from, SerializedMessage&& buffer);
     void ReceiveProxyMessage(IVAsioPeer* from, SerializedMessage&& buffer);
 
@@ -315,6 +395,9 @@ private:
     // Unique identifier of SubscriptionAcknowledges on the subscriber
     using PendingAcksIdentifier = std::pair<IVAsioPeer*, VAsioMsgSubscriber>;
     void RemovePendingSubscription(const PendingAcksIdentifier& ackId);
+    // Announce the subscriptions of the newly registered receivers to all peers. Peers with the "subscription-batch"
+    // capability receive all of them in a single message.
+    void SendPendingSubscriptions();
 
     void SendProxyPeerShutdownNotification(IVAsioPeer* peer);
     void RemovePeerFromLinks(IVAsioPeer* peer);
@@ -363,34 +446,49 @@ private:
             serviceEndpointPtr->SetServiceDescriptor(tmpServiceDescriptor);
             _vasioReceivers.emplace_back(std::move(rawReceiver));
 
-            {
-                std::unique_lock<decltype(_peersLock)> lock{_peersLock};
-
-                for (auto&& peer : _peers)
-                {
-                    // Add pending subscriptions
-                    PendingAcksIdentifier ackPair{peer.get(), subscriptionInfo};
-                    if (!SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration())
-                    {
-                        _pendingSubscriptionAcknowledges.emplace_back(ackPair);
-                    }
-                    else
-                    {
-                        _pendingAsyncSubscriptionAcknowledges.emplace_back(ackPair);
-                    }
-
-                    peer->Subscribe(subscriptionInfo);
-                }
-            }
+            // the subscriptions are announced to the peers by SendPendingSubscriptions
+            _pendingSubscriptionAnnouncements.push_back(
+                {subscriptionInfo, SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration()});
         }
     }
 
     template<class SilKitMessageT>
-    void RegisterSilKitMsgSender(const std::string& networkName)
+    void RegisterSilKitMsgSender(const IServiceEndpoint* endpoint)
     {
+        const auto& networkName = endpoint->GetServiceDescriptor().GetNetworkName();
+
         auto link = GetLinkByName<SilKitMessageT>(networkName);
         auto&& serviceLinkMap = std::get<SilKitServiceToLinkMap<SilKitMessageT>>(_serviceToLinkMap);
         serviceLinkMap[networkName] = link;
+
+        auto&& endpointLinkMap = std::get<SilKitEndpointToLinkMap<SilKitMessageT>>(_endpointToLinkMap);
+        auto result = endpointLinkMap.emplace(endpoint, link.get());
+        if (!result.second && result.first->second != link.get())
+        {
+            result.first->second = nullptr;
+        }
+    }
+
+    //! Returns the link the endpoint sends the message type on. Only registered senders resolve to their link directly.
+    template <class SilKitMessageT>
+    auto GetSenderLink(const IServiceEndpoint* from, const char* context) -> SilKitLink<SilKitMessageT>*
+    {
+        auto&& endpointLinkMap = std::get<SilKitEndpointToLinkMap<SilKitMessageT>>(_endpointToLinkMap);
+        auto endpointIt = endpointLinkMap.find(from);
+        if (endpointIt != endpointLinkMap.end() && endpointIt->second != nullptr)
+        {
+            return endpointIt->second;
+        }
+
+        const auto& key = from->GetServiceDescriptor().GetNetworkName();
+
+        auto&& linkMap = std::get<SilKitServiceToLinkMap<SilKitMessageT>>(_serviceToLinkMap);
+        auto linkIt = linkMap.find(key);
+        if (linkIt == linkMap.end())
+        {
+            throw SilKitError{std::string{context} + ": sending on empty link for " + key};
+        }
+        return linkIt->second.get();
     }
 
     template<class SilKitServiceT>
@@ -410,10 +508,18 @@ private:
             [this, service](auto&& message)
         {
             using SilKitMessageT = std::decay_t<decltype(message)>;
-            this->RegisterSilKitMsgSender<SilKitMessageT>(GetServiceDescriptor(service).GetNetworkName());
+            this->RegisterSilKitMsgSender<SilKitMessageT>(&dynamic_cast<const IServiceEndpoint&>(*service));
         }
         );
 
+        if (_isRegistrationBatchActive)
+        {
+            // announced and completed by EndRegistrationBatch
+            return;
+        }
+
+        SendPendingSubscriptions();
+
         // We could have registered a receiver that only uses already acknowledged senders, thus no new handshake is
         // triggered. In that case, the pending acks might be already empty and the subscription is completed.
         if (!SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration())
@@ -435,14 +541,7 @@ private:
     template <class SilKitMessageT>
     void SendMsgImpl(const IServiceEndpoint* from, SilKitMessageT&& msg)
     {
-        const auto& key = from->GetServiceDescriptor().GetNetworkName();
-
-        auto& linkMap = std::get<SilKitServiceToLinkMap<std::decay_t<SilKitMessageT>>>(_serviceToLinkMap);
-        if (linkMap.count(key) < 1)
-        {
-            throw SilKitError{ "SendMsgImpl: sending on empty link for " + key };
-        }
-        auto&& link = linkMap[key];
+        auto* link = GetSenderLink<std::decay_t<SilKitMessageT>>(from, "SendMsgImpl");
         link->DistributeLocalSilKitMessage(from, std::forward<SilKitMessageT>(msg));
     }
 
@@ -450,25 +549,25 @@ private:
     void SendMsgToTargetImpl(const IServiceEndpoint* from, const std::string& targetParticipantName,
                                    SilKitMessageT&& msg)
     {
-        const auto& key = from->GetServiceDescriptor().GetNetworkName();
-
-        auto& linkMap = std::get<SilKitServiceToLinkMap<std::decay_t<SilKitMessageT>>>(_serviceToLinkMap);
-        if (linkMap.count(key) < 1)
-        {
-            throw SilKitError{"SendMsgToTargetImpl: sending on empty link for " + key};
-        }
-        auto&& link = linkMap[key];
+        auto* link = GetSenderLink<std::decay_t<SilKitMessageT>>(from, "SendMsgToTargetImpl");
         link->DispatchSilKitMessageToTarget(from, targetParticipantName, std::forward<SilKitMessageT>(msg));
     }
 
-    template <typename... MethodArgs, typename... Args>
-    inline void ExecuteOnIoThread(void (VAsioConnection::*method)(MethodArgs...), Args&&... args)
+    inline void ExecuteOnIoThread(IoTask task)
     {
-        _ioContext->Post([=]() mutable { (this->*method)(std::move(args)...); });
+        _ioContext->Post(std::move(task));
     }
-    inline void ExecuteOnIoThread(std::function<void()> function)
+
+    //! Block the calling thread while the sending queue of a peer overflows (SendQueueOverflowPolicy::Block). The
+    //! threads of the I/O context never block, they are the ones draining the queues.
+    //! Only the sending queues of the peers are bounded: the tasks posted by SendMsg before a queue is flagged as
+    //! overflowing are not counted, so the queue may exceed its limit by the messages in flight to the I/O thread.
+    void WaitForSendQueues();
+
+    //! True, if the calling thread started the send buffering and did not flush the buffers yet
+    inline bool IsSendBufferingThread() const
     {
-        _ioContext->Post(std::move(function));
+        return _sendBufferingThread.load() == std::this_thread::get_id();
     }
 
     template <class SilKitServiceT>
@@ -521,8 +620,12 @@ private:
     Util::tuple_tools::wrapped_tuple<SilKitLinkMap, SilKitMessageTypes> _links;
     //! \brief Lookup for links by name.
     Util::tuple_tools::wrapped_tuple<SilKitServiceToLinkMap, SilKitMessageTypes> _serviceToLinkMap;
+    //! \brief Links of the registered senders, only accessed on the I/O thread.
+    Util::tuple_tools::wrapped_tuple<SilKitEndpointToLinkMap, SilKitMessageTypes> _endpointToLinkMap;
 
     std::vector<std::unique_ptr<IVAsioReceiver>> _vasioReceivers;
+    //! \brief Endpoints of the remote services by peer and endpoint id, only accessed on the I/O thread.
+    std::unordered_map<IVAsioPeer*, std::unordered_map<EndpointId, RemoteServiceEndpoint>> _remoteServiceEndpoints;
     std::unordered_set<std::string> _vasioUniqueReceiverIds;
 
     std::mutex _participantAnnouncementReceiversMutex;
@@ -558,6 +661,19 @@ private:
     /// Protects access to _participantNameToPeer
     mutable std::mutex _mutex;
 
+    // Subscriptions of newly registered receivers, which have not been announced to the peers yet
+    struct PendingSubscriptionAnnouncement
+    {
+        VAsioMsgSubscriber subscriber;
+        bool useAsyncRegistration;
+    };
+    std::vector<PendingSubscriptionAnnouncement> _pendingSubscriptionAnnouncements;
+
+    // Nesting depth of the registration batches
+    std::atomic<int> _registrationBatchDepth{0};
+    // Set on the I/O thread while a registration batch is active
+    bool _isRegistrationBatchActive{false};
+
     // Keep track of the sent Subscriptions when Registering an SIL Kit Service
     std::vector<PendingAcksIdentifier> _pendingSubscriptionAcknowledges;
     std::promise<void> _receivedAllSubscriptionAcknowledges;
@@ -567,6 +683,19 @@ private:
     std::function<void()> _asyncSubscriptionsCompletionHandler;
     std::atomic<bool> _hasPendingAsyncSubscriptions{false};
 
+    // Peers whose sending queue overflows, senders wait for them (only with SendQueueOverflowPolicy::Block)
+    std::mutex _sendQueueMutex;
+    std::condition_variable _sendQueueCondition;
+    std::unordered_set<IVAsioPeer*> _overflowingSendQueues;
+    std::atomic<size_t> _numOverflowingSendQueues{0};
+
+    // The thread whose messages are buffered, set by StartSendBuffering (usually the thread running the simulation step)
+    std::atomic<std::thread::id> _sendBufferingThread{};
+
+    // Counters for the join phases, see GetJoinSimulationStatistics
+    std::atomic<uint64_t> _numReceivedMessages{0};
+    JoinSimulationStatistics _joinSimulationStatistics;
+
     // The worker thread should be the last members in this class. This ensures
     // that no callback is destroyed before the thread finishes.
     std::thread _ioWorker;
@@ -69,6 +69,18 @@ struct SubscriptionAcknowledge
     VAsioMsgSubscriber subscriber;
 };
 
+//! All subscriptions of a registration to a single peer. Only sent to peers with the "subscription-batch" capability.
+struct SubscriptionAnnouncementBatch
+{
+    std::vector<VAsioMsgSubscriber> subscribers;
+};
+
+//! The acknowledges of all subscriptions received in a SubscriptionAnnouncementBatch.
+struct SubscriptionAcknowledgeBatch
+{
+    std::vector<SubscriptionAcknowledge> acknowledges;
+};
+
 struct ParticipantAnnouncement
 {
     RegistryMsgHeader messageHeader;
@@ -115,6 +127,26 @@ struct RemoteParticipantConnectRequest
     Status status{INVALID};
 };
 
+//! Negotiates moving the traffic of a local-domain socket connection into a shared memory segment.
+struct SharedMemoryUpgrade
+{
+    enum Status : uint8_t
+    {
+        INVALID = 0,
+        //! The sender created a segment and offers to use it.
+        OFFER = 1,
+        //! The sender uses the segment for all data following this message.
+        ACCEPT = 2,
+        //! The sender declines the offered segment.
+        REJECT = 3,
+    };
+
+    RegistryMsgHeader messageHeader;
+    Status status{INVALID};
+    //! Name of the shared memory segment (only used with OFFER).
+    std::string segmentName;
+};
+
 enum class RegistryMessageKind : uint8_t
 {
     Invalid = 0,
@@ -129,6 +161,7 @@ enum class RegistryMessageKind : uint8_t
     ParticipantAnnouncementReply = 2,
     KnownParticipants = 3,
     RemoteParticipantConnectRequest = 4,
+    SharedMemoryUpgrade = 5,
 };
 
 struct ProxyMessageHeader
@@ -144,6 +177,14 @@ struct ProxyMessage
     std::vector<uint8_t> payload;
 };
 
+//! The leading part of a ProxyMessage, which is sufficient to relay the message without touching its payload.
+struct ProxyMessageRoute
+{
+    ProxyMessageHeader header{0};
+    std::string source;
+    std::string destination;
+};
+
 // ================================================================================
 //  Inline Implementations
 // ================================================================================
@@ -34,6 +34,9 @@ enum class VAsioMsgKind: uint8_t
     SilKitSimMsg = 4,
     SilKitRegistryMessage = 5,
     SilKitProxyMessage = 6, // 3.1 with "proxy-message" capability
+    SilKitCompressedMessage = 7, // 4.0.40 with "payload-compression" capability, only seen by VAsioPeer
+    SubscriptionAnnouncementBatch = 8, // 4.0.40 with "subscription-batch" capability
+    SubscriptionAcknowledgeBatch = 9, // 4.0.40 with "subscription-batch" capability
 };
 
 } // namespace Core
@@ -21,18 +21,23 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "VAsioPeer.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 #include <thread>
 
 #include "ILogger.hpp"
 #include "VAsioMsgKind.hpp"
+#include "VAsioCapabilities.hpp"
 #include "VAsioConnection.hpp"
 #include "Uri.hpp"
 #include "Assert.hpp"
 
 #include "util/TracingMacros.hpp"
 
+#include "LzCompression.hpp"
+
 
 #if SILKIT_ENABLE_TRACING_INSTRUMENTATION_VAsioPeer
 #    define SILKIT_TRACE_METHOD_(logger, ...) SILKIT_TRACE_METHOD(logger, __VA_ARGS__)
@@ -44,25 +49,112 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 using namespace std::chrono_literals;
 
 
+namespace {
+
+//! Initial size of the receive buffer. Larger messages grow the buffer to the size of the message.
+constexpr size_t DEFAULT_RECEIVE_BUFFER_SIZE{4096};
+//! Upper bound for the size of a received message.
+constexpr uint32_t MAX_MESSAGE_SIZE{1024 * 1024 * 1024};
+//! Upper bound for the number of message buffers kept for reuse.
+constexpr size_t MAX_POOLED_MESSAGE_BUFFERS{4};
+//! Message buffers with a larger capacity are released instead of being kept for reuse.
+constexpr size_t MAX_POOLED_MESSAGE_BUFFER_CAPACITY{64 * 1024};
+//! Header of a compressed message: size of the compressed message, message kind, size of the decompressed message.
+//! The compressed data is the complete original message, including its own size.
+constexpr size_t COMPRESSED_MESSAGE_HEADER_SIZE{sizeof(uint32_t) + sizeof(uint8_t) + sizeof(uint32_t)};
+//! Minimum interval between two queries of the round-trip time of the socket.
+constexpr std::chrono::seconds ROUND_TRIP_TIME_SAMPLE_INTERVAL{1};
+
+//! The calling thread sends the messages of a simulation step, see BufferedSendScope
+thread_local bool tIsBufferedSend{false};
+
+
+auto IsLocalDomainStream(const VSilKit::IRawByteStream& stream) -> bool
+{
+    try
+    {
+        return stream.GetLocalEndpoint().rfind("local://", 0) == 0;
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+}
+
+//! Add to a counter that is only written by one thread at a time, but read by any thread.
+void AddRelaxed(std::atomic<uint64_t>& counter, uint64_t value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+} // namespace
+
+
 namespace SilKit {
 namespace Core {
 
+BufferedSendScope::BufferedSendScope(bool isBuffered)
+    : _wasBuffered{tIsBufferedSend}
+{
+    tIsBufferedSend = isBuffered;
+}
+
+BufferedSendScope::~BufferedSendScope()
+{
+    tIsBufferedSend = _wasBuffered;
+}
+
+auto BufferedSendScope::IsBuffered() -> bool
+{
+    return tIsBufferedSend;
+}
+
 VAsioPeer::VAsioPeer(IVAsioPeerListener* listener, IIoContext* ioContext, std::unique_ptr<IRawByteStream> stream,
-                     Services::Logging::ILogger* logger)
+                     Services::Logging::ILogger* logger, VAsioPeerSettings settings)
     : _listener{listener}
     , _ioContext{ioContext}
-    , _socket{std::move(stream)}
     , _logger{logger}
+    , _settings{std::move(settings)}
 {
+    // Participants connected via a local-domain socket run on the same host and may switch to shared memory later
+    if (_settings.enableSharedMemory && SharedMemorySegment::IsSupported() && IsLocalDomainStream(*stream))
+    {
+        auto sharedMemoryStream{std::make_unique<SharedMemoryRawByteStream>(std::move(stream), *_logger)};
+        _sharedMemoryStream = sharedMemoryStream.get();
+        stream = std::move(sharedMemoryStream);
+    }
+
+    _socket = std::move(stream);
     _socket->SetListener(*this);
+    _strand = &_socket->GetStrand();
 }
 
 VAsioPeer::~VAsioPeer()
 {
     SILKIT_TRACE_METHOD_(_logger, "()");
 
-    SilKit::Services::Logging::Info(_logger, "VAsioPeer::~VAsioPeer({}): sending queue size = {}", _info.participantName, _sendingQueue.size());
-    SilKit::Services::Logging::Info(_logger, "VAsioPeer::~VAsioPeer({}): sending buffer size = {}", _info.participantName, _currentSendingBuffer.GetSize());
+    SilKit::Services::Logging::Info(_logger, "VAsioPeer::~VAsioPeer({}): sending queue empty = {}", _info.participantName, _sendingQueue.IsEmpty());
+    SilKit::Services::Logging::Info(_logger, "VAsioPeer::~VAsioPeer({}): sending buffer size = {}", _info.participantName, GetCurrentSendingBufferSize());
+
+    const auto& stats = _sendBatchStatistics;
+    SilKit::Services::Logging::Debug(
+        _logger, "VAsioPeer::~VAsioPeer({}): sent {} messages ({} bytes) in {} writes, largest write: {} messages ({} bytes)",
+        _info.participantName, stats.numMessages, stats.numBytes, stats.numBatches, stats.maxBatchMessages,
+        stats.maxBatchBytes);
+    if (stats.numCompressedMessages != 0)
+    {
+        SilKit::Services::Logging::Debug(_logger, "VAsioPeer::~VAsioPeer({}): compressed {} messages ({} to {} bytes)",
+                                         _info.participantName, stats.numCompressedMessages,
+                                         stats.numUncompressedBytes, stats.numCompressedBytes);
+    }
+
+    const auto& queueStats = _sendQueueStatistics;
+    if (queueStats.numOverflows != 0)
+    {
+        SilKit::Services::Logging::Debug(
+            _logger, "VAsioPeer::~VAsioPeer({}): sending queue reached its limits {} times, dropped {} messages",
+            _info.participantName, queueStats.numOverflows, queueStats.numDroppedMessages);
+    }
 }
 
 
@@ -70,20 +162,72 @@ void VAsioPeer::Shutdown()
 {
     _isShuttingDown = true;
 
+    const auto sending = _sending.exchange(true);
+    SilKit::Services::Logging::Info(_logger, "VAsioPeer::Shutdown ({}): write in progress = {}", _info.participantName, sending);
+
+    // otherwise, the writer shuts the socket down once the sending queue has been written
+    if (!sending)
     {
-        std::unique_lock<decltype(_sendingQueueMutex)> lock{_sendingQueueMutex};
+        ExecuteOnStrand(&VAsioPeer::StartAsyncWrite);
+    }
+}
 
-        SilKit::Services::Logging::Info(_logger, "VAsioPeer::Shutdown ({}): sending queue size = {}", _info.participantName, _sendingQueue.size());
-        SilKit::Services::Logging::Info(_logger, "VAsioPeer::Shutdown ({}): sending buffer size = {}", _info.participantName, _currentSendingBuffer.GetSize());
 
-        if (_sendingQueue.empty() && (_currentSendingBuffer.GetSize() == 0))
-        {
-            _socket->Shutdown();
-        }
+void VAsioPeer::StartSendBuffering()
+{
+    _sendBuffering = true;
+}
+
+
+void VAsioPeer::FlushSendBuffer()
+{
+    _sendBuffering = false;
+
+    // messages enqueued before the flag was cleared are picked up by this writer
+    if (!_sending.exchange(true))
+    {
+        ExecuteOnStrand(&VAsioPeer::StartAsyncWrite);
     }
 }
 
 
+auto VAsioPeer::GetSendBatchStatistics() const -> VAsioPeerSendBatchStatistics
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    return _sendBatchStatistics;
+}
+
+
+auto VAsioPeer::GetSendQueueStatistics() const -> VAsioPeerSendQueueStatistics
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    auto stats{_sendQueueStatistics};
+    lock.unlock();
+
+    stats.queuedMessages = _queuedMessages;
+    stats.queuedBytes = _queuedBytes;
+    return stats;
+}
+
+
+auto VAsioPeer::GetTrafficStatistics() const -> VAsioPeerTrafficStatistics
+{
+    VAsioPeerTrafficStatistics stats;
+    stats.numSentMessages = _numSentMessages.load(std::memory_order_relaxed);
+    stats.numSentBytes = _numSentBytes.load(std::memory_order_relaxed);
+    stats.numReceivedMessages = _numReceivedMessages.load(std::memory_order_relaxed);
+    stats.numReceivedBytes = _numReceivedBytes.load(std::memory_order_relaxed);
+    stats.roundTripTime = std::chrono::microseconds{_roundTripTime.load(std::memory_order_relaxed)};
+    return stats;
+}
+
+
+auto VAsioPeer::IsSendQueueOverflowing() const -> bool
+{
+    return _sendQueueOverflowing;
+}
+
+
 auto VAsioPeer::GetInfo() const -> const VAsioPeerInfo&
 {
     return _info;
@@ -92,6 +236,16 @@ auto VAsioPeer::GetInfo() const -> const VAsioPeerInfo&
 void VAsioPeer::SetInfo(VAsioPeerInfo peerInfo)
 {
     _info = std::move(peerInfo);
+
+    try
+    {
+        _remoteSupportsCompression =
+            VAsioCapabilities{_info.capabilities}.HasCapability(Capabilities::PayloadCompression);
+    }
+    catch (const std::exception&)
+    {
+        _remoteSupportsCompression = false;
+    }
 }
 
 
@@ -106,46 +260,402 @@ auto VAsioPeer::GetLocalAddress() const -> std::string
 }
 
 void VAsioPeer::SendSilKitMsg(SerializedMessage buffer)
+{
+    EnqueueMessage(std::move(buffer), false);
+}
+
+void VAsioPeer::ExecuteOnStrand(void (VAsioPeer::*method)())
+{
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        if (_socketShutdown)
+        {
+            return;
+        }
+
+        ++_strandOperations;
+    }
+
+    _strand->Dispatch([this, method] {
+        (this->*method)();
+        FinishStrandOperation();
+    });
+}
+
+void VAsioPeer::FinishStrandOperation()
+{
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        if (--_strandOperations != 0 || !_socketShutdown)
+        {
+            return;
+        }
+    }
+
+    // the socket shut down while the operation was pending
+    DeliverShutdown();
+}
+
+void VAsioPeer::EnqueueMessage(SerializedMessage buffer, bool switchToSharedMemory)
 {
     // Prevent sending when shutting down
     if (!_isShuttingDown && _socket != nullptr)
     {
-        std::unique_lock<std::mutex> lock{_sendingQueueMutex};
+        // only the simulation data of a step is held back, any other message also writes the ones queued before it
+        const bool isBuffered = BufferedSendScope::IsBuffered() && IsMwOrSim(buffer.GetMessageKind());
+
+        SendingQueueEntry entry;
+        entry.sharedPayload = buffer.GetSharedPayload();
+        entry.data = entry.sharedPayload ? buffer.ReleaseHeaderStorage() : buffer.ReleaseStorage();
+        entry.switchToSharedMemory = switchToSharedMemory;
+        entry.queuedSize = entry.GetSize();
+        entry.isUserData = buffer.IsUserData();
+
+        // the shared memory upgrade is never subject to the limits of the sending queue
+        if (!switchToSharedMemory && IsSendQueueLimitReached(1, entry.queuedSize))
+        {
+            ScheduleSendQueueCheck();
+
+            // The queue only drains while it is written, so a step exceeding the limits ends the buffering. Otherwise,
+            // a sender blocked by the overflow (SendQueueOverflowPolicy::Block) would wait for the end of its own step.
+            if (_sendBuffering)
+            {
+                FlushSendBuffer();
+            }
+
+            // user data is discarded, unless it would be the only message in the queue
+            if (_settings.sendQueueOverflowPolicy == Config::Middleware::SendQueueOverflowPolicy::Error
+                && entry.isUserData && _queuedMessages != 0)
+            {
+                std::unique_lock<decltype(_mutex)> lock{_mutex};
+                _sendQueueStatistics.numDroppedMessages += 1;
+                return;
+            }
+        }
 
-        _sendingQueue.push_back(buffer.ReleaseStorage());
+        _queuedMessages += 1;
+        _queuedBytes += entry.queuedSize;
+        _sendingQueue.Push(std::move(entry));
 
-        lock.unlock();
+        // the message is written by FlushSendBuffer (or a write in progress)
+        if (_sendBuffering && isBuffered)
+        {
+            return;
+        }
 
-        _ioContext->Dispatch([this] {
-            StartAsyncWrite();
-        });
+        // a write in progress (or scheduled) picks up the new message
+        if (!_sending.exchange(true))
+        {
+            ExecuteOnStrand(&VAsioPeer::StartAsyncWrite);
+        }
+    }
+}
+
+auto VAsioPeer::FrontSendingEntry() -> SendingQueueEntry*
+{
+    auto* entry = _sendingQueue.Front();
+    while (entry != nullptr && entry->discarded)
+    {
+        _sendingQueue.Pop();
+        entry = _sendingQueue.Front();
     }
+    return entry;
 }
 
 void VAsioPeer::StartAsyncWrite()
 {
-    if (_sending)
+    while (FrontSendingEntry() == nullptr)
+    {
+        if (!_sendingQueue.IsEmpty())
+        {
+            // a producer is in the middle of pushing the next message
+            std::this_thread::yield();
+            continue;
+        }
+
+        // the write stays 'in progress', nothing is written after the shutdown
+        if (_isShuttingDown)
+        {
+            _socket->Shutdown();
+            return;
+        }
+
+        _sending = false;
+
+        // A producer (or Shutdown) that still saw the flag set relies on this writer, so check again. Otherwise, the
+        // producer that sets the flag next schedules the writer.
+        if ((_sendingQueue.IsEmpty() && !_isShuttingDown) || _sending.exchange(true))
+        {
+            return;
+        }
+    }
+
+    // Coalesce as many queued messages as the batch limits allow into a single vectored write. The first message is
+    // always taken, regardless of the limits.
+    _currentSendingEntries.clear();
+    size_t batchBuffers{0};
+    size_t batchBytes{0};
+    size_t batchQueuedBytes{0};
+    do
+    {
+        auto& entry = *FrontSendingEntry();
+        if (!entry.compressionChecked)
+        {
+            CompressEntry(entry);
+        }
+
+        if (!_currentSendingEntries.empty()
+            && (batchBuffers + entry.GetBufferCount() > _settings.sendBatchMaxBuffers
+                || batchBytes + entry.GetSize() > _settings.sendBatchMaxBytes))
+        {
+            break;
+        }
+
+        batchBuffers += entry.GetBufferCount();
+        batchBytes += entry.GetSize();
+        _currentSendingEntries.emplace_back(std::move(entry));
+        _sendingQueue.Pop();
+        AccountDequeuedEntry(_currentSendingEntries.back());
+        batchQueuedBytes += _currentSendingEntries.back().queuedSize;
+
+        // the following entries must not be written into the socket anymore
+        if (_currentSendingEntries.back().switchToSharedMemory)
+        {
+            break;
+        }
+    } while (FrontSendingEntry() != nullptr);
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    // the size of the queue before this batch was taken from it
+    auto& queueStats = _sendQueueStatistics;
+    const size_t queuedMessages = _queuedMessages + _currentSendingEntries.size();
+    const size_t queuedBytes = _queuedBytes + batchQueuedBytes;
+    queueStats.maxQueuedMessages = std::max(queueStats.maxQueuedMessages, queuedMessages);
+    queueStats.maxQueuedBytes = std::max(queueStats.maxQueuedBytes, queuedBytes);
+
+    auto& stats = _sendBatchStatistics;
+    stats.numBatches += 1;
+    stats.numMessages += _currentSendingEntries.size();
+    stats.numBytes += batchBytes;
+    stats.maxBatchMessages = std::max(stats.maxBatchMessages, _currentSendingEntries.size());
+    stats.maxBatchBytes = std::max(stats.maxBatchBytes, batchBytes);
+
+    lock.unlock();
+
+    _currentSendingBuffers.clear();
+    for (const auto& entry : _currentSendingEntries)
+    {
+        _currentSendingBuffers.emplace_back(entry.data.data(), entry.data.size());
+        if (entry.sharedPayload)
+        {
+            _currentSendingBuffers.emplace_back(entry.sharedPayload->data(), entry.sharedPayload->size());
+        }
+    }
+    _currentSendingBufferIndex = 0;
+
+    // the queue might have drained below the low watermark
+    if (_sendQueueOverflowing)
+    {
+        UpdateSendQueueOverflow();
+    }
+
+    WriteSomeAsync();
+}
+
+auto VAsioPeer::IsSendQueueLimitReached(size_t additionalMessages, size_t additionalBytes) const -> bool
+{
+    return (_settings.sendQueueMaxMessages != 0
+            && _queuedMessages + additionalMessages > _settings.sendQueueMaxMessages)
+           || (_settings.sendQueueMaxBytes != 0 && _queuedBytes + additionalBytes > _settings.sendQueueMaxBytes);
+}
+
+void VAsioPeer::ScheduleSendQueueCheck()
+{
+    if (!_sendQueueCheckScheduled.exchange(true))
+    {
+        ExecuteOnStrand(&VAsioPeer::CheckSendQueue);
+    }
+}
+
+void VAsioPeer::CheckSendQueue()
+{
+    // producers reaching the limits from now on schedule the next check
+    _sendQueueCheckScheduled = false;
+
+    if (_settings.sendQueueOverflowPolicy == Config::Middleware::SendQueueOverflowPolicy::DropOldest)
+    {
+        DropOldestMessages();
+    }
+
+    UpdateSendQueueOverflow();
+}
+
+void VAsioPeer::DropOldestMessages()
+{
+    uint64_t numDroppedMessages{0};
+
+    // Only user data is dropped, control messages (e.g., subscriptions or the NextSimTask of the time synchronization)
+    // are kept in order. The entries are only marked, the writer removes them from the queue.
+    size_t numRemainingMessages = _queuedMessages;
+    _sendingQueue.ForEach([this, &numDroppedMessages, &numRemainingMessages](SendingQueueEntry& entry) {
+        if (entry.discarded)
+        {
+            return true;
+        }
+
+        // the newest message is always kept, and nothing is dropped across a switch to shared memory
+        if (numRemainingMessages <= 1 || entry.switchToSharedMemory || !IsSendQueueLimitReached(0, 0))
+        {
+            return false;
+        }
+        --numRemainingMessages;
+
+        if (entry.isUserData)
+        {
+            AccountDequeuedEntry(entry);
+            entry.discarded = true;
+            entry.data = {};
+            entry.sharedPayload.reset();
+            ++numDroppedMessages;
+        }
+        return true;
+    });
+
+    if (numDroppedMessages != 0)
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        _sendQueueStatistics.numDroppedMessages += numDroppedMessages;
+    }
+}
+
+void VAsioPeer::UpdateSendQueueOverflow()
+{
+    const size_t queuedMessages = _queuedMessages;
+    const size_t queuedBytes = _queuedBytes;
+
+    const bool limitReached =
+        (_settings.sendQueueMaxMessages != 0 && queuedMessages >= _settings.sendQueueMaxMessages)
+        || (_settings.sendQueueMaxBytes != 0 && queuedBytes >= _settings.sendQueueMaxBytes);
+    // the low watermark prevents toggling the state with every single message
+    const bool belowLowWatermark =
+        (_settings.sendQueueMaxMessages == 0 || queuedMessages <= _settings.sendQueueMaxMessages / 2)
+        && (_settings.sendQueueMaxBytes == 0 || queuedBytes <= _settings.sendQueueMaxBytes / 2);
+
+    if (!_sendQueueOverflowing && limitReached)
+    {
+        _sendQueueOverflowing = true;
+
+        {
+            std::unique_lock<decltype(_mutex)> lock{_mutex};
+            _sendQueueStatistics.numOverflows += 1;
+        }
+
+        if (_settings.sendQueueOverflowPolicy == Config::Middleware::SendQueueOverflowPolicy::Error)
+        {
+            Services::Logging::Error(_logger,
+                                     "VAsioPeer: Sending queue to participant '{}' reached its limits ({} messages, {} "
+                                     "bytes queued), new data messages are discarded",
+                                     _info.participantName, queuedMessages, queuedBytes);
+        }
+        else
+        {
+            Services::Logging::Warn(_logger,
+                                    "VAsioPeer: Sending queue to participant '{}' reached its limits ({} messages, {} "
+                                    "bytes queued)",
+                                    _info.participantName, queuedMessages, queuedBytes);
+        }
+    }
+    else if (_sendQueueOverflowing && belowLowWatermark)
+    {
+        _sendQueueOverflowing = false;
+
+        Services::Logging::Debug(_logger, "VAsioPeer: Sending queue to participant '{}' is within its limits again",
+                                 _info.participantName);
+    }
+    else
+    {
         return;
+    }
 
-    std::unique_lock<std::mutex> lock{_sendingQueueMutex};
-    if (_sendingQueue.empty())
+    _listener->OnPeerSendQueueOverflow(this, _sendQueueOverflowing);
+}
+
+void VAsioPeer::AccountDequeuedEntry(const SendingQueueEntry& entry)
+{
+    _queuedMessages -= 1;
+    _queuedBytes -= entry.queuedSize;
+}
+
+void VAsioPeer::CompressEntry(SendingQueueEntry& entry)
+{
+    entry.compressionChecked = true;
+
+    const auto size = entry.GetSize();
+    if (_settings.compressionThreshold == 0 || size <= _settings.compressionThreshold || size > MAX_MESSAGE_SIZE
+        || entry.switchToSharedMemory || !_remoteSupportsCompression
+        || (_sharedMemoryStream != nullptr && _sharedMemoryStream->IsWriteSwitched()))
     {
         return;
     }
 
-    _sending = true;
+    const uint8_t* input = entry.data.data();
+    if (entry.sharedPayload)
+    {
+        _compressionInput.assign(entry.data.begin(), entry.data.end());
+        _compressionInput.insert(_compressionInput.end(), entry.sharedPayload->begin(), entry.sharedPayload->end());
+        input = _compressionInput.data();
+    }
 
-    _currentSendingBufferData = std::move(_sendingQueue.front());
-    _sendingQueue.pop_front();
-    lock.unlock();
+    _compressionOutput.resize(COMPRESSED_MESSAGE_HEADER_SIZE);
+    SilKit::Util::LzCompress(input, size, _compressionOutput);
 
-    _currentSendingBuffer = ConstBuffer(_currentSendingBufferData.data(), _currentSendingBufferData.size());
-    WriteSomeAsync();
+    // incompressible messages are sent as they are
+    if (_compressionOutput.size() >= size)
+    {
+        return;
+    }
+
+    const auto compressedSize = static_cast<uint32_t>(_compressionOutput.size());
+    const auto messageKind = static_cast<uint8_t>(VAsioMsgKind::SilKitCompressedMessage);
+    const auto decompressedSize = static_cast<uint32_t>(size);
+
+    auto* header = _compressionOutput.data();
+    memcpy(header, &compressedSize, sizeof compressedSize);
+    memcpy(header + sizeof compressedSize, &messageKind, sizeof messageKind);
+    memcpy(header + sizeof compressedSize + sizeof messageKind, &decompressedSize, sizeof decompressedSize);
+
+    // the storage of the original message is reused for the next compression
+    std::swap(entry.data, _compressionOutput);
+    entry.sharedPayload.reset();
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    _sendBatchStatistics.numCompressedMessages += 1;
+    _sendBatchStatistics.numUncompressedBytes += size;
+    _sendBatchStatistics.numCompressedBytes += compressedSize;
 }
 
 void VAsioPeer::WriteSomeAsync()
 {
-    _socket->AsyncWriteSome(ConstBufferSequence{&_currentSendingBuffer, 1});
+    // skip buffers that have been written completely (or are empty)
+    while (_currentSendingBufferIndex < _currentSendingBuffers.size()
+           && _currentSendingBuffers[_currentSendingBufferIndex].GetSize() == 0)
+    {
+        ++_currentSendingBufferIndex;
+    }
+
+    _socket->AsyncWriteSome(ConstBufferSequence{_currentSendingBuffers.data() + _currentSendingBufferIndex,
+                                                _currentSendingBuffers.size() - _currentSendingBufferIndex});
+}
+
+auto VAsioPeer::GetCurrentSendingBufferSize() const -> size_t
+{
+    size_t size{0};
+    for (size_t index = _currentSendingBufferIndex; index < _currentSendingBuffers.size(); ++index)
+    {
+        size += _currentSendingBuffers[index].GetSize();
+    }
+    return size;
 }
 
 void VAsioPeer::Subscribe(VAsioMsgSubscriber subscriber)
@@ -156,10 +666,16 @@ void VAsioPeer::Subscribe(VAsioMsgSubscriber subscriber)
 }
 
 void VAsioPeer::StartAsyncRead()
+{
+    ExecuteOnStrand(&VAsioPeer::StartReading);
+}
+
+void VAsioPeer::StartReading()
 {
     _currentMsgSize = 0u;
 
-    _msgBuffer.resize(4096);
+    _msgBuffer.resize(DEFAULT_RECEIVE_BUFFER_SIZE);
+    _rPos = {0u};
     _wPos = {0u};
 
     ReadSomeAsync();
@@ -167,7 +683,7 @@ void VAsioPeer::StartAsyncRead()
 
 void VAsioPeer::ReadSomeAsync()
 {
-    SILKIT_ASSERT(_msgBuffer.size() > 0);
+    SILKIT_ASSERT(_msgBuffer.size() > _wPos);
     auto* wPtr = _msgBuffer.data() + _wPos;
     auto  size = _msgBuffer.size() - _wPos;
 
@@ -178,68 +694,362 @@ void VAsioPeer::ReadSomeAsync()
 
 void VAsioPeer::DispatchBuffer()
 {
-    if (_currentMsgSize == 0)
+    // dispatch all complete messages, the trailing data stays in place until all of them are dispatched
+    while (true)
     {
-        if (_isShuttingDown)
+        const auto bytesAvailable = _wPos - _rPos;
+
+        if (_currentMsgSize == 0)
         {
-            return;
+            if (_isShuttingDown)
+            {
+                return;
+            }
+            if (bytesAvailable < sizeof(uint32_t))
+            {
+                // not enough data to even determine the message size
+                break;
+            }
+
+            uint32_t msgSize{0u};
+            memcpy(&msgSize, _msgBuffer.data() + _rPos, sizeof msgSize);
+
+            // validate the received size
+            if (msgSize < sizeof msgSize || msgSize > MAX_MESSAGE_SIZE)
+            {
+                SilKit::Services::Logging::Error(_logger, "Received invalid Message Size: {}", msgSize);
+                Shutdown();
+                return;
+            }
+
+            _currentMsgSize = msgSize;
         }
-        if (_wPos >= sizeof(uint32_t))
+
+        if (bytesAvailable < _currentMsgSize)
         {
-            _currentMsgSize = *reinterpret_cast<uint32_t*>(_msgBuffer.data());
+            break;
         }
-        else
+
+        DispatchMessage();
+    }
+
+    // move the beginning of the next message to the front of the buffer
+    const auto bytesRemaining = _wPos - _rPos;
+    if (_rPos != 0)
+    {
+        if (bytesRemaining != 0)
         {
-            // not enough data to even determine the message size...
-            // make sure the buffer can store some data
-            if (_msgBuffer.size() < sizeof(uint32_t))
-                _msgBuffer.resize(4096);
-            // and restart the async read operation
-            ReadSomeAsync();
-            return;
+            memmove(_msgBuffer.data(), _msgBuffer.data() + _rPos, bytesRemaining);
         }
+        _rPos = 0u;
+        _wPos = bytesRemaining;
     }
 
-    // validate the received size
-    if (_currentMsgSize == 0 || _currentMsgSize > 1024 * 1024 * 1024)
+    // make the buffer large enough for the next message and wait until we have more data
+    const auto requiredSize = std::max<size_t>(_currentMsgSize, DEFAULT_RECEIVE_BUFFER_SIZE);
+    if (_msgBuffer.size() < requiredSize)
     {
-        SilKit::Services::Logging::Error(_logger, "Received invalid Message Size: {}", _currentMsgSize);
+        _msgBuffer.resize(requiredSize);
+    }
+    else if (_msgBuffer.size() > requiredSize)
+    {
+        _msgBuffer.resize(requiredSize);
+        _msgBuffer.shrink_to_fit();
+    }
+
+    ReadSomeAsync();
+}
+
+void VAsioPeer::DispatchMessage()
+{
+    const size_t msgSize = _currentMsgSize;
+
+    std::vector<uint8_t> msgBuffer;
+    if (_rPos == 0 && _wPos == msgSize && msgSize > DEFAULT_RECEIVE_BUFFER_SIZE)
+    {
+        // the buffer holds exactly one large message, hand it over without copying
+        msgBuffer = std::move(_msgBuffer);
+        _msgBuffer = AcquireMessageBuffer();
+    }
+    else
+    {
+        msgBuffer = AcquireMessageBuffer();
+        msgBuffer.assign(_msgBuffer.begin() + _rPos, _msgBuffer.begin() + _rPos + msgSize);
+    }
+
+    _rPos += msgSize;
+    _currentMsgSize = 0u;
+
+    AddRelaxed(_numReceivedMessages, 1);
+    AddRelaxed(_numReceivedBytes, msgSize);
+
+    if (msgSize > sizeof(uint32_t)
+        && static_cast<VAsioMsgKind>(msgBuffer[sizeof(uint32_t)]) == VAsioMsgKind::SilKitCompressedMessage
+        && !DecompressMessage(msgBuffer))
+    {
+        SilKit::Services::Logging::Error(_logger, "VAsioPeer: Received invalid compressed message from '{}'",
+                                         _info.participantName);
         Shutdown();
+        return;
     }
 
+    SerializedMessage message{std::move(msgBuffer)};
 
-    if (_wPos < _currentMsgSize)
+    if (message.GetMessageKind() == VAsioMsgKind::SilKitRegistryMessage
+        && message.GetRegistryKind() == RegistryMessageKind::SharedMemoryUpgrade)
+    {
+        ReceiveSharedMemoryUpgrade(message);
+    }
+    else if (_settings.multiThreadedIo)
     {
-        // Make the buffer large enough and wait until we have more data.
-        _msgBuffer.resize(_currentMsgSize);
-        ReadSomeAsync();
+        // handed over to the main strand in DeliverReceivedMessages
+        _receivedMessages.emplace_back(std::move(message));
         return;
     }
     else
     {
-        auto newBuffer = std::vector<uint8_t>{_msgBuffer.begin() + _currentMsgSize, _msgBuffer.end()};
-        auto newWPos = _wPos - _currentMsgSize;
+        message.SetProtocolVersion(GetProtocolVersion());
+        _listener->OnSocketData(this, std::move(message));
+    }
+
+    // the listener only borrows the message, reuse its storage for the next one
+    RecycleMessageBuffer(message.ReleaseReceivedStorage());
+}
+
+auto VAsioPeer::DecompressMessage(std::vector<uint8_t>& buffer) -> bool
+{
+    uint32_t compressedSize{0};
+    uint32_t decompressedSize{0};
+    if (buffer.size() < COMPRESSED_MESSAGE_HEADER_SIZE)
+    {
+        return false;
+    }
+    memcpy(&compressedSize, buffer.data(), sizeof compressedSize);
+    memcpy(&decompressedSize, buffer.data() + sizeof compressedSize + sizeof(uint8_t), sizeof decompressedSize);
+
+    if (compressedSize < COMPRESSED_MESSAGE_HEADER_SIZE || compressedSize > buffer.size()
+        || decompressedSize <= sizeof(uint32_t) || decompressedSize > MAX_MESSAGE_SIZE)
+    {
+        return false;
+    }
+
+    auto decompressed = AcquireMessageBuffer();
+    decompressed.resize(decompressedSize);
+    if (!SilKit::Util::LzDecompress(buffer.data() + COMPRESSED_MESSAGE_HEADER_SIZE,
+                                    compressedSize - COMPRESSED_MESSAGE_HEADER_SIZE, decompressed.data(),
+                                    decompressed.size()))
+    {
+        RecycleMessageBuffer(std::move(decompressed));
+        return false;
+    }
 
-        // manually extract the message size so we can adjust the MessageBuffer size
-        uint32_t msgSize{0u};
-        if (_msgBuffer.size() < sizeof msgSize)
+    // the decompressed data must be exactly one (uncompressed) message
+    uint32_t messageSize{0};
+    memcpy(&messageSize, decompressed.data(), sizeof messageSize);
+    if (messageSize != decompressedSize
+        || static_cast<VAsioMsgKind>(decompressed[sizeof messageSize]) == VAsioMsgKind::SilKitCompressedMessage)
+    {
+        RecycleMessageBuffer(std::move(decompressed));
+        return false;
+    }
+
+    RecycleMessageBuffer(std::move(buffer));
+    buffer = std::move(decompressed);
+    return true;
+}
+
+void VAsioPeer::DeliverReceivedMessages()
+{
+    if (_receivedMessages.empty())
+    {
+        return;
+    }
+
+    // The messages are posted in the order they were received. The main strand executes them in this order, and always
+    // before the shutdown, which is posted later.
+    auto messages{std::make_shared<std::vector<SerializedMessage>>(std::move(_receivedMessages))};
+    _receivedMessages.clear();
+
+    _ioContext->Post([this, messages] {
+        for (auto& message : *messages)
         {
-            throw SilKitError{ "DispatchBuffer: Received message is too small to contain message size header" };
+            // the protocol version is negotiated on the main strand, it might have changed with the previous message
+            message.SetProtocolVersion(GetProtocolVersion());
+            _listener->OnSocketData(this, std::move(message));
         }
-        memcpy(&msgSize, _msgBuffer.data(), sizeof msgSize);
-        //ensure buffer does not contain data from contiguous messages
-        _msgBuffer.resize(msgSize);
-        SerializedMessage message{std::move(_msgBuffer)};
-        message.SetProtocolVersion(GetProtocolVersion());
-        _listener->OnSocketData(this, std::move(message));
+    });
+}
 
-        // keep trailing data in the buffer
-        _msgBuffer = std::move(newBuffer);
-        _wPos = newWPos;
-        _currentMsgSize = 0u;
+void VAsioPeer::DeliverShutdown()
+{
+    if (_settings.multiThreadedIo)
+    {
+        _ioContext->Post([this] {
+            _listener->OnPeerShutdown(this);
+        });
+    }
+    else
+    {
+        _listener->OnPeerShutdown(this);
+    }
+}
 
-        DispatchBuffer();
+auto VAsioPeer::AcquireMessageBuffer() -> std::vector<uint8_t>
+{
+    if (_messageBufferPool.empty())
+    {
+        return {};
     }
+
+    auto buffer{std::move(_messageBufferPool.back())};
+    _messageBufferPool.pop_back();
+    return buffer;
+}
+
+void VAsioPeer::RecycleMessageBuffer(std::vector<uint8_t> buffer)
+{
+    if (buffer.capacity() == 0 || buffer.capacity() > MAX_POOLED_MESSAGE_BUFFER_CAPACITY
+        || _messageBufferPool.size() >= MAX_POOLED_MESSAGE_BUFFERS)
+    {
+        return;
+    }
+
+    buffer.clear();
+    _messageBufferPool.emplace_back(std::move(buffer));
+}
+
+
+void VAsioPeer::StartSharedMemoryUpgrade()
+{
+    if (_sharedMemoryStream != nullptr)
+    {
+        ExecuteOnStrand(&VAsioPeer::OfferSharedMemory);
+    }
+}
+
+void VAsioPeer::OfferSharedMemory()
+{
+    if (_sharedMemoryStream == nullptr || _sharedMemoryStream->HasSharedMemory())
+    {
+        return;
+    }
+
+    try
+    {
+        if (!VAsioCapabilities{_info.capabilities}.HasCapability(Capabilities::SharedMemory))
+        {
+            return;
+        }
+
+        const auto segmentName = _sharedMemoryStream->CreateSharedMemory(_settings.sharedMemoryRingBufferCapacity);
+
+        Services::Logging::Debug(_logger, "VAsioPeer: Offering shared memory segment '{}' to participant '{}'",
+                                 segmentName, _info.participantName);
+
+        SendSharedMemoryUpgrade(SharedMemoryUpgrade::OFFER, segmentName);
+    }
+    catch (const std::exception& error)
+    {
+        Services::Logging::Warn(_logger, "VAsioPeer: Cannot offer shared memory to participant '{}': {}",
+                                _info.participantName, error.what());
+    }
+}
+
+auto VAsioPeer::IsUsingSharedMemory() const -> bool
+{
+    return _sharedMemoryStream != nullptr && _sharedMemoryStream->IsReadSwitched()
+           && _sharedMemoryStream->IsWriteSwitched();
+}
+
+void VAsioPeer::SendSharedMemoryUpgrade(SharedMemoryUpgrade::Status status, std::string segmentName)
+{
+    SharedMemoryUpgrade upgrade;
+    // only sent to peers announcing the capability, i.e., peers using the current protocol version
+    upgrade.messageHeader = MakeRegistryMsgHeader(CurrentProtocolVersion());
+    upgrade.status = status;
+    upgrade.segmentName = std::move(segmentName);
+
+    // the remote side reads everything after the ACCEPT from the shared memory
+    const bool switchToSharedMemory = status == SharedMemoryUpgrade::ACCEPT;
+    _sharedMemoryAcceptSent = _sharedMemoryAcceptSent || switchToSharedMemory;
+
+    EnqueueMessage(SerializedMessage{upgrade}, switchToSharedMemory);
+}
+
+void VAsioPeer::ReceiveSharedMemoryUpgrade(SerializedMessage& message)
+{
+    const auto upgrade{message.Deserialize<SharedMemoryUpgrade>()};
+
+    switch (upgrade.status)
+    {
+    case SharedMemoryUpgrade::OFFER:
+        AcceptSharedMemoryUpgrade(upgrade.segmentName);
+        return;
+
+    case SharedMemoryUpgrade::ACCEPT:
+        if (_sharedMemoryStream == nullptr || !_sharedMemoryStream->HasSharedMemory()
+            || _sharedMemoryStream->IsReadSwitched())
+        {
+            Services::Logging::Error(_logger, "VAsioPeer: Received unexpected shared memory upgrade from '{}'",
+                                     _info.participantName);
+            Shutdown();
+            return;
+        }
+
+        // The remote side writes everything following the ACCEPT into shared memory. The socket only carries
+        // doorbells from now on, which must not be interpreted as messages.
+        _sharedMemoryStream->SwitchReadToSharedMemory();
+        _rPos = _wPos;
+
+        Services::Logging::Debug(_logger, "VAsioPeer: Receiving from participant '{}' via shared memory",
+                                 _info.participantName);
+
+        if (!_sharedMemoryAcceptSent)
+        {
+            SendSharedMemoryUpgrade(SharedMemoryUpgrade::ACCEPT, {});
+        }
+        return;
+
+    case SharedMemoryUpgrade::REJECT:
+        Services::Logging::Debug(_logger, "VAsioPeer: Participant '{}' rejected the shared memory segment",
+                                 _info.participantName);
+
+        if (_sharedMemoryStream != nullptr && _sharedMemoryStream->HasSharedMemory() && !_sharedMemoryAcceptSent)
+        {
+            _sharedMemoryStream->ReleaseSharedMemory();
+        }
+        return;
+
+    case SharedMemoryUpgrade::INVALID:
+        break;
+    }
+
+    Services::Logging::Warn(_logger, "VAsioPeer: Ignoring invalid shared memory upgrade from '{}'",
+                            _info.participantName);
+}
+
+void VAsioPeer::AcceptSharedMemoryUpgrade(const std::string& segmentName)
+{
+    if (_sharedMemoryStream == nullptr || _sharedMemoryStream->HasSharedMemory())
+    {
+        SendSharedMemoryUpgrade(SharedMemoryUpgrade::REJECT, {});
+        return;
+    }
+
+    try
+    {
+        _sharedMemoryStream->OpenSharedMemory(segmentName);
+    }
+    catch (const std::exception& error)
+    {
+        Services::Logging::Warn(_logger, "VAsioPeer: Cannot use shared memory segment '{}' offered by '{}': {}",
+                                segmentName, _info.participantName, error.what());
+
+        SendSharedMemoryUpgrade(SharedMemoryUpgrade::REJECT, {});
+        return;
+    }
+
+    SendSharedMemoryUpgrade(SharedMemoryUpgrade::ACCEPT, {});
 }
 
 
@@ -253,6 +1063,8 @@ void VAsioPeer::OnAsyncReadSomeDone(IRawByteStream& stream, size_t bytesTransfer
 
     _wPos += bytesTransferred;
     DispatchBuffer();
+    DeliverReceivedMessages();
+    SampleRoundTripTime();
 }
 
 
@@ -261,34 +1073,74 @@ void VAsioPeer::OnAsyncWriteSomeDone(IRawByteStream& stream, size_t bytesTransfe
     SILKIT_UNUSED_ARG(stream);
     SILKIT_TRACE_METHOD_(_logger, "({}, {})", static_cast<const void*>(&stream), bytesTransferred);
 
-    if (bytesTransferred <= _currentSendingBuffer.GetSize())
+    AddRelaxed(_numSentBytes, bytesTransferred);
+    SampleRoundTripTime();
+
+    for (size_t index = _currentSendingBufferIndex; index < _currentSendingBuffers.size() && bytesTransferred > 0;
+         ++index)
     {
-        _currentSendingBuffer.SliceOff(bytesTransferred);
+        auto& buffer = _currentSendingBuffers[index];
+        const auto slicedSize = std::min(bytesTransferred, buffer.GetSize());
+        buffer.SliceOff(slicedSize);
+        bytesTransferred -= slicedSize;
     }
 
-    if (_currentSendingBuffer.GetSize() != 0)
+    if (GetCurrentSendingBufferSize() != 0)
     {
         WriteSomeAsync();
         return;
     }
 
-    if (_isShuttingDown && _sendingQueue.empty())
+    if (_currentSendingEntries.back().switchToSharedMemory)
     {
-        _socket->Shutdown();
-        return;
+        _sharedMemoryStream->SwitchWriteToSharedMemory();
+
+        Services::Logging::Debug(_logger, "VAsioPeer: Sending to participant '{}' via shared memory",
+                                 _info.participantName);
     }
 
-    _sending = false;
+    AddRelaxed(_numSentMessages, _currentSendingEntries.size());
+
+    // release the written messages (and their shared payloads), but keep the capacity for the next batch
+    _currentSendingEntries.clear();
+    _currentSendingBuffers.clear();
+    _currentSendingBufferIndex = 0;
+
     StartAsyncWrite();
 }
 
 
+void VAsioPeer::SampleRoundTripTime()
+{
+    const auto now = std::chrono::steady_clock::now();
+    if (now < _nextRoundTripTimeSample)
+    {
+        return;
+    }
+
+    _nextRoundTripTimeSample = now + ROUND_TRIP_TIME_SAMPLE_INTERVAL;
+    _roundTripTime.store(_socket->GetRoundTripTime().count(), std::memory_order_relaxed);
+}
+
+
 void VAsioPeer::OnShutdown(IRawByteStream& stream)
 {
     SILKIT_UNUSED_ARG(stream);
     SILKIT_TRACE_METHOD_(_logger, "({})", static_cast<const void*>(&stream));
 
-    _listener->OnPeerShutdown(this);
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+        _socketShutdown = true;
+
+        // the last pending strand operation delivers the shutdown
+        if (_strandOperations != 0)
+        {
+            return;
+        }
+    }
+
+    DeliverShutdown();
 }
 
 
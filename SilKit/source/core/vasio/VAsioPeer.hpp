@@ -22,6 +22,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 
+#include <atomic>
+#include <chrono>
 #include <vector>
 #include <queue>
 #include <mutex>
@@ -29,20 +31,89 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "silkit/services/logging/ILogger.hpp"
 
+#include "ParticipantConfiguration.hpp"
+
 #include "IVAsioPeer.hpp"
 #include "EndpointAddress.hpp"
 #include "MessageBuffer.hpp"
+#include "MpscQueue.hpp"
 #include "VAsioPeerInfo.hpp"
 #include "ProtocolVersion.hpp"
 
 #include "IIoContext.hpp"
 #include "IRawByteStream.hpp"
+#include "impl/SharedMemoryRawByteStream.hpp"
 
 
 namespace SilKit {
 namespace Core {
 
 
+struct VAsioPeerSettings
+{
+    //! Maximum number of bytes coalesced into a single vectored write. Zero disables coalescing.
+    size_t sendBatchMaxBytes{64 * 1024};
+    //! Maximum number of buffers coalesced into a single vectored write. Zero disables coalescing.
+    size_t sendBatchMaxBuffers{64};
+    //! Move the traffic of local-domain socket connections into shared memory, if the remote peer supports it.
+    bool enableSharedMemory{false};
+    //! Capacity of each of the two ring buffers of a shared memory connection. Must be a power of two.
+    size_t sharedMemoryRingBufferCapacity{1024 * 1024};
+    //! The I/O context is run by multiple threads. Received messages and the shutdown are handed over to the main
+    //! strand of the I/O context, instead of being passed to the listener on the strand of the stream.
+    bool multiThreadedIo{false};
+    //! Messages larger than this number of bytes are compressed, if the remote peer supports it. Zero disables
+    //! compression. Messages are never compressed while the connection uses shared memory.
+    size_t compressionThreshold{0};
+    //! Limits of the sending queue, in bytes and in messages. Zero disables the respective limit.
+    size_t sendQueueMaxBytes{0};
+    size_t sendQueueMaxMessages{0};
+    //! Behavior once the sending queue reached one of its limits
+    Config::Middleware::SendQueueOverflowPolicy sendQueueOverflowPolicy{
+        Config::Middleware::SendQueueOverflowPolicy::Block};
+};
+
+//! Statistics about the coalesced writes issued by a VAsioPeer.
+struct VAsioPeerSendBatchStatistics
+{
+    uint64_t numBatches{0};
+    uint64_t numMessages{0};
+    uint64_t numBytes{0};
+    size_t maxBatchMessages{0};
+    size_t maxBatchBytes{0};
+    uint64_t numCompressedMessages{0};
+    //! Size of the compressed messages before and after the compression
+    uint64_t numUncompressedBytes{0};
+    uint64_t numCompressedBytes{0};
+};
+
+//! Statistics about the sending queue of a VAsioPeer.
+struct VAsioPeerSendQueueStatistics
+{
+    size_t queuedMessages{0};
+    size_t queuedBytes{0};
+    //! Largest queue observed by the writer
+    size_t maxQueuedMessages{0};
+    size_t maxQueuedBytes{0};
+    uint64_t numDroppedMessages{0};
+    //! Number of times the queue reached one of its limits
+    uint64_t numOverflows{0};
+};
+
+//! Traffic of a VAsioPeer. The counters can be read from any thread, without synchronizing with the I/O.
+struct VAsioPeerTrafficStatistics
+{
+    uint64_t numSentMessages{0};
+    //! Bytes written into the connection, after the compression
+    uint64_t numSentBytes{0};
+    uint64_t numReceivedMessages{0};
+    //! Bytes read from the connection, before the decompression
+    uint64_t numReceivedBytes{0};
+    //! Round-trip time estimated by the operating system (TCP only), sampled at most once per second
+    std::chrono::microseconds roundTripTime{0};
+};
+
+
 class VAsioPeer
     : public IVAsioPeer
     , private IRawByteStreamListener
@@ -62,7 +133,7 @@ public:
     VAsioPeer& operator=(VAsioPeer&& other) = delete; //implicitly deleted because of mutex
 
     VAsioPeer(IVAsioPeerListener* listener, IIoContext* ioContext, std::unique_ptr<IRawByteStream> stream,
-              Services::Logging::ILogger* logger);
+              Services::Logging::ILogger* logger, VAsioPeerSettings settings);
 
     ~VAsioPeer() override;
 
@@ -89,13 +160,81 @@ public:
 
     void Shutdown() override;
 
+    void StartSendBuffering() override;
+    void FlushSendBuffer() override;
+
+    //! Statistics about the coalesced writes issued so far
+    auto GetSendBatchStatistics() const -> VAsioPeerSendBatchStatistics;
+    //! Statistics about the sending queue
+    auto GetSendQueueStatistics() const -> VAsioPeerSendQueueStatistics;
+    //! Messages and bytes sent and received so far, and the round-trip time of the connection
+    auto GetTrafficStatistics() const -> VAsioPeerTrafficStatistics;
+    //! Returns true from the moment the sending queue reached one of its limits, until it drained to half of them.
+    auto IsSendQueueOverflowing() const -> bool;
+
+    //! Offer the remote peer to move this connection into shared memory. Does nothing, unless shared memory is
+    //! enabled, the connection uses a local-domain socket, and the remote peer announced the capability.
+    void StartSharedMemoryUpgrade();
+
+    //! Returns true if both directions of the connection use shared memory.
+    auto IsUsingSharedMemory() const -> bool;
+
+private:
+    // ----------------------------------------
+    // Private Data Types
+
+    //! Serialized message waiting in the sending queue. A shared payload is written directly after the data.
+    struct SendingQueueEntry
+    {
+        std::vector<uint8_t> data;
+        SharedPayload sharedPayload;
+        //! All data following this entry is written into shared memory. Always the last entry of a batch.
+        bool switchToSharedMemory{false};
+        //! The writer decided whether to compress the entry (and compressed it, if worthwhile)
+        bool compressionChecked{false};
+        //! Size accounted for in the limits of the sending queue (the size before compression)
+        size_t queuedSize{0};
+        //! Only user data may be discarded by the overflow policies, see SerializedMessage::IsUserData
+        bool isUserData{false};
+        //! Discarded by DropOldestMessages, the writer removes the entry without writing it
+        bool discarded{false};
+
+        auto GetBufferCount() const -> size_t { return sharedPayload ? 2 : 1; }
+        auto GetSize() const -> size_t { return data.size() + (sharedPayload ? sharedPayload->size() : 0); }
+    };
+
 private:
     // ----------------------------------------
     // Private Methods
+    auto GetCurrentSendingBufferSize() const -> size_t;
+    void ExecuteOnStrand(void (VAsioPeer::*method)());
+    void FinishStrandOperation();
+    void EnqueueMessage(SerializedMessage buffer, bool switchToSharedMemory);
+    //! Returns the first entry of the sending queue which has not been discarded (removing the discarded ones)
+    auto FrontSendingEntry() -> SendingQueueEntry*;
     void StartAsyncWrite();
+    auto IsSendQueueLimitReached(size_t additionalMessages, size_t additionalBytes) const -> bool;
+    void ScheduleSendQueueCheck();
+    void CheckSendQueue();
+    void DropOldestMessages();
+    void UpdateSendQueueOverflow();
+    void AccountDequeuedEntry(const SendingQueueEntry& entry);
+    void CompressEntry(SendingQueueEntry& entry);
+    auto DecompressMessage(std::vector<uint8_t>& buffer) -> bool;
     void WriteSomeAsync();
+    void StartReading();
     void ReadSomeAsync();
     void DispatchBuffer();
+    void DispatchMessage();
+    void DeliverReceivedMessages();
+    void DeliverShutdown();
+    auto AcquireMessageBuffer() -> std::vector<uint8_t>;
+    void RecycleMessageBuffer(std::vector<uint8_t> buffer);
+    void OfferSharedMemory();
+    void SendSharedMemoryUpgrade(SharedMemoryUpgrade::Status status, std::string segmentName);
+    void ReceiveSharedMemoryUpgrade(SerializedMessage& message);
+    void AcceptSharedMemoryUpgrade(const std::string& segmentName);
+    void SampleRoundTripTime();
 
 private: // IRawByteStreamListener
     void OnAsyncReadSomeDone(IRawByteStream& stream, size_t bytesTransferred) override;
@@ -109,26 +248,70 @@ private:
     IVAsioPeerListener* _listener{nullptr};
     IIoContext* _ioContext{nullptr};
     std::unique_ptr<IRawByteStream> _socket;
+    //! Strand of the socket, all reading and writing happens on it
+    IStrand* _strand{nullptr};
     VAsioPeerInfo _info;
 
     Services::Logging::ILogger* _logger;
+    VAsioPeerSettings _settings;
 
     std::atomic_bool _isShuttingDown{false};
 
     // receiving
     std::atomic<uint32_t> _currentMsgSize{0u};
     std::vector<uint8_t> _msgBuffer;
+    size_t _rPos{0};
     size_t _wPos{0};
     MutableBuffer _currentReceivingBuffer;
-
-    // sending
-    mutable std::mutex _sendingQueueMutex;
-    std::deque<std::vector<uint8_t>> _sendingQueue;
-    ConstBuffer _currentSendingBuffer;
-    std::vector<uint8_t> _currentSendingBufferData;
-
-    std::atomic_bool _sending{false};
+    std::vector<std::vector<uint8_t>> _messageBufferPool;
+    //! Messages waiting to be handed over to the main strand (only used if the I/O context is multi-threaded)
+    std::vector<SerializedMessage> _receivedMessages;
+
+    // sending (the mutex protects the statistics and the strand operation state below)
+    mutable std::mutex _mutex;
+    MpscQueue<SendingQueueEntry> _sendingQueue;
+    std::vector<SendingQueueEntry> _currentSendingEntries;
+    std::vector<ConstBuffer> _currentSendingBuffers;
+    size_t _currentSendingBufferIndex{0};
+    VAsioPeerSendBatchStatistics _sendBatchStatistics;
+    VAsioPeerSendQueueStatistics _sendQueueStatistics;
+    //! Scratch buffers of the writer for the compression of messages
+    std::vector<uint8_t> _compressionInput;
+    std::vector<uint8_t> _compressionOutput;
+
+    //! A write is in progress or scheduled on the strand. Only the thread setting the flag schedules the writer.
+    std::atomic<bool> _sending{false};
+    //! The data messages of a simulation step (see BufferedSendScope) are only queued, the writer is scheduled by
+    //! FlushSendBuffer, by any other message, or once the queue reaches its limits. A write in progress still picks
+    //! them up.
+    std::atomic<bool> _sendBuffering{false};
+    //! The remote peer announced the payload-compression capability, updated by SetInfo
+    std::atomic<bool> _remoteSupportsCompression{false};
+    //! Size of the sending queue, accounted by the producers and the writer
+    std::atomic<size_t> _queuedMessages{0};
+    std::atomic<size_t> _queuedBytes{0};
+    //! CheckSendQueue is scheduled on the strand. Only the thread setting the flag schedules it.
+    std::atomic<bool> _sendQueueCheckScheduled{false};
+    //! The sending queue reached one of its limits and did not drain to half of them yet, only updated on the strand
+    std::atomic<bool> _sendQueueOverflowing{false};
     Core::ServiceDescriptor _serviceDescriptor;
+
+    // traffic statistics, only updated on the strand, but read by any thread
+    std::atomic<uint64_t> _numSentMessages{0};
+    std::atomic<uint64_t> _numSentBytes{0};
+    std::atomic<uint64_t> _numReceivedMessages{0};
+    std::atomic<uint64_t> _numReceivedBytes{0};
+    std::atomic<std::chrono::microseconds::rep> _roundTripTime{0};
+    std::chrono::steady_clock::time_point _nextRoundTripTimeSample{};
+
+    // The listener is informed about the shutdown of the socket only after all functions dispatched to the strand have
+    // been executed, because it destroys the peer. Nothing is dispatched to the strand after the socket shut down.
+    size_t _strandOperations{0};
+    bool _socketShutdown{false};
+
+    // shared memory (only present for local-domain socket connections, if enabled)
+    SharedMemoryRawByteStream* _sharedMemoryStream{nullptr};
+    bool _sharedMemoryAcceptSent{false};
 };
 
 // ================================================================================
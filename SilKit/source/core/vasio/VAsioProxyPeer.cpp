@@ -99,6 +99,16 @@ void VAsioProxyPeer::Shutdown()
     Log::Debug(_logger, "VAsioProxyPeer ({}): Shutdown: Ignored", _peerInfo.participantName);
 }
 
+void VAsioProxyPeer::StartSendBuffering()
+{
+    // the messages are buffered by the peer connected to the registry
+}
+
+void VAsioProxyPeer::FlushSendBuffer()
+{
+    // the messages are buffered by the peer connected to the registry
+}
+
 void VAsioProxyPeer::SetProtocolVersion(ProtocolVersion v)
 {
     Log::Debug(_logger, "VAsioProxyPeer ({}): SetProtocolVersion: {}.{}", _peerInfo.participantName, v.major, v.minor);
@@ -139,6 +149,11 @@ void VAsioProxyPeer::OnPeerShutdown(IVAsioPeer *peer)
     _listener->OnPeerShutdown(peer);
 }
 
+void VAsioProxyPeer::OnPeerSendQueueOverflow(IVAsioPeer *peer, bool overflow)
+{
+    _listener->OnPeerSendQueueOverflow(peer, overflow);
+}
+
 // ================================================================================
 //  VAsioProxyPeer
 // ================================================================================
@@ -55,6 +55,8 @@ public: // IVAsioPeer
     auto GetLocalAddress() const -> std::string override;
     void StartAsyncRead() override;
     void Shutdown() override;
+    void StartSendBuffering() override;
+    void FlushSendBuffer() override;
     void SetProtocolVersion(ProtocolVersion v) override;
     auto GetProtocolVersion() const -> ProtocolVersion override;
 
@@ -65,6 +67,7 @@ public: // IVAsioPeer (IServiceEndpoint)
 public: // IVAsioPeerListener
     void OnSocketData(IVAsioPeer* from, SerializedMessage&& buffer) override;
     void OnPeerShutdown(IVAsioPeer* peer) override;
+    void OnPeerSendQueueOverflow(IVAsioPeer* peer, bool overflow) override;
 
 public:
     auto GetPeer() const -> IVAsioPeer*;
@@ -32,6 +32,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 namespace SilKit {
 namespace Core {
 
+//! Service of a remote participant, as seen by the local receivers of its messages.
 struct RemoteServiceEndpoint : IServiceEndpoint
 {
     void SetServiceDescriptor(const SilKit::Core::ServiceDescriptor&) override 
@@ -62,7 +63,7 @@ public:
     // Public interface methods
     virtual ~IVAsioReceiver() = default;
     virtual auto GetDescriptor() const -> const VAsioMsgSubscriber& = 0;
-    virtual void ReceiveRawMsg(IVAsioPeer* from, const ServiceDescriptor& descriptor, SerializedMessage&& buffer) = 0;
+    virtual void ReceiveRawMsg(IVAsioPeer* from, const IServiceEndpoint* remoteEndpoint, SerializedMessage&& buffer) = 0;
 };
 
 template <class MsgT>
@@ -79,7 +80,7 @@ public:
     // ----------------------------------------
     // Public interface methods
     auto GetDescriptor() const -> const VAsioMsgSubscriber& override;
-    void ReceiveRawMsg(IVAsioPeer* from, const ServiceDescriptor& descriptor, SerializedMessage&& buffer) override;
+    void ReceiveRawMsg(IVAsioPeer* from, const IServiceEndpoint* remoteEndpoint, SerializedMessage&& buffer) override;
     void SetServiceDescriptor(const ServiceDescriptor& serviceDescriptor) override
     {
         _serviceDescriptor = serviceDescriptor;
@@ -117,15 +118,14 @@ auto VAsioReceiver<MsgT>::GetDescriptor() const -> const VAsioMsgSubscriber&
 }
 
 template <class MsgT>
-void VAsioReceiver<MsgT>::ReceiveRawMsg(IVAsioPeer* /*from*/, const ServiceDescriptor& descriptor, SerializedMessage&& buffer)
+void VAsioReceiver<MsgT>::ReceiveRawMsg(IVAsioPeer* /*from*/, const IServiceEndpoint* remoteEndpoint,
+                                        SerializedMessage&& buffer)
 {
     MsgT msg = buffer.Deserialize<MsgT>();
 
-    Services::TraceRx(_logger, this, msg, descriptor);
-
-    auto remoteId = RemoteServiceEndpoint(descriptor);
-    _link->DistributeRemoteSilKitMessage(&remoteId, std::move(msg));
+    Services::TraceRx(_logger, this, msg, remoteEndpoint->GetServiceDescriptor());
 
+    _link->DistributeRemoteSilKitMessage(remoteEndpoint, std::move(msg));
 }
 
 } // namespace Core
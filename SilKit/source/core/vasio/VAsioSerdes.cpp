@@ -103,6 +103,30 @@ inline MessageBuffer& operator>>(MessageBuffer& buffer, SubscriptionAcknowledge&
     return buffer;
 }
 
+inline MessageBuffer& operator<<(MessageBuffer& buffer, const SubscriptionAnnouncementBatch& batch)
+{
+    buffer << batch.subscribers;
+    return buffer;
+}
+
+inline MessageBuffer& operator>>(MessageBuffer& buffer, SubscriptionAnnouncementBatch& batch)
+{
+    buffer >> batch.subscribers;
+    return buffer;
+}
+
+inline MessageBuffer& operator<<(MessageBuffer& buffer, const SubscriptionAcknowledgeBatch& batch)
+{
+    buffer << batch.acknowledges;
+    return buffer;
+}
+
+inline MessageBuffer& operator>>(MessageBuffer& buffer, SubscriptionAcknowledgeBatch& batch)
+{
+    buffer >> batch.acknowledges;
+    return buffer;
+}
+
 inline MessageBuffer& operator<<(MessageBuffer& buffer, const ParticipantAnnouncement& announcement)
 {
     // ParticipantAnnouncement is the first message sent during a handshake.
@@ -281,6 +305,24 @@ inline MessageBuffer& operator>>(MessageBuffer& buffer, ProxyMessage& out)
     return buffer;
 }
 
+inline MessageBuffer& operator>>(MessageBuffer& buffer, ProxyMessageRoute& out)
+{
+    //Backward compatibility with legacy peers
+    if (buffer.GetProtocolVersion() < ProtocolVersion{3,1})
+    {
+        throw SilKit::ProtocolError{"ProxyMessage is not supported in protocol versions < 3.1"};
+    }
+    else
+    {
+        buffer
+            >> out.header
+            >> out.source
+            >> out.destination
+            ;
+    }
+    return buffer;
+}
+
 
 inline MessageBuffer& operator<<(MessageBuffer& buffer, const RemoteParticipantConnectRequest& msg)
 {
@@ -301,6 +343,24 @@ inline MessageBuffer& operator>>(MessageBuffer& buffer, RemoteParticipantConnect
     return buffer;
 }
 
+
+inline MessageBuffer& operator<<(MessageBuffer& buffer, const SharedMemoryUpgrade& msg)
+{
+    buffer
+        << msg.messageHeader
+        << msg.status
+        << msg.segmentName;
+    return buffer;
+}
+inline MessageBuffer& operator>>(MessageBuffer& buffer, SharedMemoryUpgrade& out)
+{
+    buffer
+        >> out.messageHeader
+        >> out.status
+        >> out.segmentName;
+    return buffer;
+}
+
 //////////////////////////////////////////////////////////////////////
 // Public Functions
 //////////////////////////////////////////////////////////////////////
@@ -336,6 +396,15 @@ auto PeekProxyMessageHeader(MessageBuffer& buffer) -> ProxyMessageHeader
     return header;
 }
 
+auto PeekProxyMessageRoute(MessageBuffer& buffer) -> ProxyMessageRoute
+{
+    MessageBufferPeeker peeker{buffer};
+
+    ProxyMessageRoute route{};
+    buffer >> route;
+    return route;
+}
+
 auto PeekRegistryMessageHeader(MessageBuffer& buffer) -> RegistryMsgHeader
 {
     // NB: At the moment using the MessageBufferPeeker here -although correct- leads to an issue in the
@@ -408,6 +477,24 @@ void Deserialize(MessageBuffer& buffer, SubscriptionAcknowledge& out)
     buffer >> out;
 }
 
+void Serialize(MessageBuffer& buffer, const SubscriptionAnnouncementBatch& msg)
+{
+    buffer << msg;
+}
+void Deserialize(MessageBuffer& buffer, SubscriptionAnnouncementBatch& out)
+{
+    buffer >> out;
+}
+
+void Serialize(MessageBuffer& buffer, const SubscriptionAcknowledgeBatch& msg)
+{
+    buffer << msg;
+}
+void Deserialize(MessageBuffer& buffer, SubscriptionAcknowledgeBatch& out)
+{
+    buffer >> out;
+}
+
 void Serialize(MessageBuffer& buffer, const KnownParticipants& msg)
 {
     buffer << msg;
@@ -436,5 +523,15 @@ void Deserialize(MessageBuffer& buffer, RemoteParticipantConnectRequest& out)
     buffer >> out;
 }
 
+
+void Serialize(MessageBuffer& buffer, const SharedMemoryUpgrade& msg)
+{
+    buffer << msg;
+}
+void Deserialize(MessageBuffer& buffer, SharedMemoryUpgrade& out)
+{
+    buffer >> out;
+}
+
 } // namespace Core
 } // namespace SilKit
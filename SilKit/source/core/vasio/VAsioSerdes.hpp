@@ -42,6 +42,7 @@ auto ExtractRegistryMessageKind(MessageBuffer& buffer) -> RegistryMessageKind;
 
 auto PeekRegistryMessageHeader(MessageBuffer& buffer) -> RegistryMsgHeader;
 auto PeekProxyMessageHeader(MessageBuffer& buffer) -> ProxyMessageHeader;
+auto PeekProxyMessageRoute(MessageBuffer& buffer) -> ProxyMessageRoute;
 
 auto ExtractEndpointId(MessageBuffer& buffer) ->EndpointId;
 auto ExtractEndpointAddress(MessageBuffer& buffer) ->EndpointAddress;
@@ -52,17 +53,23 @@ void Serialize(MessageBuffer& buffer, const ParticipantAnnouncement& announcemen
 void Serialize(MessageBuffer& buffer, const ParticipantAnnouncementReply& reply);
 void Serialize(MessageBuffer& buffer, const VAsioMsgSubscriber& subscriber);
 void Serialize(MessageBuffer& buffer, const SubscriptionAcknowledge& msg);
+void Serialize(MessageBuffer& buffer, const SubscriptionAnnouncementBatch& msg);
+void Serialize(MessageBuffer& buffer, const SubscriptionAcknowledgeBatch& msg);
 void Serialize(MessageBuffer& buffer, const KnownParticipants& msg);
 void Serialize(MessageBuffer& buffer, const ProxyMessage& msg);
 void Serialize(MessageBuffer& buffer, const RemoteParticipantConnectRequest& msg);
+void Serialize(MessageBuffer& buffer, const SharedMemoryUpgrade& msg);
 
 void Deserialize(MessageBuffer& buffer, ParticipantAnnouncement& out);
 void Deserialize(MessageBuffer& buffer,ParticipantAnnouncementReply& out);
 void Deserialize(MessageBuffer&, VAsioMsgSubscriber&);
 void Deserialize(MessageBuffer&, SubscriptionAcknowledge&);
+void Deserialize(MessageBuffer&, SubscriptionAnnouncementBatch&);
+void Deserialize(MessageBuffer&, SubscriptionAcknowledgeBatch&);
 void Deserialize(MessageBuffer& buffer,KnownParticipants& out);
 void Deserialize(MessageBuffer& buffer, ProxyMessage& out);
 void Deserialize(MessageBuffer& buffer, RemoteParticipantConnectRequest& out);
+void Deserialize(MessageBuffer& buffer, SharedMemoryUpgrade& out);
 
 } // namespace Core
 } // namespace SilKit
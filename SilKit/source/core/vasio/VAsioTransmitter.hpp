@@ -166,10 +166,29 @@ public:
     void ReceiveMsg(const IServiceEndpoint* from, const MsgT& msg) override
     {
         _hist.Save(from, msg);
-        for (auto& receiver : _remoteReceivers)
+
+        if (_remoteReceivers.size() == 1)
         {
+            auto& receiver = _remoteReceivers.front();
             auto buffer = SerializedMessage(msg, to_endpointAddress(from->GetServiceDescriptor()), receiver.remoteIdx);
             receiver.peer->SendSilKitMsg(std::move(buffer));
+            return;
+        }
+
+        if (_remoteReceivers.empty())
+        {
+            return;
+        }
+
+        // Serialize the payload only once for all remote receivers. The receivers only differ in the remote index,
+        // which is part of the network headers.
+        const auto endpointAddress = to_endpointAddress(from->GetServiceDescriptor());
+        const auto sharedPayload = SerializedMessage::MakeSharedPayload(msg);
+        for (auto& receiver : _remoteReceivers)
+        {
+            auto buffer = SerializedMessage(messageKind<MsgT>(), endpointAddress, receiver.remoteIdx, sharedPayload,
+                                            SilKitMsgTraits<MsgT>::IsUserData());
+            receiver.peer->SendSilKitMsg(std::move(buffer));
         }
     }
 
@@ -12,6 +12,7 @@ struct AsioSocketOptions
         bool noDelay{false};
         int receiveBufferSize{-1};
         int sendBufferSize{-1};
+        int busyPollMicroseconds{0};
     } tcp;
 };
 
@@ -3,6 +3,7 @@
 
 #include "IAcceptor.hpp"
 #include "IConnector.hpp"
+#include "IStrand.hpp"
 #include "ITimer.hpp"
 
 #include "ILogger.hpp"
@@ -16,16 +17,14 @@
 namespace VSilKit {
 
 
-struct IIoContext
+//! The Post and Dispatch methods of the I/O context itself execute the functions on its main strand. The acceptors,
+//! connectors, and timers created by the I/O context invoke their listeners on the main strand, too.
+struct IIoContext : IStrand
 {
     virtual ~IIoContext() = default;
 
     virtual void Run() = 0;
 
-    virtual void Post(std::function<void()> function) = 0;
-
-    virtual void Dispatch(std::function<void()> function) = 0;
-
     virtual auto MakeTcpAcceptor(const std::string& address, uint16_t port) -> std::unique_ptr<IAcceptor> = 0;
 
     virtual auto MakeLocalAcceptor(const std::string& path) -> std::unique_ptr<IAcceptor> = 0;
@@ -39,6 +38,9 @@ struct IIoContext
     virtual auto Resolve(const std::string& name) -> std::vector<std::string> = 0;
 
     virtual void SetLogger(SilKit::Services::Logging::ILogger& logger) = 0;
+
+    //! Returns true if the calling thread is one of the threads running the I/O context.
+    virtual auto IsRunningInThisThread() const -> bool = 0;
 };
 
 
@@ -3,11 +3,14 @@
 
 #include "util/Buffer.hpp"
 
+#include <chrono>
+
 
 namespace VSilKit {
 
 
 struct IIoContext;
+struct IStrand;
 struct IRawByteStreamListener;
 
 
@@ -21,11 +24,18 @@ struct IRawByteStream
 
     virtual auto GetRemoteEndpoint() const -> std::string = 0;
 
+    //! The strand executing the listener callbacks of this stream.
+    virtual auto GetStrand() -> IStrand& = 0;
+
     virtual void AsyncReadSome(MutableBufferSequence bufferSequence) = 0;
 
     virtual void AsyncWriteSome(ConstBufferSequence bufferSequence) = 0;
 
     virtual void Shutdown() = 0;
+
+    //! Round-trip time of the connection as estimated by the operating system, or zero if there is no estimate (e.g.,
+    //! for local-domain sockets).
+    virtual auto GetRoundTripTime() const -> std::chrono::microseconds = 0;
 };
 
 
@@ -0,0 +1,31 @@
+#pragma once
+
+
+#include "IoTask.hpp"
+
+
+namespace VSilKit {
+
+
+//! Executes tasks sequentially, in the order in which they were posted. Tasks of different strands may be
+//! executed concurrently, if the I/O context is run by multiple threads.
+struct IStrand
+{
+    virtual ~IStrand() = default;
+
+    //! Execute the task later, never from within this call.
+    virtual void Post(IoTask task) = 0;
+
+    //! Execute the task immediately, if called from within this strand, otherwise behave like Post.
+    virtual void Dispatch(IoTask task) = 0;
+};
+
+
+} // namespace VSilKit
+
+
+namespace SilKit {
+namespace Core {
+using VSilKit::IStrand;
+} // namespace Core
+} // namespace SilKit
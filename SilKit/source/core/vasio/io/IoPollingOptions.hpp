@@ -0,0 +1,26 @@
+#pragma once
+
+
+#include <chrono>
+
+
+namespace VSilKit {
+
+
+struct IoPollingOptions
+{
+    //! If true, Run polls for ready handlers instead of blocking until the next handler becomes ready.
+    bool enabled{false};
+    //! Duration without any ready handlers, after which Run blocks until the next handler becomes ready.
+    std::chrono::microseconds spinDuration{200};
+};
+
+
+} // namespace VSilKit
+
+
+namespace SilKit {
+namespace Core {
+using VSilKit::IoPollingOptions;
+} // namespace Core
+} // namespace SilKit
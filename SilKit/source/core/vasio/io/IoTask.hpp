@@ -0,0 +1,201 @@
+#pragma once
+
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+namespace VSilKit {
+
+
+//! Move-only, type-erased function which is posted to an I/O context or a strand.
+//!
+//! Unlike std::function, the function object may be move-only, and function objects of up to InlineSize bytes are
+//! stored inside the task itself. Posting a small lambda therefore does not allocate, and captured messages are moved
+//! along with the task instead of being copied.
+class IoTask
+{
+public:
+    static constexpr size_t InlineSize = 112;
+
+public:
+    IoTask() noexcept = default;
+
+    IoTask(std::nullptr_t) noexcept {}
+
+    template <typename FunctionT,
+              typename = std::enable_if_t<!std::is_same<std::decay_t<FunctionT>, IoTask>::value
+                                          && !std::is_same<std::decay_t<FunctionT>, std::nullptr_t>::value>>
+    IoTask(FunctionT&& function)
+    {
+        using StoredT = std::decay_t<FunctionT>;
+        Emplace<StoredT>(std::forward<FunctionT>(function), std::integral_constant<bool, IsStoredInline<StoredT>()>{});
+    }
+
+    IoTask(IoTask&& other) noexcept
+    {
+        MoveFrom(other);
+    }
+
+    IoTask& operator=(IoTask&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    IoTask(const IoTask&) = delete;
+    IoTask& operator=(const IoTask&) = delete;
+
+    ~IoTask()
+    {
+        Reset();
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return _operations != nullptr;
+    }
+
+    void operator()()
+    {
+        _operations->invoke(&_storage);
+    }
+
+    //! Returns true if the function object is stored inside the task, i.e., no heap allocation was required.
+    auto IsInline() const noexcept -> bool
+    {
+        return _operations != nullptr && _operations->isInline;
+    }
+
+    template <typename FunctionT>
+    static constexpr auto IsStoredInline() -> bool
+    {
+        return sizeof(FunctionT) <= InlineSize && alignof(FunctionT) <= alignof(std::max_align_t)
+               && std::is_nothrow_move_constructible<FunctionT>::value;
+    }
+
+private:
+    using Storage = std::aligned_storage_t<InlineSize, alignof(std::max_align_t)>;
+
+    struct Operations
+    {
+        void (*invoke)(Storage*);
+        //! Move-construct the function object into the destination and destroy the source
+        void (*relocate)(Storage* destination, Storage* source) noexcept;
+        void (*destroy)(Storage*) noexcept;
+        bool isInline;
+    };
+
+    template <typename FunctionT>
+    struct InlineOperations
+    {
+        static auto Get(Storage* storage) -> FunctionT*
+        {
+            return reinterpret_cast<FunctionT*>(storage);
+        }
+
+        static void Invoke(Storage* storage)
+        {
+            (*Get(storage))();
+        }
+
+        static void Relocate(Storage* destination, Storage* source) noexcept
+        {
+            new (destination) FunctionT(std::move(*Get(source)));
+            Get(source)->~FunctionT();
+        }
+
+        static void Destroy(Storage* storage) noexcept
+        {
+            Get(storage)->~FunctionT();
+        }
+
+        static constexpr Operations operations{&Invoke, &Relocate, &Destroy, true};
+    };
+
+    template <typename FunctionT>
+    struct HeapOperations
+    {
+        static auto Get(Storage* storage) -> FunctionT*&
+        {
+            return *reinterpret_cast<FunctionT**>(storage);
+        }
+
+        static void Invoke(Storage* storage)
+        {
+            (*Get(storage))();
+        }
+
+        static void Relocate(Storage* destination, Storage* source) noexcept
+        {
+            new (destination) FunctionT*{Get(source)};
+        }
+
+        static void Destroy(Storage* storage) noexcept
+        {
+            delete Get(storage);
+        }
+
+        static constexpr Operations operations{&Invoke, &Relocate, &Destroy, false};
+    };
+
+    template <typename StoredT, typename FunctionT>
+    void Emplace(FunctionT&& function, std::true_type /* inline */)
+    {
+        new (&_storage) StoredT(std::forward<FunctionT>(function));
+        _operations = &InlineOperations<StoredT>::operations;
+    }
+
+    template <typename StoredT, typename FunctionT>
+    void Emplace(FunctionT&& function, std::false_type /* inline */)
+    {
+        new (&_storage) StoredT*{new StoredT(std::forward<FunctionT>(function))};
+        _operations = &HeapOperations<StoredT>::operations;
+    }
+
+    void MoveFrom(IoTask& other) noexcept
+    {
+        if (other._operations != nullptr)
+        {
+            other._operations->relocate(&_storage, &other._storage);
+            _operations = other._operations;
+            other._operations = nullptr;
+        }
+    }
+
+    void Reset() noexcept
+    {
+        if (_operations != nullptr)
+        {
+            _operations->destroy(&_storage);
+            _operations = nullptr;
+        }
+    }
+
+private:
+    Storage _storage;
+    const Operations* _operations{nullptr};
+};
+
+
+template <typename FunctionT>
+constexpr IoTask::Operations IoTask::InlineOperations<FunctionT>::operations;
+
+template <typename FunctionT>
+constexpr IoTask::Operations IoTask::HeapOperations<FunctionT>::operations;
+
+
+} // namespace VSilKit
+
+
+namespace SilKit {
+namespace Core {
+using VSilKit::IoTask;
+} // namespace Core
+} // namespace SilKit
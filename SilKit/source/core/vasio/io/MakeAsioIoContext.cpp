@@ -6,9 +6,10 @@
 namespace VSilKit {
 
 
-auto MakeAsioIoContext(const AsioSocketOptions& socketOptions) -> std::unique_ptr<IIoContext>
+auto MakeAsioIoContext(const AsioSocketOptions& socketOptions, size_t threadCount,
+                       const IoPollingOptions& pollingOptions) -> std::unique_ptr<IIoContext>
 {
-    return std::make_unique<AsioIoContext>(socketOptions);
+    return std::make_unique<AsioIoContext>(socketOptions, threadCount, pollingOptions);
 }
 
 
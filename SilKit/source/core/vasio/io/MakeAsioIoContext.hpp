@@ -3,6 +3,7 @@
 
 #include "IIoContext.hpp"
 #include "AsioSocketOptions.hpp"
+#include "IoPollingOptions.hpp"
 
 #include "ILogger.hpp"
 
@@ -12,7 +13,10 @@
 namespace VSilKit {
 
 
-auto MakeAsioIoContext(const AsioSocketOptions& socketOptions) -> std::unique_ptr<IIoContext>;
+//! Create an I/O context which executes its handlers on the given number of threads, once Run is called.
+//! If polling is enabled, the threads spin while waiting for handlers, see IoPollingOptions.
+auto MakeAsioIoContext(const AsioSocketOptions& socketOptions, size_t threadCount = 1,
+                       const IoPollingOptions& pollingOptions = {}) -> std::unique_ptr<IIoContext>;
 
 
 } // namespace VSilKit
@@ -0,0 +1,41 @@
+#include "MakeUringIoContext.hpp"
+
+#include "silkit/participant/exception.hpp"
+
+#if defined(__linux__)
+#    include "impl/UringIoContext.hpp"
+#endif
+
+
+namespace VSilKit {
+
+
+#if defined(__linux__)
+
+auto IsUringIoContextSupported() -> bool
+{
+    return UringIoContext::IsSupported();
+}
+
+auto MakeUringIoContext(const AsioSocketOptions& socketOptions, size_t threadCount,
+                        const IoPollingOptions& pollingOptions) -> std::unique_ptr<IIoContext>
+{
+    return std::make_unique<UringIoContext>(socketOptions, threadCount, pollingOptions);
+}
+
+#else
+
+auto IsUringIoContextSupported() -> bool
+{
+    return false;
+}
+
+auto MakeUringIoContext(const AsioSocketOptions&, size_t, const IoPollingOptions&) -> std::unique_ptr<IIoContext>
+{
+    throw SilKit::SilKitError{"MakeUringIoContext: io_uring is not supported on this platform"};
+}
+
+#endif
+
+
+} // namespace VSilKit
@@ -0,0 +1,30 @@
+#pragma once
+
+
+#include "IIoContext.hpp"
+#include "AsioSocketOptions.hpp"
+#include "IoPollingOptions.hpp"
+
+#include <memory>
+
+
+namespace VSilKit {
+
+
+//! Returns true if the I/O context driven by io_uring is available on this system (Linux only).
+auto IsUringIoContextSupported() -> bool;
+
+//! Create an I/O context which drives the sockets of its connections through io_uring. Throws if it is not supported.
+auto MakeUringIoContext(const AsioSocketOptions& socketOptions, size_t threadCount = 1,
+                        const IoPollingOptions& pollingOptions = {}) -> std::unique_ptr<IIoContext>;
+
+
+} // namespace VSilKit
+
+
+namespace SilKit {
+namespace Core {
+using VSilKit::IsUringIoContextSupported;
+using VSilKit::MakeUringIoContext;
+} // namespace Core
+} // namespace SilKit
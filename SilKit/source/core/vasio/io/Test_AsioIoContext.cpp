@@ -22,6 +22,8 @@
 
 #include "MakeAsioIoContext.hpp"
 
+#include <atomic>
+
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
@@ -74,5 +76,37 @@ TEST(Test_AsioIoContext, make_io_context_with_default_socket_options)
     CheckIoContextPostBeforeRunIsExecutedAtRun(*ioContext);
 }
 
+TEST(Test_AsioIoContext, handlers_are_serialized_with_multiple_threads)
+{
+    VSilKit::AsioSocketOptions asioSocketOptions{};
+    auto ioContext{VSilKit::MakeAsioIoContext(asioSocketOptions, 4)};
+
+    // sanity checks
+    CheckIoContextDispatchBeforeRunIsExecutedAtRun(*ioContext);
+    CheckIoContextPostBeforeRunIsExecutedAtRun(*ioContext);
+
+    constexpr int count{10000};
+    std::atomic<bool> inside{false};
+    std::atomic<int> overlaps{0};
+    int counter{0};
+
+    for (int index = 0; index != count; ++index)
+    {
+        ioContext->Post([&] {
+            if (inside.exchange(true))
+            {
+                ++overlaps;
+            }
+            ++counter;
+            inside = false;
+        });
+    }
+
+    ioContext->Run();
+
+    EXPECT_EQ(counter, count);
+    EXPECT_EQ(overlaps, 0);
+}
+
 
 } // namespace
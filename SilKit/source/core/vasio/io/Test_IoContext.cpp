@@ -22,6 +22,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "Uri.hpp"
 #include "core/vasio/io/MakeAsioIoContext.hpp"
+#include "core/vasio/io/MakeUringIoContext.hpp"
 #include "Filesystem.hpp"
 #include "Uuid.hpp"
 
@@ -35,6 +36,12 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
 
 namespace {
 
@@ -61,14 +68,47 @@ struct MockCallbacks
 };
 
 
-struct Test_IoContext : ::testing::Test
+//! The I/O context implementations, all tests run against each of them.
+struct IoContextBackend
+{
+    std::string name;
+    std::function<bool()> isSupported;
+    std::function<std::unique_ptr<VSilKit::IIoContext>()> makeIoContext;
+};
+
+auto MakeIoContextBackends() -> std::vector<IoContextBackend>
+{
+    VSilKit::IoPollingOptions pollingOptions{};
+    pollingOptions.enabled = true;
+    pollingOptions.spinDuration = std::chrono::microseconds{50};
+
+    return {
+        IoContextBackend{"Asio", [] { return true; }, [] { return VSilKit::MakeAsioIoContext({}); }},
+        IoContextBackend{"AsioPolling", [] { return true; },
+                         [pollingOptions] { return VSilKit::MakeAsioIoContext({}, 1, pollingOptions); }},
+        IoContextBackend{"IoUring", &VSilKit::IsUringIoContextSupported, [] { return VSilKit::MakeUringIoContext({}); }},
+    };
+}
+
+
+struct Test_IoContext : ::testing::TestWithParam<IoContextBackend>
 {
     std::string acceptorLocalDomainSocketPath;
 
+    auto MakeIoContext() -> std::unique_ptr<VSilKit::IIoContext>
+    {
+        return GetParam().makeIoContext();
+    }
+
     void SetUp() override
     {
         namespace fs = SilKit::Filesystem;
 
+        if (!GetParam().isSupported())
+        {
+            GTEST_SKIP() << GetParam().name << " is not supported on this system";
+        }
+
         acceptorLocalDomainSocketPath = fs::temp_directory_path().string() + fs::path::preferred_separator
                                         + to_string(SilKit::Util::Uuid::GenerateRandom()) + ".silkit";
     }
@@ -88,7 +128,7 @@ struct Test_IoContext : ::testing::Test
 };
 
 
-TEST_F(Test_IoContext, sequential_post_keeps_order)
+TEST_P(Test_IoContext, sequential_post_keeps_order)
 {
     MockCallbacks callbacks;
 
@@ -96,7 +136,7 @@ TEST_F(Test_IoContext, sequential_post_keeps_order)
     EXPECT_CALL(callbacks, Handle(0)).Times(1).InSequence(s1);
     EXPECT_CALL(callbacks, Handle(1)).Times(1).InSequence(s1);
 
-    auto ioContext = VSilKit::MakeAsioIoContext({});
+    auto ioContext = MakeIoContext();
 
     ioContext->Post([&callbacks]() {
         callbacks.Handle(0);
@@ -109,7 +149,7 @@ TEST_F(Test_IoContext, sequential_post_keeps_order)
     ioContext->Run();
 }
 
-TEST_F(Test_IoContext, nested_post_is_executed_last)
+TEST_P(Test_IoContext, nested_post_is_executed_last)
 {
     MockCallbacks callbacks;
 
@@ -119,7 +159,7 @@ TEST_F(Test_IoContext, nested_post_is_executed_last)
     EXPECT_CALL(callbacks, Handle(2)).Times(1).InSequence(s1);
     EXPECT_CALL(callbacks, Handle(3)).Times(1).InSequence(s1);
 
-    auto ioContext = VSilKit::MakeAsioIoContext({});
+    auto ioContext = MakeIoContext();
 
     ioContext->Post([&ioContext, &callbacks]() {
         callbacks.Handle(0);
@@ -136,7 +176,7 @@ TEST_F(Test_IoContext, nested_post_is_executed_last)
     ioContext->Run();
 }
 
-TEST_F(Test_IoContext, sequential_dispatch_keeps_order)
+TEST_P(Test_IoContext, sequential_dispatch_keeps_order)
 {
     MockCallbacks callbacks;
 
@@ -144,7 +184,7 @@ TEST_F(Test_IoContext, sequential_dispatch_keeps_order)
     EXPECT_CALL(callbacks, Handle(0)).Times(1).InSequence(s1);
     EXPECT_CALL(callbacks, Handle(1)).Times(1).InSequence(s1);
 
-    auto ioContext = VSilKit::MakeAsioIoContext({});
+    auto ioContext = MakeIoContext();
 
     ioContext->Dispatch([&callbacks]() {
         callbacks.Handle(0);
@@ -157,7 +197,7 @@ TEST_F(Test_IoContext, sequential_dispatch_keeps_order)
     ioContext->Run();
 }
 
-TEST_F(Test_IoContext, nested_dispatch_is_executed_immediately)
+TEST_P(Test_IoContext, nested_dispatch_is_executed_immediately)
 {
     MockCallbacks callbacks;
 
@@ -167,7 +207,7 @@ TEST_F(Test_IoContext, nested_dispatch_is_executed_immediately)
     EXPECT_CALL(callbacks, Handle(2)).Times(1).InSequence(s1);
     EXPECT_CALL(callbacks, Handle(3)).Times(1).InSequence(s1);
 
-    auto ioContext = VSilKit::MakeAsioIoContext({});
+    auto ioContext = MakeIoContext();
 
     ioContext->Dispatch([&ioContext, &callbacks]() {
         callbacks.Handle(0);
@@ -184,9 +224,9 @@ TEST_F(Test_IoContext, nested_dispatch_is_executed_immediately)
     ioContext->Run();
 }
 
-TEST_F(Test_IoContext, resolve)
+TEST_P(Test_IoContext, resolve)
 {
-    auto ioContext = VSilKit::MakeAsioIoContext({});
+    auto ioContext = MakeIoContext();
 
     auto resolveStrings = ioContext->Resolve("localhost");
 
@@ -194,9 +234,9 @@ TEST_F(Test_IoContext, resolve)
     EXPECT_THAT(resolveStrings, AnyOf(Contains("127.0.0.1"), Contains("::1")));
 }
 
-TEST_F(Test_IoContext, timers_execute_and_wait)
+TEST_P(Test_IoContext, timers_execute_and_wait)
 {
-    auto ioContext = VSilKit::MakeAsioIoContext({});
+    auto ioContext = MakeIoContext();
 
     auto timer1 = ioContext->MakeTimer();
     auto timer2 = ioContext->MakeTimer();
@@ -230,13 +270,13 @@ TEST_F(Test_IoContext, timers_execute_and_wait)
     EXPECT_GE(nestedWaitExpired - beforeNestedWait, 20ms);
 }
 
-TEST_F(Test_IoContext, timer_expires_with_zero_wait_duration)
+TEST_P(Test_IoContext, timer_expires_with_zero_wait_duration)
 {
     MockTimerListener listener1;
 
     EXPECT_CALL(listener1, OnTimerExpired).Times(1);
 
-    auto ioContext = VSilKit::MakeAsioIoContext({});
+    auto ioContext = MakeIoContext();
 
     auto timer1 = ioContext->MakeTimer();
     timer1->SetListener(listener1);
@@ -245,13 +285,13 @@ TEST_F(Test_IoContext, timer_expires_with_zero_wait_duration)
     ioContext->Run();
 }
 
-TEST_F(Test_IoContext, tcp_acceptor_timeout)
+TEST_P(Test_IoContext, tcp_acceptor_timeout)
 {
     MockAcceptorListener listener;
     EXPECT_CALL(listener, OnAsyncAcceptSuccess).Times(0);
     EXPECT_CALL(listener, OnAsyncAcceptFailure).Times(1);
 
-    auto ioContext{VSilKit::MakeAsioIoContext({})};
+    auto ioContext{MakeIoContext()};
 
     auto acceptor{ioContext->MakeTcpAcceptor("127.0.0.1", 0)};
     acceptor->SetListener(listener);
@@ -260,13 +300,13 @@ TEST_F(Test_IoContext, tcp_acceptor_timeout)
     ioContext->Run();
 }
 
-TEST_F(Test_IoContext, local_domain_acceptor_timeout)
+TEST_P(Test_IoContext, local_domain_acceptor_timeout)
 {
     MockAcceptorListener listener;
     EXPECT_CALL(listener, OnAsyncAcceptSuccess).Times(0);
     EXPECT_CALL(listener, OnAsyncAcceptFailure).Times(1);
 
-    auto ioContext{VSilKit::MakeAsioIoContext({})};
+    auto ioContext{MakeIoContext()};
 
     auto acceptor{ioContext->MakeLocalAcceptor(acceptorLocalDomainSocketPath)};
     acceptor->SetListener(listener);
@@ -367,11 +407,11 @@ struct Test_IoContext_AcceptorConnector_PingPong : Test_IoContext
     }
 };
 
-TEST_F(Test_IoContext_AcceptorConnector_PingPong, tcp)
+TEST_P(Test_IoContext_AcceptorConnector_PingPong, tcp)
 {
     SetupExpectations();
 
-    auto ioContext = VSilKit::MakeAsioIoContext({});
+    auto ioContext = MakeIoContext();
     ioContext->SetLogger(logger);
 
     auto acceptor = ioContext->MakeTcpAcceptor("127.0.0.1", 0);
@@ -390,11 +430,11 @@ TEST_F(Test_IoContext_AcceptorConnector_PingPong, tcp)
     ioContext->Run();
 }
 
-TEST_F(Test_IoContext_AcceptorConnector_PingPong, local_domain)
+TEST_P(Test_IoContext_AcceptorConnector_PingPong, local_domain)
 {
     SetupExpectations();
 
-    auto ioContext = VSilKit::MakeAsioIoContext({});
+    auto ioContext = MakeIoContext();
     ioContext->SetLogger(logger);
 
     auto acceptor = ioContext->MakeLocalAcceptor(acceptorLocalDomainSocketPath);
@@ -413,4 +453,11 @@ TEST_F(Test_IoContext_AcceptorConnector_PingPong, local_domain)
     ioContext->Run();
 }
 
-} // namespace
\ No newline at end of file
+INSTANTIATE_TEST_SUITE_P(Test_IoContext, Test_IoContext, ::testing::ValuesIn(MakeIoContextBackends()),
+                         [](const auto& info) { return info.param.name; });
+
+INSTANTIATE_TEST_SUITE_P(Test_IoContext, Test_IoContext_AcceptorConnector_PingPong,
+                         ::testing::ValuesIn(MakeIoContextBackends()), [](const auto& info) { return info.param.name; });
+
+
+} // namespace
@@ -0,0 +1,171 @@
+// Copyright (c) 2022 Vector Informatik GmbH
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+// LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+// OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "IoTask.hpp"
+#include "impl/AsioTaskHandler.hpp"
+
+#include <array>
+#include <functional>
+#include <memory>
+
+#include "gtest/gtest.h"
+
+
+namespace {
+
+
+using VSilKit::IoTask;
+using VSilKit::TaskMemoryPool;
+
+
+//! Counts the instances which are alive, to detect leaked or doubly destroyed function objects
+struct Counted
+{
+    static int instances;
+
+    Counted()
+    {
+        ++instances;
+    }
+
+    Counted(const Counted&)
+    {
+        ++instances;
+    }
+
+    Counted(Counted&&) noexcept
+    {
+        ++instances;
+    }
+
+    ~Counted()
+    {
+        --instances;
+    }
+};
+
+int Counted::instances{0};
+
+
+TEST(Test_IoTask, small_function_is_stored_inline)
+{
+    int value{0};
+    IoTask task{[&value] {
+        value = 42;
+    }};
+
+    ASSERT_TRUE(task);
+    EXPECT_TRUE(task.IsInline());
+
+    task();
+    EXPECT_EQ(value, 42);
+}
+
+TEST(Test_IoTask, large_function_is_stored_on_the_heap)
+{
+    std::array<char, IoTask::InlineSize + 1> large{};
+    large[0] = 'x';
+
+    char value{0};
+    IoTask task{[&value, large] {
+        value = large[0];
+    }};
+
+    EXPECT_FALSE(task.IsInline());
+
+    IoTask moved{std::move(task)};
+    EXPECT_FALSE(task);
+
+    moved();
+    EXPECT_EQ(value, 'x');
+}
+
+TEST(Test_IoTask, move_only_function)
+{
+    auto pointer = std::make_unique<int>(7);
+
+    int value{0};
+    IoTask task{[&value, pointer = std::move(pointer)] {
+        value = *pointer;
+    }};
+
+    IoTask moved;
+    moved = std::move(task);
+    EXPECT_FALSE(task);
+
+    moved();
+    EXPECT_EQ(value, 7);
+}
+
+TEST(Test_IoTask, function_objects_are_destroyed_exactly_once)
+{
+    {
+        Counted counted;
+        IoTask inlineTask{[counted] {}};
+
+        std::array<char, IoTask::InlineSize> padding{};
+        IoTask heapTask{[counted, padding] {}};
+
+        EXPECT_EQ(Counted::instances, 3);
+
+        IoTask movedInlineTask{std::move(inlineTask)};
+        IoTask movedHeapTask{std::move(heapTask)};
+        EXPECT_EQ(Counted::instances, 3);
+
+        movedInlineTask = nullptr;
+        EXPECT_EQ(Counted::instances, 2);
+    }
+
+    EXPECT_EQ(Counted::instances, 0);
+}
+
+TEST(Test_IoTask, std_function_is_accepted)
+{
+    int value{0};
+    std::function<void()> function{[&value] {
+        ++value;
+    }};
+
+    IoTask task{function};
+    task();
+    function();
+
+    EXPECT_EQ(value, 2);
+}
+
+TEST(Test_IoTask, task_memory_pool_recycles_blocks)
+{
+    auto* first = TaskMemoryPool::Allocate(TaskMemoryPool::BlockSize);
+    TaskMemoryPool::Deallocate(first, TaskMemoryPool::BlockSize);
+
+    auto* second = TaskMemoryPool::Allocate(TaskMemoryPool::BlockSize / 2);
+    EXPECT_EQ(second, first);
+    TaskMemoryPool::Deallocate(second, TaskMemoryPool::BlockSize / 2);
+
+    // larger requests are not pooled
+    auto* large = TaskMemoryPool::Allocate(TaskMemoryPool::BlockSize + 1);
+    EXPECT_NE(large, nullptr);
+    TaskMemoryPool::Deallocate(large, TaskMemoryPool::BlockSize + 1);
+}
+
+
+} // anonymous namespace
@@ -50,6 +50,7 @@ class AsioAcceptor final : public IAcceptor
     AsioSocketOptions _socketOptions;
 
     std::shared_ptr<asio::io_context> _asioIoContext;
+    size_t _threadCount{1};
 
     AsioAcceptorType _acceptor;
     asio::cancellation_signal _acceptCancelSignal;
@@ -63,7 +64,7 @@ class AsioAcceptor final : public IAcceptor
 
 public:
     AsioAcceptor(const AsioSocketOptions& socketOptions, std::shared_ptr<asio::io_context> asioIoContext,
-                 AsioAcceptorType acceptor, SilKit::Services::Logging::ILogger& logger);
+                 size_t threadCount, AsioAcceptorType acceptor, SilKit::Services::Logging::ILogger& logger);
     ~AsioAcceptor() override;
 
 public: // IAcceptor
@@ -80,9 +81,10 @@ private:
 
 template <typename T>
 AsioAcceptor<T>::AsioAcceptor(const AsioSocketOptions& socketOptions, std::shared_ptr<asio::io_context> asioIoContext,
-                              AsioAcceptorType acceptor, SilKit::Services::Logging::ILogger& logger)
+                              size_t threadCount, AsioAcceptorType acceptor, SilKit::Services::Logging::ILogger& logger)
     : _socketOptions{socketOptions}
     , _asioIoContext{std::move(asioIoContext)}
+    , _threadCount{threadCount}
     , _acceptor{std::move(acceptor)}
     , _timeoutTimer{_acceptor.get_executor()}
     , _localEndpoint{_acceptor.local_endpoint()}
@@ -185,6 +187,7 @@ void AsioAcceptor<T>::OnAsioAsyncAcceptComplete(const asio::error_code& asioErro
 
     AsioGenericRawByteStreamOptions options{};
     options.tcp.quickAck = isTcp && _socketOptions.tcp.quickAck;
+    options.threadCount = _threadCount;
 
     auto stream{std::make_unique<AsioGenericRawByteStream>(options, _asioIoContext, std::move(socket), *_logger)};
 
@@ -51,6 +51,7 @@ class AsioConnector final : public IConnector
         std::atomic<AsioConnector*> _parent;
 
         std::weak_ptr<asio::io_context> _asioIoContext;
+        size_t _threadCount{1};
         AsioSocketOptions _asioSocketOptions;
         AsioEndpointType _remoteEndpoint;
 
@@ -82,6 +83,8 @@ class AsioConnector final : public IConnector
     };
 
     std::shared_ptr<asio::io_context> _asioIoContext;
+    size_t _threadCount{1};
+    asio::any_io_executor _executor;
     SilKit::Services::Logging::ILogger* _logger{nullptr};
 
     IConnectorListener* _listener{nullptr};
@@ -89,8 +92,9 @@ class AsioConnector final : public IConnector
     std::shared_ptr<Op> _op;
 
 public:
-    AsioConnector(std::shared_ptr<asio::io_context> asioIoContext, const AsioSocketOptions& socketOptions,
-                  const AsioEndpointType& remoteEndpoint, SilKit::Services::Logging::ILogger& logger);
+    AsioConnector(std::shared_ptr<asio::io_context> asioIoContext, size_t threadCount, asio::any_io_executor executor,
+                  const AsioSocketOptions& socketOptions, const AsioEndpointType& remoteEndpoint,
+                  SilKit::Services::Logging::ILogger& logger);
     ~AsioConnector() override;
 
 public: // IAcceptor
@@ -101,9 +105,12 @@ public: // IAcceptor
 
 
 template <typename T>
-AsioConnector<T>::AsioConnector(std::shared_ptr<asio::io_context> asioIoContext, const AsioSocketOptions& socketOptions,
+AsioConnector<T>::AsioConnector(std::shared_ptr<asio::io_context> asioIoContext, size_t threadCount,
+                                asio::any_io_executor executor, const AsioSocketOptions& socketOptions,
                                 const AsioEndpointType& remoteEndpoint, SilKit::Services::Logging::ILogger& logger)
     : _asioIoContext{std::move(asioIoContext)}
+    , _threadCount{threadCount}
+    , _executor{std::move(executor)}
     , _logger{&logger}
     , _op{std::make_shared<Op>(*this, socketOptions, remoteEndpoint)}
 {
@@ -153,10 +160,11 @@ AsioConnector<T>::Op::Op(AsioConnector& connector, const AsioSocketOptions& asio
                          const AsioEndpointType& remoteEndpoint)
     : _parent{&connector}
     , _asioIoContext{connector._asioIoContext}
+    , _threadCount{connector._threadCount}
     , _asioSocketOptions{asioSocketOptions}
     , _remoteEndpoint{remoteEndpoint}
-    , _socket{*connector._asioIoContext}
-    , _timeoutTimer{*connector._asioIoContext}
+    , _socket{connector._executor}
+    , _timeoutTimer{connector._executor}
     , _logger{connector._logger}
 {
     SILKIT_TRACE_METHOD_(_logger, "(...)");
@@ -284,6 +292,7 @@ void AsioConnector<T>::Op::OnAsioAsyncConnectComplete(const asio::error_code& as
 
     AsioGenericRawByteStreamOptions options{};
     options.tcp.quickAck = isTcp && _asioSocketOptions.tcp.quickAck;
+    options.threadCount = _threadCount;
 
     auto stream{
         std::make_unique<AsioGenericRawByteStream>(options, std::move(asioIoContext), std::move(socket), *_logger)};
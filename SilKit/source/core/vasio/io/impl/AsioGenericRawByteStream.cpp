@@ -1,6 +1,7 @@
 #include "AsioGenericRawByteStream.hpp"
 
 #include "AsioFormatEndpoint.hpp"
+#include "SocketRoundTripTime.hpp"
 #include "IIoContext.hpp"
 
 #include "util/Atomic.hpp"
@@ -56,6 +57,7 @@ AsioGenericRawByteStream::AsioGenericRawByteStream(const AsioGenericRawByteStrea
                                                    SilKit::Services::Logging::ILogger& logger)
     : _options{options}
     , _asioIoContext{std::move(asioIoContext)}
+    , _strand{*_asioIoContext, _options.threadCount}
     , _socket{std::move(socket)}
     , _logger{&logger}
 {
@@ -71,6 +73,30 @@ AsioGenericRawByteStream::~AsioGenericRawByteStream()
 }
 
 
+auto AsioGenericRawByteStream::GetNativeHandle() -> int
+{
+    return static_cast<int>(_socket.native_handle());
+}
+
+
+void AsioGenericRawByteStream::ReleaseNativeHandle()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    if (_reading || _writing)
+    {
+        throw InvalidStateError{};
+    }
+
+    _shutdownPending = true;
+    _shutdownPosted = true;
+
+    (void)_socket.release();
+}
+
+
 void AsioGenericRawByteStream::SetListener(IRawByteStreamListener& listener)
 {
     SILKIT_TRACE_METHOD_(_logger, "({})", static_cast<const void*>(&listener));
@@ -93,6 +119,19 @@ auto AsioGenericRawByteStream::GetRemoteEndpoint() const -> std::string
 }
 
 
+auto AsioGenericRawByteStream::GetRoundTripTime() const -> std::chrono::microseconds
+{
+    // asio only provides non-const access to the native handle
+    return GetSocketRoundTripTime(static_cast<int>(const_cast<AsioSocket&>(_socket).native_handle()));
+}
+
+
+auto AsioGenericRawByteStream::GetStrand() -> IStrand&
+{
+    return _strand;
+}
+
+
 void AsioGenericRawByteStream::AsyncReadSome(MutableBufferSequence bufferSequence)
 {
     SILKIT_TRACE_METHOD_(_logger, "(...)");
@@ -121,9 +160,10 @@ void AsioGenericRawByteStream::AsyncReadSome(MutableBufferSequence bufferSequenc
                            return asio::mutable_buffer{buffer.GetData(), buffer.GetSize()};
                        });
 
-        _socket.async_read_some(_readBufferSequence, [this](const auto& e, auto s) {
-            OnAsioAsyncReadSomeComplete(e, s);
-        });
+        _socket.async_read_some(_readBufferSequence,
+                                asio::bind_executor(_strand.GetAsioExecutor(), [this](const auto& e, auto s) {
+                                    OnAsioAsyncReadSomeComplete(e, s);
+                                }));
     }
 }
 
@@ -156,9 +196,10 @@ void AsioGenericRawByteStream::AsyncWriteSome(ConstBufferSequence bufferSequence
                            return asio::const_buffer{buffer.GetData(), buffer.GetSize()};
                        });
 
-        _socket.async_write_some(_writeBufferSequence, [this](const auto& e, auto s) {
-            OnAsioAsyncWriteSomeComplete(e, s);
-        });
+        _socket.async_write_some(_writeBufferSequence,
+                                 asio::bind_executor(_strand.GetAsioExecutor(), [this](const auto& e, auto s) {
+                                     OnAsioAsyncWriteSomeComplete(e, s);
+                                 }));
     }
 }
 
@@ -203,9 +244,10 @@ void AsioGenericRawByteStream::OnAsioAsyncReadSomeComplete(asio::error_code cons
             // only re-trigger the read if no bytes were transferred, otherwise treat it as a 'normal' completion
 
             _reading = true;
-            _socket.async_read_some(_readBufferSequence, [this](const auto& e, auto s) {
-                OnAsioAsyncReadSomeComplete(e, s);
-            });
+            _socket.async_read_some(_readBufferSequence,
+                                    asio::bind_executor(_strand.GetAsioExecutor(), [this](const auto& e, auto s) {
+                                        OnAsioAsyncReadSomeComplete(e, s);
+                                    }));
 
             return;
         }
@@ -242,9 +284,10 @@ void AsioGenericRawByteStream::OnAsioAsyncWriteSomeComplete(asio::error_code con
             // only re-trigger the write if no bytes were transferred, otherwise treat it as a 'normal' completion
 
             _writing = true;
-            _socket.async_write_some(_writeBufferSequence, [this](const auto& e, auto s) {
-                OnAsioAsyncWriteSomeComplete(e, s);
-            });
+            _socket.async_write_some(_writeBufferSequence,
+                                     asio::bind_executor(_strand.GetAsioExecutor(), [this](const auto& e, auto s) {
+                                         OnAsioAsyncWriteSomeComplete(e, s);
+                                     }));
 
             return;
         }
@@ -283,7 +326,7 @@ void AsioGenericRawByteStream::HandleShutdownOrError()
 
             _shutdownPosted = true;
 
-            _asioIoContext->post([this] {
+            _strand.Post([this] {
                 _listener->OnShutdown(*this);
             });
         }
@@ -4,6 +4,7 @@
 #include "IRawByteStream.hpp"
 
 #include "AsioSocketOptions.hpp"
+#include "AsioStrand.hpp"
 #include "util/Atomic.hpp"
 
 #include "ILogger.hpp"
@@ -23,6 +24,9 @@ struct AsioGenericRawByteStreamOptions
     {
         bool quickAck{false};
     } tcp;
+
+    //! Number of threads running the asio::io_context
+    size_t threadCount{1};
 };
 
 
@@ -44,6 +48,7 @@ class AsioGenericRawByteStream final : public IRawByteStream
     AsioGenericRawByteStreamOptions _options;
 
     std::shared_ptr<asio::io_context> _asioIoContext;
+    AsioStrand _strand;
     AsioSocket _socket;
 
     SilKit::Services::Logging::ILogger* _logger{nullptr};
@@ -54,13 +59,20 @@ public:
                              SilKit::Services::Logging::ILogger& logger);
     ~AsioGenericRawByteStream() override;
 
+    auto GetNativeHandle() -> int;
+
+    //! Give up the ownership of the socket, without closing it. Must not be called while operations are in progress.
+    void ReleaseNativeHandle();
+
 public: // IRawByteStream
     void SetListener(IRawByteStreamListener& listener) override;
     auto GetLocalEndpoint() const -> std::string override;
     auto GetRemoteEndpoint() const -> std::string override;
+    auto GetStrand() -> IStrand& override;
     void AsyncReadSome(MutableBufferSequence bufferSequence) override;
     void AsyncWriteSome(ConstBufferSequence bufferSequence) override;
     void Shutdown() override;
+    auto GetRoundTripTime() const -> std::chrono::microseconds override;
 
 private:
     void OnAsioAsyncReadSomeComplete(const asio::error_code& errorCode, size_t bytesTransferred);
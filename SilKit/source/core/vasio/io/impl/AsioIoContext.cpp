@@ -2,16 +2,22 @@
 
 #include "AsioAcceptor.hpp"
 #include "AsioConnector.hpp"
+#include "AsioTaskHandler.hpp"
 #include "AsioTimer.hpp"
 #include "SetAsioSocketOptions.hpp"
 
 #include "util/Exceptions.hpp"
 #include "util/TracingMacros.hpp"
 
+#include "SetThreadName.hpp"
+
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <regex> // IsIPv4 / IsIPv6
+#include <string>
 #include <unordered_set>
 
 #include "asio.hpp"
@@ -128,16 +134,41 @@ void SetListenOptions(SilKit::Services::Logging::ILogger*, asio::ip::tcp::accept
 } // namespace
 
 
-AsioIoContext::AsioIoContext(const AsioSocketOptions& socketOptions)
+AsioIoContext::AsioIoContext(const AsioSocketOptions& socketOptions, size_t threadCount,
+                             const IoPollingOptions& pollingOptions)
     : _socketOptions{socketOptions}
-    , _asioIoContext{std::make_shared<asio::io_context>()}
+    , _threadCount{std::max<size_t>(threadCount, 1)}
+    , _pollingOptions{pollingOptions}
+    , _asioIoContext{std::make_shared<asio::io_context>(static_cast<int>(_threadCount))}
 {
+    if (_threadCount > 1)
+    {
+        _executor = asio::make_strand(*_asioIoContext);
+    }
+    else
+    {
+        _executor = _asioIoContext->get_executor();
+    }
 }
 
 
 AsioIoContext::~AsioIoContext()
 {
     SILKIT_TRACE_METHOD_(_logger, "()");
+
+    JoinWorkerThreads();
+}
+
+
+auto AsioIoContext::GetAsioIoContext() const -> const std::shared_ptr<asio::io_context>&
+{
+    return _asioIoContext;
+}
+
+
+auto AsioIoContext::GetThreadCount() const -> size_t
+{
+    return _threadCount;
 }
 
 
@@ -153,21 +184,35 @@ void AsioIoContext::Run()
         _asioIoContext->restart();
     }
 
-    _asioIoContext->run();
+    // The worker threads keep running if the calling thread leaves via an exception and calls Run again
+    if (_workerThreads.empty())
+    {
+        for (size_t index = 1; index < _threadCount; ++index)
+        {
+            _workerThreads.emplace_back([this, index] {
+                RunWorkerThread(index);
+            });
+        }
+    }
+
+    RunEventLoop();
+
+    // all threads return from the event loop once the asio::io_context runs out of work
+    JoinWorkerThreads();
 }
 
 
-void AsioIoContext::Post(std::function<void()> function)
+void AsioIoContext::Post(IoTask task)
 {
     SILKIT_TRACE_METHOD_(_logger, "(...)");
-    _asioIoContext->post(std::move(function));
+    asio::post(_executor, AsioTaskHandler{std::move(task)});
 }
 
 
-void AsioIoContext::Dispatch(std::function<void()> function)
+void AsioIoContext::Dispatch(IoTask task)
 {
     SILKIT_TRACE_METHOD_(_logger, "(...)");
-    _asioIoContext->dispatch(std::move(function));
+    asio::dispatch(_executor, AsioTaskHandler{std::move(task)});
 }
 
 
@@ -215,12 +260,12 @@ auto AsioIoContext::MakeTcpAcceptor(const std::string& ipAddress, uint16_t port)
 
     auto address = CleanIpAddress(ipAddress);
     asio::ip::tcp::endpoint endpoint{asio::ip::make_address(address), port};
-    asio::ip::tcp::acceptor acceptor{_asioIoContext->get_executor()};
+    asio::ip::tcp::acceptor acceptor{_executor};
 
     OpenAcceptor(acceptor, endpoint, *_logger);
 
-    return std::make_unique<AsioAcceptor<decltype(acceptor)>>(_socketOptions, _asioIoContext, std::move(acceptor),
-                                                              *_logger);
+    return std::make_unique<AsioAcceptor<decltype(acceptor)>>(_socketOptions, _asioIoContext, _threadCount,
+                                                              std::move(acceptor), *_logger);
 }
 
 
@@ -229,12 +274,12 @@ auto AsioIoContext::MakeLocalAcceptor(const std::string& path) -> std::unique_pt
     SILKIT_TRACE_METHOD_(_logger, "({})", path);
 
     asio::local::stream_protocol::endpoint endpoint{path};
-    asio::local::stream_protocol::acceptor acceptor{_asioIoContext->get_executor()};
+    asio::local::stream_protocol::acceptor acceptor{_executor};
 
     OpenAcceptor(acceptor, endpoint, *_logger);
 
-    return std::make_unique<AsioAcceptor<decltype(acceptor)>>(_socketOptions, _asioIoContext, std::move(acceptor),
-                                                              *_logger);
+    return std::make_unique<AsioAcceptor<decltype(acceptor)>>(_socketOptions, _asioIoContext, _threadCount,
+                                                              std::move(acceptor), *_logger);
 }
 
 
@@ -248,7 +293,8 @@ auto AsioIoContext::MakeTcpConnector(const std::string& ipAddress, uint16_t port
     auto address = CleanIpAddress(ipAddress);
     AsioProtocolType::endpoint endpoint{asio::ip::make_address(address), port};
 
-    return std::make_unique<ConnectorType>(_asioIoContext, _socketOptions, endpoint, *_logger);
+    return std::make_unique<ConnectorType>(_asioIoContext, _threadCount, _executor, _socketOptions, endpoint,
+                                           *_logger);
 }
 
 
@@ -261,7 +307,8 @@ auto AsioIoContext::MakeLocalConnector(const std::string& path) -> std::unique_p
 
     AsioProtocolType::endpoint endpoint{path};
 
-    return std::make_unique<ConnectorType>(_asioIoContext, _socketOptions, endpoint, *_logger);
+    return std::make_unique<ConnectorType>(_asioIoContext, _threadCount, _executor, _socketOptions, endpoint,
+                                           *_logger);
 }
 
 
@@ -269,7 +316,7 @@ auto AsioIoContext::MakeTimer() -> std::unique_ptr<ITimer>
 {
     SILKIT_TRACE_METHOD_(_logger, "()");
 
-    return std::make_unique<AsioTimer>(_asioIoContext);
+    return std::make_unique<AsioTimer>(_asioIoContext, _executor);
 }
 
 
@@ -302,6 +349,77 @@ void AsioIoContext::SetLogger(SilKit::Services::Logging::ILogger& logger)
 }
 
 
+auto AsioIoContext::IsRunningInThisThread() const -> bool
+{
+    return _asioIoContext->get_executor().running_in_this_thread();
+}
+
+
+void AsioIoContext::RunEventLoop()
+{
+    if (!_pollingOptions.enabled)
+    {
+        _asioIoContext->run();
+        return;
+    }
+
+    using Clock = std::chrono::steady_clock;
+
+    auto lastHandlerTime{Clock::now()};
+
+    // asio::io_context::poll stops the context once it runs out of work, just like asio::io_context::run
+    while (!_asioIoContext->stopped())
+    {
+        if (_asioIoContext->poll() > 0)
+        {
+            lastHandlerTime = Clock::now();
+            continue;
+        }
+
+        if (Clock::now() - lastHandlerTime >= _pollingOptions.spinDuration)
+        {
+            // nothing happened within the spin duration, block until the next handler is ready
+            _asioIoContext->run_one();
+            lastHandlerTime = Clock::now();
+        }
+    }
+}
+
+
+void AsioIoContext::RunWorkerThread(size_t index)
+{
+    SilKit::Util::SetThreadName("SilKit-IO-" + std::to_string(index));
+
+    while (true)
+    {
+        try
+        {
+            RunEventLoop();
+            return;
+        }
+        catch (const std::exception& error)
+        {
+            SilKit::Services::Logging::Error(_logger, "AsioIoContext: Worker thread {} caught an exception: {}", index,
+                                             error.what());
+        }
+    }
+}
+
+
+void AsioIoContext::JoinWorkerThreads()
+{
+    for (auto& thread : _workerThreads)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+
+    _workerThreads.clear();
+}
+
+
 } // namespace VSilKit
 
 
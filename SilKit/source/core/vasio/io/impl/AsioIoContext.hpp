@@ -11,8 +11,10 @@
 
 #include <atomic>
 #include <mutex>
+#include <thread>
 #include <unordered_set>
 #include <memory>
+#include <vector>
 
 #include <cstdint>
 
@@ -20,20 +22,33 @@
 namespace VSilKit {
 
 
+//! If more than one thread is requested, Run executes the handlers on the calling thread and additional worker threads.
+//! The main strand is then an actual asio strand, while it is the plain asio::io_context executor otherwise.
+//!
+//! If polling is enabled, all threads poll the asio::io_context for ready handlers in a loop and only block once no
+//! handler became ready for the configured spin duration.
 class AsioIoContext final : public IIoContext
 {
     AsioSocketOptions _socketOptions;
+    size_t _threadCount{1};
+    IoPollingOptions _pollingOptions;
     std::shared_ptr<asio::io_context> _asioIoContext;
+    asio::any_io_executor _executor;
+    std::vector<std::thread> _workerThreads;
     SilKit::Services::Logging::ILogger* _logger{nullptr};
 
 public:
-    explicit AsioIoContext(const AsioSocketOptions& socketOptions);
+    AsioIoContext(const AsioSocketOptions& socketOptions, size_t threadCount,
+                  const IoPollingOptions& pollingOptions = {});
     ~AsioIoContext() override;
 
+    auto GetAsioIoContext() const -> const std::shared_ptr<asio::io_context>&;
+    auto GetThreadCount() const -> size_t;
+
 public: // IIoContext
     void Run() override;
-    void Post(std::function<void()> function) override;
-    void Dispatch(std::function<void()> function) override;
+    void Post(IoTask task) override;
+    void Dispatch(IoTask task) override;
     auto MakeTcpAcceptor(const std::string& address, uint16_t port) -> std::unique_ptr<IAcceptor> override;
     auto MakeLocalAcceptor(const std::string& path) -> std::unique_ptr<IAcceptor> override;
     auto MakeTcpConnector(const std::string& address, uint16_t port) -> std::unique_ptr<IConnector> override;
@@ -41,6 +56,12 @@ public: // IIoContext
     auto MakeTimer() -> std::unique_ptr<ITimer> override;
     auto Resolve(const std::string& name) -> std::vector<std::string> override;
     void SetLogger(SilKit::Services::Logging::ILogger& logger) override;
+    auto IsRunningInThisThread() const -> bool override;
+
+private:
+    void RunEventLoop();
+    void RunWorkerThread(size_t index);
+    void JoinWorkerThreads();
 };
 
 
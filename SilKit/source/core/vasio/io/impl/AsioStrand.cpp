@@ -0,0 +1,40 @@
+#include "AsioStrand.hpp"
+
+#include "AsioTaskHandler.hpp"
+
+
+namespace VSilKit {
+
+
+AsioStrand::AsioStrand(asio::io_context& asioIoContext, size_t threadCount)
+{
+    if (threadCount > 1)
+    {
+        _executor = asio::make_strand(asioIoContext);
+    }
+    else
+    {
+        _executor = asioIoContext.get_executor();
+    }
+}
+
+
+auto AsioStrand::GetAsioExecutor() const -> const asio::any_io_executor&
+{
+    return _executor;
+}
+
+
+void AsioStrand::Post(IoTask task)
+{
+    asio::post(_executor, AsioTaskHandler{std::move(task)});
+}
+
+
+void AsioStrand::Dispatch(IoTask task)
+{
+    asio::dispatch(_executor, AsioTaskHandler{std::move(task)});
+}
+
+
+} // namespace VSilKit
@@ -0,0 +1,29 @@
+#pragma once
+
+
+#include "IStrand.hpp"
+
+#include "asio.hpp"
+
+
+namespace VSilKit {
+
+
+//! If the asio::io_context is run by a single thread, the strand is the plain asio::io_context executor, since the
+//! handlers are serialized anyway.
+class AsioStrand final : public IStrand
+{
+    asio::any_io_executor _executor;
+
+public:
+    AsioStrand(asio::io_context& asioIoContext, size_t threadCount);
+
+    auto GetAsioExecutor() const -> const asio::any_io_executor&;
+
+public: // IStrand
+    void Post(IoTask task) override;
+    void Dispatch(IoTask task) override;
+};
+
+
+} // namespace VSilKit
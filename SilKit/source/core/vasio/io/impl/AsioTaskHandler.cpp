@@ -0,0 +1,101 @@
+#include "AsioTaskHandler.hpp"
+
+#include <atomic>
+#include <new>
+
+
+namespace VSilKit {
+
+
+namespace {
+
+struct Block
+{
+    Block* next;
+};
+
+static_assert(TaskMemoryPool::BlockSize >= sizeof(Block), "blocks must be able to hold the free-list link");
+
+
+//! Blocks freed by any thread. Only pushed to individually and emptied as a whole, hence not affected by ABA.
+struct ReturnedBlocks
+{
+    std::atomic<Block*> head{nullptr};
+
+    ~ReturnedBlocks()
+    {
+        FreeList(head.exchange(nullptr));
+    }
+
+    static void FreeList(Block* block)
+    {
+        while (block != nullptr)
+        {
+            auto* next = block->next;
+            ::operator delete(block);
+            block = next;
+        }
+    }
+};
+
+ReturnedBlocks gReturnedBlocks;
+
+
+//! Blocks owned by the current thread.
+struct BlockCache
+{
+    Block* head{nullptr};
+
+    ~BlockCache()
+    {
+        ReturnedBlocks::FreeList(head);
+    }
+};
+
+thread_local BlockCache tBlockCache;
+
+} // namespace
+
+
+auto TaskMemoryPool::Allocate(size_t size) -> void*
+{
+    if (size > BlockSize)
+    {
+        return ::operator new(size);
+    }
+
+    auto& cache = tBlockCache;
+    if (cache.head == nullptr)
+    {
+        cache.head = gReturnedBlocks.head.exchange(nullptr, std::memory_order_acquire);
+    }
+
+    if (cache.head == nullptr)
+    {
+        return ::operator new(BlockSize);
+    }
+
+    auto* block = cache.head;
+    cache.head = block->next;
+    return block;
+}
+
+
+void TaskMemoryPool::Deallocate(void* pointer, size_t size) noexcept
+{
+    if (size > BlockSize)
+    {
+        ::operator delete(pointer);
+        return;
+    }
+
+    auto* block = static_cast<Block*>(pointer);
+    block->next = gReturnedBlocks.head.load(std::memory_order_relaxed);
+    while (!gReturnedBlocks.head.compare_exchange_weak(block->next, block, std::memory_order_release,
+                                                       std::memory_order_relaxed))
+    {
+    }
+}
+
+
+} // namespace VSilKit
@@ -0,0 +1,83 @@
+#pragma once
+
+
+#include "IoTask.hpp"
+
+#include <cstddef>
+
+
+namespace VSilKit {
+
+
+//! \brief Recycles the memory of the asio operations created for posted tasks.
+//!
+//! asio only recycles handler memory on threads running the io_context. Tasks posted by the user threads would
+//! allocate (and the I/O thread free) one operation per task. Freed blocks are pushed onto a global lock-free stack, and
+//! an allocating thread takes over the whole stack at once into its thread-local cache, which is free of the ABA
+//! problem. Larger requests are passed on to operator new.
+struct TaskMemoryPool
+{
+    static constexpr size_t BlockSize = 256;
+
+    static auto Allocate(size_t size) -> void*;
+    static void Deallocate(void* pointer, size_t size) noexcept;
+};
+
+
+//! Allocator associated with the handlers of posted tasks, see TaskMemoryPool.
+template <typename T>
+struct TaskAllocator
+{
+    using value_type = T;
+
+    TaskAllocator() noexcept = default;
+
+    template <typename U>
+    TaskAllocator(const TaskAllocator<U>&) noexcept
+    {
+    }
+
+    auto allocate(size_t n) -> T*
+    {
+        return static_cast<T*>(TaskMemoryPool::Allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* pointer, size_t n) noexcept
+    {
+        TaskMemoryPool::Deallocate(pointer, n * sizeof(T));
+    }
+
+    template <typename U>
+    friend bool operator==(const TaskAllocator&, const TaskAllocator<U>&) noexcept
+    {
+        return true;
+    }
+
+    template <typename U>
+    friend bool operator!=(const TaskAllocator&, const TaskAllocator<U>&) noexcept
+    {
+        return false;
+    }
+};
+
+
+//! asio completion handler executing an IoTask. The associated allocator avoids a heap allocation per posted task.
+struct AsioTaskHandler
+{
+    using allocator_type = TaskAllocator<void>;
+
+    IoTask task;
+
+    auto get_allocator() const noexcept -> allocator_type
+    {
+        return {};
+    }
+
+    void operator()()
+    {
+        task();
+    }
+};
+
+
+} // namespace VSilKit
@@ -8,8 +8,9 @@
 namespace VSilKit {
 
 
-AsioTimer::AsioTimer(std::shared_ptr<asio::io_context> asioIoContext)
+AsioTimer::AsioTimer(std::shared_ptr<asio::io_context> asioIoContext, asio::any_io_executor executor)
     : _asioIoContext{std::move(asioIoContext)}
+    , _executor{std::move(executor)}
     , _op{std::make_shared<Op>(*this)}
 {
 }
@@ -42,7 +43,7 @@ void AsioTimer::Shutdown()
 
 AsioTimer::Op::Op(VSilKit::AsioTimer& parent)
     : _parent{&parent}
-    , _timer{*parent._asioIoContext}
+    , _timer{parent._executor}
 {
 }
 
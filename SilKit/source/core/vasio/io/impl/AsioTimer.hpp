@@ -33,10 +33,11 @@ class AsioTimer final : public ITimer
     ITimerListener* _listener{nullptr};
 
     std::shared_ptr<asio::io_context> _asioIoContext;
+    asio::any_io_executor _executor;
     std::shared_ptr<Op> _op;
 
 public:
-    explicit AsioTimer(std::shared_ptr<asio::io_context> asioIoContext);
+    AsioTimer(std::shared_ptr<asio::io_context> asioIoContext, asio::any_io_executor executor);
     ~AsioTimer() override;
 
     void SetListener(ITimerListener& listener) override;
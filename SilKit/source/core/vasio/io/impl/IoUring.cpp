@@ -0,0 +1,478 @@
+#include "IoUring.hpp"
+
+#include "silkit/participant/exception.hpp"
+
+#include "fmt/format.h"
+
+#if defined(SILKIT_HAS_IO_URING)
+#    include <algorithm>
+#    include <cerrno>
+#    include <cstring>
+#    include <sys/mman.h>
+#    include <sys/socket.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+
+namespace VSilKit {
+
+
+#if defined(SILKIT_HAS_IO_URING)
+
+
+namespace {
+
+
+auto MakeErrorMessage(const char* operation, int error) -> std::string
+{
+    return fmt::format("IoUring: {} failed: {}", operation, std::strerror(error));
+}
+
+auto SysSetup(unsigned entries, io_uring_params* params) -> int
+{
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+auto SysEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags) -> int
+{
+    return static_cast<int>(::syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0));
+}
+
+auto SysRegister(int fd, unsigned opcode, const void* arg, unsigned numArgs) -> int
+{
+    return static_cast<int>(::syscall(__NR_io_uring_register, fd, opcode, arg, numArgs));
+}
+
+auto MapRing(int fd, size_t size, off_t offset) -> void*
+{
+    void* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+    if (data == MAP_FAILED)
+    {
+        throw SilKit::SilKitError{MakeErrorMessage("mmap", errno)};
+    }
+    return data;
+}
+
+template <typename T>
+auto Offset(void* base, uint32_t offset) -> T*
+{
+    return reinterpret_cast<T*>(static_cast<uint8_t*>(base) + offset);
+}
+
+
+} // namespace
+
+
+IoUring::IoUring(unsigned entries)
+{
+    io_uring_params params{};
+    params.flags = IORING_SETUP_CLAMP;
+
+    _fd = SysSetup(entries, &params);
+    if (_fd < 0)
+    {
+        throw SilKit::SilKitError{MakeErrorMessage("io_uring_setup", errno)};
+    }
+
+    try
+    {
+        _sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        _cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+        if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0)
+        {
+            _sqRingSize = _cqRingSize = std::max(_sqRingSize, _cqRingSize);
+            _sqRing = MapRing(_fd, _sqRingSize, IORING_OFF_SQ_RING);
+            _cqRing = _sqRing;
+        }
+        else
+        {
+            _sqRing = MapRing(_fd, _sqRingSize, IORING_OFF_SQ_RING);
+            _cqRing = MapRing(_fd, _cqRingSize, IORING_OFF_CQ_RING);
+        }
+
+        _sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        _sqes = static_cast<io_uring_sqe*>(MapRing(_fd, _sqesSize, IORING_OFF_SQES));
+    }
+    catch (...)
+    {
+        Release();
+        throw;
+    }
+
+    _sqHead = Offset<unsigned>(_sqRing, params.sq_off.head);
+    _sqTail = Offset<unsigned>(_sqRing, params.sq_off.tail);
+    _sqFlags = Offset<unsigned>(_sqRing, params.sq_off.flags);
+    _sqMask = *Offset<unsigned>(_sqRing, params.sq_off.ring_mask);
+    _sqEntries = *Offset<unsigned>(_sqRing, params.sq_off.ring_entries);
+    _sqArray = Offset<unsigned>(_sqRing, params.sq_off.array);
+    _sqLocalTail = *_sqTail;
+    _sqSubmitted = _sqLocalTail;
+
+    _cqHead = Offset<unsigned>(_cqRing, params.cq_off.head);
+    _cqTail = Offset<unsigned>(_cqRing, params.cq_off.tail);
+    _cqMask = *Offset<unsigned>(_cqRing, params.cq_off.ring_mask);
+    _cqes = Offset<io_uring_cqe>(_cqRing, params.cq_off.cqes);
+}
+
+
+IoUring::~IoUring()
+{
+    Release();
+}
+
+
+void IoUring::Release()
+{
+    if (_sqes != nullptr)
+    {
+        ::munmap(_sqes, _sqesSize);
+        _sqes = nullptr;
+    }
+    if (_cqRing != nullptr && _cqRing != _sqRing)
+    {
+        ::munmap(_cqRing, _cqRingSize);
+    }
+    _cqRing = nullptr;
+    if (_sqRing != nullptr)
+    {
+        ::munmap(_sqRing, _sqRingSize);
+        _sqRing = nullptr;
+    }
+    if (_fd >= 0)
+    {
+        ::close(_fd);
+        _fd = -1;
+    }
+}
+
+
+auto IoUring::IsSupported() -> bool
+{
+    static const bool isSupported = [] {
+        try
+        {
+            IoUring ring{4};
+            IoUringBufferRing bufferRing{ring, 0, 2, 64};
+            return true;
+        }
+        catch (const std::exception&)
+        {
+            return false;
+        }
+    }();
+
+    return isSupported;
+}
+
+
+auto IoUring::GetSubmissionEntry() -> io_uring_sqe*
+{
+    const auto head = __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE);
+    if (_sqLocalTail - head >= _sqEntries)
+    {
+        Submit();
+        if (_sqLocalTail - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE) >= _sqEntries)
+        {
+            throw SilKit::SilKitError{"IoUring: submission queue is full"};
+        }
+    }
+
+    const auto index = _sqLocalTail & _sqMask;
+    auto* sqe = &_sqes[index];
+    std::memset(sqe, 0, sizeof(*sqe));
+
+    _sqArray[index] = index;
+    ++_sqLocalTail;
+
+    return sqe;
+}
+
+
+void IoUring::PrepareReceive(int fd, uint16_t groupId, bool multishot, uint64_t userData)
+{
+    auto* sqe = GetSubmissionEntry();
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = fd;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = groupId;
+    sqe->ioprio = multishot ? IORING_RECV_MULTISHOT : 0;
+    sqe->user_data = userData;
+}
+
+
+void IoUring::PrepareSendMessage(int fd, const msghdr* message, uint64_t userData)
+{
+    auto* sqe = GetSubmissionEntry();
+    sqe->opcode = IORING_OP_SENDMSG;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uint64_t>(message);
+    sqe->len = 1;
+    sqe->msg_flags = MSG_NOSIGNAL;
+    sqe->user_data = userData;
+}
+
+
+void IoUring::PrepareCancel(uint64_t targetUserData, uint64_t userData)
+{
+    auto* sqe = GetSubmissionEntry();
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = targetUserData;
+    sqe->user_data = userData;
+}
+
+
+void IoUring::Submit()
+{
+    const bool overflow = (__atomic_load_n(_sqFlags, __ATOMIC_ACQUIRE) & IORING_SQ_CQ_OVERFLOW) != 0;
+    if (_sqSubmitted == _sqLocalTail && !overflow)
+    {
+        return;
+    }
+
+    // publish the new entries to the kernel
+    __atomic_store_n(_sqTail, _sqLocalTail, __ATOMIC_RELEASE);
+
+    auto flags = overflow ? static_cast<unsigned>(IORING_ENTER_GETEVENTS) : 0u;
+    do
+    {
+        const auto result = SysEnter(_fd, _sqLocalTail - _sqSubmitted, 0, flags);
+        if (result < 0)
+        {
+            if (errno == EINTR || errno == EAGAIN || errno == EBUSY)
+            {
+                continue;
+            }
+            throw SilKit::SilKitError{MakeErrorMessage("io_uring_enter", errno)};
+        }
+        _sqSubmitted += static_cast<unsigned>(result);
+        flags = 0;
+    } while (_sqSubmitted != _sqLocalTail);
+}
+
+
+auto IoUring::PopCompletion(IoUringCompletion& completion) -> bool
+{
+    const auto head = *_cqHead;
+    if (head == __atomic_load_n(_cqTail, __ATOMIC_ACQUIRE))
+    {
+        return false;
+    }
+
+    const auto& cqe = _cqes[head & _cqMask];
+    completion.userData = cqe.user_data;
+    completion.result = cqe.res;
+    completion.more = (cqe.flags & IORING_CQE_F_MORE) != 0;
+    completion.hasBuffer = (cqe.flags & IORING_CQE_F_BUFFER) != 0;
+    completion.bufferId = static_cast<uint16_t>(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+
+    __atomic_store_n(_cqHead, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+
+void IoUring::RegisterEventFd(int eventFd)
+{
+    if (SysRegister(_fd, IORING_REGISTER_EVENTFD, &eventFd, 1) < 0)
+    {
+        throw SilKit::SilKitError{MakeErrorMessage("IORING_REGISTER_EVENTFD", errno)};
+    }
+}
+
+
+void IoUring::RegisterBufferRing(io_uring_buf_ring* bufferRing, unsigned entries, uint16_t groupId)
+{
+    io_uring_buf_reg reg{};
+    reg.ring_addr = reinterpret_cast<uint64_t>(bufferRing);
+    reg.ring_entries = entries;
+    reg.bgid = groupId;
+
+    if (SysRegister(_fd, IORING_REGISTER_PBUF_RING, &reg, 1) < 0)
+    {
+        throw SilKit::SilKitError{MakeErrorMessage("IORING_REGISTER_PBUF_RING", errno)};
+    }
+}
+
+
+void IoUring::UnregisterBufferRing(uint16_t groupId)
+{
+    io_uring_buf_reg reg{};
+    reg.bgid = groupId;
+
+    (void)SysRegister(_fd, IORING_UNREGISTER_PBUF_RING, &reg, 1);
+}
+
+
+IoUringBufferRing::IoUringBufferRing(IoUring& ring, uint16_t groupId, unsigned count, size_t bufferSize)
+    : _ring{&ring}
+    , _groupId{groupId}
+    , _count{count}
+    , _bufferSize{bufferSize}
+    , _buffers(count * bufferSize)
+{
+    if (count == 0 || (count & (count - 1)) != 0 || count > 32768)
+    {
+        throw SilKit::SilKitError{"IoUringBufferRing: the number of buffers must be a power of two"};
+    }
+
+    // the kernel requires the ring to be page-aligned
+    _bufferRingSize = count * sizeof(io_uring_buf);
+    void* data = ::mmap(nullptr, _bufferRingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED)
+    {
+        throw SilKit::SilKitError{MakeErrorMessage("mmap", errno)};
+    }
+    _bufferRing = static_cast<io_uring_buf_ring*>(data);
+
+    try
+    {
+        _ring->RegisterBufferRing(_bufferRing, count, groupId);
+    }
+    catch (...)
+    {
+        ::munmap(_bufferRing, _bufferRingSize);
+        throw;
+    }
+
+    for (unsigned bufferId = 0; bufferId != count; ++bufferId)
+    {
+        Recycle(static_cast<uint16_t>(bufferId));
+    }
+}
+
+
+IoUringBufferRing::~IoUringBufferRing()
+{
+    _ring->UnregisterBufferRing(_groupId);
+    ::munmap(_bufferRing, _bufferRingSize);
+}
+
+
+auto IoUringBufferRing::GetGroupId() const -> uint16_t
+{
+    return _groupId;
+}
+
+
+auto IoUringBufferRing::GetBuffer(uint16_t bufferId) -> uint8_t*
+{
+    return _buffers.data() + static_cast<size_t>(bufferId) * _bufferSize;
+}
+
+
+void IoUringBufferRing::Recycle(uint16_t bufferId)
+{
+    // the entries start at the beginning of the ring, the tail overlays the reserved field of the first one (the C++
+    // expansion of the bufs flexible array member in the kernel headers may place it at a different offset)
+    auto& buffer = reinterpret_cast<io_uring_buf*>(_bufferRing)[_tail & (_count - 1)];
+    buffer.addr = reinterpret_cast<uint64_t>(GetBuffer(bufferId));
+    buffer.len = static_cast<uint32_t>(_bufferSize);
+    buffer.bid = bufferId;
+
+    ++_tail;
+    __atomic_store_n(&_bufferRing->tail, _tail, __ATOMIC_RELEASE);
+}
+
+
+#else
+
+
+IoUring::IoUring(unsigned)
+{
+    throw SilKit::SilKitError{"IoUring: io_uring is not supported on this platform"};
+}
+
+
+IoUring::~IoUring() = default;
+
+
+void IoUring::Release()
+{
+}
+
+
+auto IoUring::IsSupported() -> bool
+{
+    return false;
+}
+
+
+auto IoUring::GetSubmissionEntry() -> io_uring_sqe*
+{
+    return nullptr;
+}
+
+
+void IoUring::PrepareReceive(int, uint16_t, bool, uint64_t)
+{
+}
+
+
+void IoUring::PrepareSendMessage(int, const msghdr*, uint64_t)
+{
+}
+
+
+void IoUring::PrepareCancel(uint64_t, uint64_t)
+{
+}
+
+
+void IoUring::Submit()
+{
+}
+
+
+auto IoUring::PopCompletion(IoUringCompletion&) -> bool
+{
+    return false;
+}
+
+
+void IoUring::RegisterEventFd(int)
+{
+}
+
+
+void IoUring::RegisterBufferRing(io_uring_buf_ring*, unsigned, uint16_t)
+{
+}
+
+
+void IoUring::UnregisterBufferRing(uint16_t)
+{
+}
+
+
+IoUringBufferRing::IoUringBufferRing(IoUring&, uint16_t, unsigned, size_t)
+{
+    throw SilKit::SilKitError{"IoUringBufferRing: io_uring is not supported on this platform"};
+}
+
+
+IoUringBufferRing::~IoUringBufferRing() = default;
+
+
+auto IoUringBufferRing::GetGroupId() const -> uint16_t
+{
+    return _groupId;
+}
+
+
+auto IoUringBufferRing::GetBuffer(uint16_t) -> uint8_t*
+{
+    return nullptr;
+}
+
+
+void IoUringBufferRing::Recycle(uint16_t)
+{
+}
+
+
+#endif
+
+
+} // namespace VSilKit
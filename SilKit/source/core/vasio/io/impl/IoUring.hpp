@@ -0,0 +1,134 @@
+#pragma once
+
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// the headers of older kernels lack multishot receive and provided buffer rings
+#if defined(__linux__) && defined(__has_include)
+#    if __has_include(<linux/io_uring.h>)
+#        include <linux/io_uring.h>
+#        if defined(IORING_RECV_MULTISHOT)
+#            define SILKIT_HAS_IO_URING 1
+#        endif
+#    endif
+#endif
+
+#if !defined(SILKIT_HAS_IO_URING)
+struct io_uring_sqe;
+struct io_uring_cqe;
+struct io_uring_buf_ring;
+#endif
+
+
+struct msghdr;
+
+
+namespace VSilKit {
+
+
+struct IoUringCompletion
+{
+    uint64_t userData{0};
+    //! Number of bytes transferred, or the negated error number.
+    int32_t result{0};
+    //! The operation stays active and will post further completions (multishot).
+    bool more{false};
+    //! The data was received into the buffer with the given id.
+    bool hasBuffer{false};
+    uint16_t bufferId{0};
+};
+
+
+//! Minimal io_uring instance, set up via the raw system calls (liburing is not required). Not thread-safe.
+class IoUring
+{
+    int _fd{-1};
+
+    void* _sqRing{nullptr};
+    size_t _sqRingSize{0};
+    void* _cqRing{nullptr};
+    size_t _cqRingSize{0};
+    io_uring_sqe* _sqes{nullptr};
+    size_t _sqesSize{0};
+
+    unsigned* _sqHead{nullptr};
+    unsigned* _sqTail{nullptr};
+    unsigned* _sqFlags{nullptr};
+    unsigned _sqMask{0};
+    unsigned _sqEntries{0};
+    unsigned* _sqArray{nullptr};
+    unsigned _sqLocalTail{0};
+    unsigned _sqSubmitted{0};
+
+    unsigned* _cqHead{nullptr};
+    unsigned* _cqTail{nullptr};
+    unsigned _cqMask{0};
+    io_uring_cqe* _cqes{nullptr};
+
+public:
+    //! Set up an instance with (at least) the given number of submission queue entries. Throws on failure.
+    explicit IoUring(unsigned entries);
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+    ~IoUring();
+
+    //! Returns true if io_uring is available, including the features used by the I/O context (provided buffer rings).
+    static auto IsSupported() -> bool;
+
+    //! Queue a receive into a buffer selected from the given buffer ring. A multishot receive keeps posting
+    //! completions, until one is posted without the more flag.
+    void PrepareReceive(int fd, uint16_t groupId, bool multishot, uint64_t userData);
+    //! Queue a vectored send. The message and its buffers must stay valid until the completion has been posted.
+    void PrepareSendMessage(int fd, const msghdr* message, uint64_t userData);
+    //! Queue the cancellation of the operation submitted with the given user data.
+    void PrepareCancel(uint64_t targetUserData, uint64_t userData);
+
+    //! Pass the queued operations to the kernel, without waiting for completions. Also flushes the completions the
+    //! kernel had to hold back, because the completion queue was full.
+    void Submit();
+
+    //! Remove the oldest completion from the completion queue. Returns false if there is none.
+    auto PopCompletion(IoUringCompletion& completion) -> bool;
+
+    //! Signal the eventfd whenever a completion is posted.
+    void RegisterEventFd(int eventFd);
+    void RegisterBufferRing(io_uring_buf_ring* bufferRing, unsigned entries, uint16_t groupId);
+    void UnregisterBufferRing(uint16_t groupId);
+
+private:
+    auto GetSubmissionEntry() -> io_uring_sqe*;
+    void Release();
+};
+
+
+//! Ring of buffers provided to the kernel, which picks one for each completed receive (IOSQE_BUFFER_SELECT).
+class IoUringBufferRing
+{
+    IoUring* _ring{nullptr};
+    uint16_t _groupId{0};
+    unsigned _count{0};
+    size_t _bufferSize{0};
+
+    io_uring_buf_ring* _bufferRing{nullptr};
+    size_t _bufferRingSize{0};
+    std::vector<uint8_t> _buffers;
+    uint16_t _tail{0};
+
+public:
+    //! Allocate the given number (a power of two) of buffers and register them with the io_uring instance.
+    IoUringBufferRing(IoUring& ring, uint16_t groupId, unsigned count, size_t bufferSize);
+    IoUringBufferRing(const IoUringBufferRing&) = delete;
+    IoUringBufferRing& operator=(const IoUringBufferRing&) = delete;
+    ~IoUringBufferRing();
+
+    auto GetGroupId() const -> uint16_t;
+    auto GetBuffer(uint16_t bufferId) -> uint8_t*;
+
+    //! Hand a buffer back to the kernel, after its data has been consumed.
+    void Recycle(uint16_t bufferId);
+};
+
+
+} // namespace VSilKit
@@ -45,6 +45,24 @@ void SetAsioSocketOptions(SilKit::Services::Logging::ILogger* logger, asio::ip::
             return;
         }
     }
+
+    if (socketOptions.tcp.busyPollMicroseconds > 0)
+    {
+#if defined(SO_BUSY_POLL)
+        using busy_poll = asio::detail::socket_option::integer<SOL_SOCKET, SO_BUSY_POLL>;
+
+        // failing to enable busy-polling (usually a missing CAP_NET_ADMIN) is not fatal for the connection
+        std::error_code busyPollErrorCode;
+        socket.set_option(busy_poll{socketOptions.tcp.busyPollMicroseconds}, busyPollErrorCode);
+        if (busyPollErrorCode)
+        {
+            Log::Warn(logger, "SetAsioSocketOptions: failed to set busy-poll duration to {} us: {}",
+                      socketOptions.tcp.busyPollMicroseconds, busyPollErrorCode.message());
+        }
+#else
+        Log::Warn(logger, "SetAsioSocketOptions: busy-polling is not supported on this platform");
+#endif
+    }
 }
 
 
@@ -0,0 +1,597 @@
+#include "SharedMemoryRawByteStream.hpp"
+
+#include "util/Exceptions.hpp"
+#include "util/TracingMacros.hpp"
+
+#include "silkit/participant/exception.hpp"
+
+#include <algorithm>
+
+
+#if SILKIT_ENABLE_TRACING_INSTRUMENTATION_SharedMemoryRawByteStream
+#    define SILKIT_TRACE_METHOD_(logger, ...) SILKIT_TRACE_METHOD(logger, __VA_ARGS__)
+#else
+#    define SILKIT_TRACE_METHOD_(...)
+#endif
+
+
+namespace {
+
+
+namespace Log = SilKit::Services::Logging;
+
+
+constexpr uint32_t SEGMENT_MAGIC{0x534b534d}; // 'SKSM'
+constexpr uint32_t SEGMENT_VERSION{1};
+
+//! The segment header is followed by the ring buffer written by the creator and the one written by the opener.
+struct SegmentHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t ringBufferSize;
+};
+
+//! Offset of the first ring buffer. Keeps the ring buffers aligned to cache lines.
+constexpr size_t SEGMENT_HEADER_SIZE{64};
+static_assert(sizeof(SegmentHeader) <= SEGMENT_HEADER_SIZE, "the segment header must fit into the reserved space");
+
+//! Single byte sent through the socket to wake up the remote side.
+const uint8_t DOORBELL{0};
+
+
+auto GetRingBufferSize(size_t ringBufferCapacity) -> size_t
+{
+    const auto size = VSilKit::SharedMemoryRingBuffer::GetRequiredSize(ringBufferCapacity);
+    return (size + SEGMENT_HEADER_SIZE - 1) / SEGMENT_HEADER_SIZE * SEGMENT_HEADER_SIZE;
+}
+
+
+auto GetTotalSize(VSilKit::ConstBufferSequence bufferSequence) -> size_t
+{
+    size_t size{0};
+    for (const auto& buffer : bufferSequence)
+    {
+        size += buffer.GetSize();
+    }
+    return size;
+}
+
+
+auto GetTotalSize(VSilKit::MutableBufferSequence bufferSequence) -> size_t
+{
+    size_t size{0};
+    for (const auto& buffer : bufferSequence)
+    {
+        size += buffer.GetSize();
+    }
+    return size;
+}
+
+
+} // namespace
+
+
+namespace VSilKit {
+
+
+SharedMemoryRawByteStream::SharedMemoryRawByteStream(std::unique_ptr<IRawByteStream> stream,
+                                                     SilKit::Services::Logging::ILogger& logger)
+    : _stream{std::move(stream)}
+    , _strand{&_stream->GetStrand()}
+    , _logger{&logger}
+    , _doorbellReadBuffer{_doorbellReadData.data(), _doorbellReadData.size()}
+    , _doorbellWriteBuffer{&DOORBELL, sizeof(DOORBELL)}
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    _stream->SetListener(*this);
+}
+
+
+SharedMemoryRawByteStream::~SharedMemoryRawByteStream()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+}
+
+
+auto SharedMemoryRawByteStream::CreateSharedMemory(size_t ringBufferCapacity) -> std::string
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", ringBufferCapacity);
+
+    if (_segment != nullptr)
+    {
+        throw InvalidStateError{};
+    }
+
+    const auto ringBufferSize = GetRingBufferSize(ringBufferCapacity);
+    auto segment{SharedMemorySegment::Create(SEGMENT_HEADER_SIZE + 2 * ringBufferSize)};
+
+    auto* data = static_cast<uint8_t*>(segment->GetData());
+    SharedMemoryRingBuffer::Initialize(data + SEGMENT_HEADER_SIZE, ringBufferCapacity);
+    SharedMemoryRingBuffer::Initialize(data + SEGMENT_HEADER_SIZE + ringBufferSize, ringBufferCapacity);
+
+    auto* header = reinterpret_cast<SegmentHeader*>(data);
+    header->magic = SEGMENT_MAGIC;
+    header->version = SEGMENT_VERSION;
+    header->ringBufferSize = ringBufferSize;
+
+    auto name = segment->GetName();
+    AttachSegment(std::move(segment), true);
+    return name;
+}
+
+
+void SharedMemoryRawByteStream::OpenSharedMemory(const std::string& name)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", name);
+
+    if (_segment != nullptr)
+    {
+        throw InvalidStateError{};
+    }
+
+    auto segment{SharedMemorySegment::Open(name)};
+    if (segment->GetSize() < SEGMENT_HEADER_SIZE)
+    {
+        throw SilKit::SilKitError{"SharedMemoryRawByteStream: segment is too small"};
+    }
+
+    const auto* header = static_cast<const SegmentHeader*>(segment->GetData());
+    if (header->magic != SEGMENT_MAGIC || header->version != SEGMENT_VERSION
+        || header->ringBufferSize > (segment->GetSize() - SEGMENT_HEADER_SIZE) / 2)
+    {
+        throw SilKit::SilKitError{"SharedMemoryRawByteStream: segment has an unsupported layout"};
+    }
+
+    AttachSegment(std::move(segment), false);
+}
+
+
+void SharedMemoryRawByteStream::ReleaseSharedMemory()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    if (_readSwitched || _writeSwitched)
+    {
+        throw InvalidStateError{};
+    }
+
+    _readRingBuffer.reset();
+    _writeRingBuffer.reset();
+    _segment.reset();
+}
+
+
+auto SharedMemoryRawByteStream::HasSharedMemory() const -> bool
+{
+    return _segment != nullptr;
+}
+
+
+void SharedMemoryRawByteStream::SwitchWriteToSharedMemory()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    if (_segment == nullptr || _writeSwitched || _streamWriting)
+    {
+        throw InvalidStateError{};
+    }
+
+    _writeSwitched = true;
+
+    // a doorbell might have been deferred, because the socket still carried data
+    if (_doorbellPending)
+    {
+        RingDoorbell();
+    }
+}
+
+
+void SharedMemoryRawByteStream::SwitchReadToSharedMemory()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    if (_segment == nullptr || _readSwitched)
+    {
+        throw InvalidStateError{};
+    }
+
+    _readSwitched = true;
+
+    // both sides have the segment mapped, the name is not required anymore
+    _segment->Unlink();
+
+    StartDoorbellRead();
+
+    // doorbells received before the switch have been consumed as regular data
+    if (_writing)
+    {
+        TryWrite();
+    }
+}
+
+
+auto SharedMemoryRawByteStream::IsWriteSwitched() const -> bool
+{
+    return _writeSwitched;
+}
+
+
+auto SharedMemoryRawByteStream::IsReadSwitched() const -> bool
+{
+    return _readSwitched;
+}
+
+
+// IRawByteStream
+
+
+void SharedMemoryRawByteStream::SetListener(IRawByteStreamListener& listener)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", static_cast<const void*>(&listener));
+
+    _listener = &listener;
+}
+
+
+auto SharedMemoryRawByteStream::GetLocalEndpoint() const -> std::string
+{
+    return _stream->GetLocalEndpoint();
+}
+
+
+auto SharedMemoryRawByteStream::GetRemoteEndpoint() const -> std::string
+{
+    return _stream->GetRemoteEndpoint();
+}
+
+
+auto SharedMemoryRawByteStream::GetStrand() -> IStrand&
+{
+    return *_strand;
+}
+
+
+void SharedMemoryRawByteStream::AsyncReadSome(MutableBufferSequence bufferSequence)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    if (!_readSwitched)
+    {
+        _stream->AsyncReadSome(bufferSequence);
+        return;
+    }
+
+    if (_shutdownPosted)
+    {
+        return;
+    }
+
+    if (_reading)
+    {
+        throw InvalidStateError{};
+    }
+
+    if (GetTotalSize(bufferSequence) == 0)
+    {
+        PostReadDone(0);
+        return;
+    }
+
+    _readBufferSequence.assign(bufferSequence.begin(), bufferSequence.end());
+    _reading = true;
+
+    TryRead();
+}
+
+
+void SharedMemoryRawByteStream::AsyncWriteSome(ConstBufferSequence bufferSequence)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    if (!_writeSwitched)
+    {
+        _streamWriting = true;
+        _stream->AsyncWriteSome(bufferSequence);
+        return;
+    }
+
+    if (_streamShutdown || _shutdownPosted)
+    {
+        return;
+    }
+
+    if (_writing)
+    {
+        throw InvalidStateError{};
+    }
+
+    if (GetTotalSize(bufferSequence) == 0)
+    {
+        PostWriteDone(0);
+        return;
+    }
+
+    _writeBufferSequence.assign(bufferSequence.begin(), bufferSequence.end());
+    _writing = true;
+
+    TryWrite();
+}
+
+
+void SharedMemoryRawByteStream::Shutdown()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    // closing the socket is signalled to the remote side, which stops using the ring buffers
+    _stream->Shutdown();
+}
+
+
+auto SharedMemoryRawByteStream::GetRoundTripTime() const -> std::chrono::microseconds
+{
+    return _stream->GetRoundTripTime();
+}
+
+
+// IRawByteStreamListener
+
+
+void SharedMemoryRawByteStream::OnAsyncReadSomeDone(IRawByteStream& stream, size_t bytesTransferred)
+{
+    SILKIT_UNUSED_ARG(stream);
+    SILKIT_TRACE_METHOD_(_logger, "({}, {})", static_cast<const void*>(&stream), bytesTransferred);
+
+    if (!_readSwitched)
+    {
+        _listener->OnAsyncReadSomeDone(*this, bytesTransferred);
+        return;
+    }
+
+    _streamReading = false;
+
+    // the content of the doorbells is irrelevant, resume all operations waiting on the ring buffers
+    if (_reading)
+    {
+        TryRead();
+    }
+    if (_writing)
+    {
+        TryWrite();
+    }
+
+    StartDoorbellRead();
+}
+
+
+void SharedMemoryRawByteStream::OnAsyncWriteSomeDone(IRawByteStream& stream, size_t bytesTransferred)
+{
+    SILKIT_UNUSED_ARG(stream);
+    SILKIT_TRACE_METHOD_(_logger, "({}, {})", static_cast<const void*>(&stream), bytesTransferred);
+
+    _streamWriting = false;
+
+    if (!_writeSwitched)
+    {
+        _listener->OnAsyncWriteSomeDone(*this, bytesTransferred);
+        return;
+    }
+
+    if (_doorbellPending)
+    {
+        RingDoorbell();
+    }
+}
+
+
+void SharedMemoryRawByteStream::OnShutdown(IRawByteStream& stream)
+{
+    SILKIT_UNUSED_ARG(stream);
+    SILKIT_TRACE_METHOD_(_logger, "({})", static_cast<const void*>(&stream));
+
+    _streamShutdown = true;
+    _streamReading = false;
+    _streamWriting = false;
+
+    // the remote side will not read anything anymore, but the data it has written must still be delivered
+    _writing = false;
+    if (_reading)
+    {
+        TryRead();
+    }
+
+    TryPostShutdown();
+}
+
+
+// private
+
+
+void SharedMemoryRawByteStream::AttachSegment(std::unique_ptr<SharedMemorySegment> segment, bool creator)
+{
+    auto* data = static_cast<uint8_t*>(segment->GetData());
+    const auto ringBufferSize = static_cast<size_t>(reinterpret_cast<const SegmentHeader*>(data)->ringBufferSize);
+
+    auto* creatorRingBuffer = data + SEGMENT_HEADER_SIZE;
+    auto* openerRingBuffer = data + SEGMENT_HEADER_SIZE + ringBufferSize;
+
+    auto writeRingBuffer =
+        std::make_unique<SharedMemoryRingBuffer>(creator ? creatorRingBuffer : openerRingBuffer, ringBufferSize);
+    auto readRingBuffer =
+        std::make_unique<SharedMemoryRingBuffer>(creator ? openerRingBuffer : creatorRingBuffer, ringBufferSize);
+
+    _segment = std::move(segment);
+    _writeRingBuffer = std::move(writeRingBuffer);
+    _readRingBuffer = std::move(readRingBuffer);
+}
+
+
+void SharedMemoryRawByteStream::TryRead()
+{
+    try
+    {
+        while (true)
+        {
+            const auto bytesTransferred =
+                _readRingBuffer->Read(MutableBufferSequence{_readBufferSequence.data(), _readBufferSequence.size()});
+
+            if (bytesTransferred != 0)
+            {
+                _reading = false;
+
+                if (_readRingBuffer->ConsumeWriterWaiting())
+                {
+                    RingDoorbell();
+                }
+
+                PostReadDone(bytesTransferred);
+                return;
+            }
+
+            if (_streamShutdown)
+            {
+                // the ring buffer has been drained completely
+                _reading = false;
+                TryPostShutdown();
+                return;
+            }
+
+            if (_readRingBuffer->WaitForData())
+            {
+                // the remote side rings the doorbell after writing
+                return;
+            }
+        }
+    }
+    catch (const SilKit::SilKitError& error)
+    {
+        HandleRingBufferError(error);
+    }
+}
+
+
+void SharedMemoryRawByteStream::TryWrite()
+{
+    try
+    {
+        while (true)
+        {
+            const auto bytesTransferred =
+                _writeRingBuffer->Write(ConstBufferSequence{_writeBufferSequence.data(), _writeBufferSequence.size()});
+
+            if (bytesTransferred != 0)
+            {
+                _writing = false;
+
+                if (_writeRingBuffer->ConsumeReaderWaiting())
+                {
+                    RingDoorbell();
+                }
+
+                PostWriteDone(bytesTransferred);
+                return;
+            }
+
+            if (_writeRingBuffer->WaitForSpace())
+            {
+                // the remote side rings the doorbell after reading
+                return;
+            }
+        }
+    }
+    catch (const SilKit::SilKitError& error)
+    {
+        HandleRingBufferError(error);
+    }
+}
+
+
+void SharedMemoryRawByteStream::PostReadDone(size_t bytesTransferred)
+{
+    // the completion is never invoked directly, since the listener usually starts the next read from within it
+    ++_postedOperations;
+    _strand->Post([this, bytesTransferred] {
+        --_postedOperations;
+        _listener->OnAsyncReadSomeDone(*this, bytesTransferred);
+        TryPostShutdown();
+    });
+}
+
+
+void SharedMemoryRawByteStream::PostWriteDone(size_t bytesTransferred)
+{
+    ++_postedOperations;
+    _strand->Post([this, bytesTransferred] {
+        --_postedOperations;
+        _listener->OnAsyncWriteSomeDone(*this, bytesTransferred);
+        TryPostShutdown();
+    });
+}
+
+
+void SharedMemoryRawByteStream::RingDoorbell()
+{
+    // the socket can only carry doorbells after the write direction has been switched
+    if (!_writeSwitched || _streamWriting)
+    {
+        _doorbellPending = true;
+        return;
+    }
+
+    _doorbellPending = false;
+
+    if (_streamShutdown)
+    {
+        return;
+    }
+
+    _streamWriting = true;
+    _stream->AsyncWriteSome(ConstBufferSequence{&_doorbellWriteBuffer, 1});
+}
+
+
+void SharedMemoryRawByteStream::StartDoorbellRead()
+{
+    if (_streamShutdown || _streamReading)
+    {
+        return;
+    }
+
+    _streamReading = true;
+    _stream->AsyncReadSome(MutableBufferSequence{&_doorbellReadBuffer, 1});
+}
+
+
+void SharedMemoryRawByteStream::TryPostShutdown()
+{
+    // the listener may destroy this object when it is notified about the shutdown, which is therefore delayed until
+    // no completion is pending anymore, and until the remaining data has been read by the listener
+    if (!_streamShutdown || _shutdownPosted || _reading || _postedOperations != 0)
+    {
+        return;
+    }
+
+    _shutdownPosted = true;
+
+    _strand->Post([this] {
+        _listener->OnShutdown(*this);
+    });
+}
+
+
+void SharedMemoryRawByteStream::HandleRingBufferError(const std::exception& error)
+{
+    Log::Error(_logger, "SharedMemoryRawByteStream: shutting down after ring buffer error: {}", error.what());
+
+    _reading = false;
+    _writing = false;
+
+    _stream->Shutdown();
+}
+
+
+} // namespace VSilKit
+
+
+#undef SILKIT_TRACE_METHOD_
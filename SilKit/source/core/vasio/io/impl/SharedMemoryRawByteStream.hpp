@@ -0,0 +1,129 @@
+#pragma once
+
+
+#include "IRawByteStream.hpp"
+#include "IStrand.hpp"
+
+#include "SharedMemoryRingBuffer.hpp"
+#include "SharedMemorySegment.hpp"
+
+#include "ILogger.hpp"
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace VSilKit {
+
+
+//! Byte stream which moves the traffic of a local-domain socket connection into shared memory.
+//!
+//! Initially all operations are passed through to the wrapped socket stream. Once a shared memory segment has been
+//! attached, each direction can be switched to its ring buffer individually. The switch must happen at the same
+//! position in the byte stream on both sides, i.e., the writing side switches after the last byte it sends through
+//! the socket, and the reading side switches after it has received exactly that byte.
+//!
+//! After the switch, the socket only carries single-byte doorbells, which wake up the remote side if (and only if) it
+//! announced to be waiting on the ring buffer. The socket is also used to detect that the remote side has gone away.
+//! Data remaining in the ring buffer is still delivered after the socket has been closed by the remote side.
+//!
+//! All methods, except Shutdown, must be called from the strand of the wrapped stream, which is shared by this stream.
+class SharedMemoryRawByteStream final
+    : public IRawByteStream
+    , private IRawByteStreamListener
+{
+    std::unique_ptr<IRawByteStream> _stream;
+    IStrand* _strand{nullptr};
+    SilKit::Services::Logging::ILogger* _logger{nullptr};
+
+    IRawByteStreamListener* _listener{nullptr};
+
+    std::unique_ptr<SharedMemorySegment> _segment;
+    std::unique_ptr<SharedMemoryRingBuffer> _readRingBuffer;
+    std::unique_ptr<SharedMemoryRingBuffer> _writeRingBuffer;
+    bool _readSwitched{false};
+    bool _writeSwitched{false};
+
+    // operations of the listener waiting for the ring buffer
+    bool _reading{false};
+    bool _writing{false};
+    std::vector<MutableBuffer> _readBufferSequence;
+    std::vector<ConstBuffer> _writeBufferSequence;
+    size_t _postedOperations{0};
+
+    // state of the wrapped socket stream
+    bool _streamReading{false};
+    bool _streamWriting{false};
+    bool _streamShutdown{false};
+    bool _shutdownPosted{false};
+
+    // doorbells
+    bool _doorbellPending{false};
+    std::array<uint8_t, 64> _doorbellReadData{};
+    MutableBuffer _doorbellReadBuffer;
+    ConstBuffer _doorbellWriteBuffer;
+
+public:
+    SharedMemoryRawByteStream(std::unique_ptr<IRawByteStream> stream, SilKit::Services::Logging::ILogger& logger);
+    ~SharedMemoryRawByteStream() override;
+
+    //! Create a new segment containing a ring buffer of the given capacity for each direction and attach it. Returns
+    //! the name of the segment, which must be passed to the remote side. Throws on failure.
+    auto CreateSharedMemory(size_t ringBufferCapacity) -> std::string;
+
+    //! Open the segment created by the remote side and attach it. Throws on failure.
+    void OpenSharedMemory(const std::string& name);
+
+    //! Detach and release the segment. Must not be called after either direction has been switched.
+    void ReleaseSharedMemory();
+
+    auto HasSharedMemory() const -> bool;
+
+    //! Write all further data into the ring buffer. Must not be called while a write is in progress.
+    void SwitchWriteToSharedMemory();
+
+    //! Read all further data from the ring buffer. Must not be called while a read is in progress.
+    void SwitchReadToSharedMemory();
+
+    auto IsWriteSwitched() const -> bool;
+    auto IsReadSwitched() const -> bool;
+
+public: // IRawByteStream
+    void SetListener(IRawByteStreamListener& listener) override;
+    auto GetLocalEndpoint() const -> std::string override;
+    auto GetRemoteEndpoint() const -> std::string override;
+    auto GetStrand() -> IStrand& override;
+    void AsyncReadSome(MutableBufferSequence bufferSequence) override;
+    void AsyncWriteSome(ConstBufferSequence bufferSequence) override;
+    void Shutdown() override;
+    //! Always the round-trip time of the underlying stream, also after switching to shared memory.
+    auto GetRoundTripTime() const -> std::chrono::microseconds override;
+
+private: // IRawByteStreamListener
+    void OnAsyncReadSomeDone(IRawByteStream& stream, size_t bytesTransferred) override;
+    void OnAsyncWriteSomeDone(IRawByteStream& stream, size_t bytesTransferred) override;
+    void OnShutdown(IRawByteStream& stream) override;
+
+private:
+    void AttachSegment(std::unique_ptr<SharedMemorySegment> segment, bool creator);
+    void TryRead();
+    void TryWrite();
+    void PostReadDone(size_t bytesTransferred);
+    void PostWriteDone(size_t bytesTransferred);
+    void RingDoorbell();
+    void StartDoorbellRead();
+    void TryPostShutdown();
+    void HandleRingBufferError(const std::exception& error);
+};
+
+
+} // namespace VSilKit
+
+
+namespace SilKit {
+namespace Core {
+using VSilKit::SharedMemoryRawByteStream;
+} // namespace Core
+} // namespace SilKit
@@ -0,0 +1,240 @@
+#include "SharedMemoryRingBuffer.hpp"
+
+#include "silkit/participant/exception.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+
+namespace {
+
+
+constexpr uint32_t RING_BUFFER_MAGIC{0x53524230}; // 'SRB0'
+
+constexpr size_t CACHE_LINE_SIZE{64};
+
+
+auto IsPowerOfTwo(uint64_t value) -> bool
+{
+    return value != 0 && (value & (value - 1)) == 0;
+}
+
+
+} // namespace
+
+
+namespace VSilKit {
+
+
+// The positions are only ever incremented and are reduced modulo the capacity when accessing the data. The atomics
+// must be lock-free to be usable across process boundaries.
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "the ring buffer requires lock-free 64-bit atomics");
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "the ring buffer requires lock-free 32-bit atomics");
+
+
+struct SharedMemoryRingBuffer::Header
+{
+    // written by the producer
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> writePosition;
+    std::atomic<uint32_t> writerWaiting;
+
+    // written by the consumer
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> readPosition;
+    std::atomic<uint32_t> readerWaiting;
+
+    // written once during initialization
+    alignas(CACHE_LINE_SIZE) uint32_t magic;
+    uint64_t capacity;
+};
+
+
+auto SharedMemoryRingBuffer::GetRequiredSize(size_t capacity) -> size_t
+{
+    return sizeof(Header) + capacity;
+}
+
+
+void SharedMemoryRingBuffer::Initialize(void* memory, size_t capacity)
+{
+    if (!IsPowerOfTwo(capacity))
+    {
+        throw SilKit::SilKitError{"SharedMemoryRingBuffer: capacity must be a power of two"};
+    }
+
+    auto* header = new (memory) Header{};
+    header->writePosition.store(0);
+    header->writerWaiting.store(0);
+    header->readPosition.store(0);
+    header->readerWaiting.store(0);
+    header->magic = RING_BUFFER_MAGIC;
+    header->capacity = capacity;
+}
+
+
+SharedMemoryRingBuffer::SharedMemoryRingBuffer(void* memory, size_t size)
+{
+    if (size < sizeof(Header))
+    {
+        throw SilKit::SilKitError{"SharedMemoryRingBuffer: memory is too small"};
+    }
+
+    _header = static_cast<Header*>(memory);
+    _data = static_cast<uint8_t*>(memory) + sizeof(Header);
+    _capacity = _header->capacity;
+
+    if (_header->magic != RING_BUFFER_MAGIC || !IsPowerOfTwo(_capacity) || _capacity > size - sizeof(Header))
+    {
+        throw SilKit::SilKitError{"SharedMemoryRingBuffer: memory does not contain a valid ring buffer"};
+    }
+}
+
+
+auto SharedMemoryRingBuffer::GetCapacity() const -> size_t
+{
+    return static_cast<size_t>(_capacity);
+}
+
+
+auto SharedMemoryRingBuffer::Write(ConstBufferSequence bufferSequence) -> size_t
+{
+    const auto writePosition = _header->writePosition.load(std::memory_order_relaxed);
+    const auto readPosition = _header->readPosition.load(std::memory_order_acquire);
+
+    const auto used = writePosition - readPosition;
+    if (used > _capacity)
+    {
+        throw SilKit::ProtocolError{"SharedMemoryRingBuffer: ring buffer positions are corrupted"};
+    }
+
+    auto free = _capacity - used;
+    auto position = writePosition;
+
+    for (const auto& buffer : bufferSequence)
+    {
+        if (free == 0)
+        {
+            break;
+        }
+
+        const auto size = std::min<uint64_t>(buffer.GetSize(), free);
+        if (size == 0)
+        {
+            continue;
+        }
+
+        const auto offset = position & (_capacity - 1);
+        const auto first = std::min(size, _capacity - offset);
+
+        std::memcpy(_data + offset, buffer.GetData(), static_cast<size_t>(first));
+        std::memcpy(_data, static_cast<const uint8_t*>(buffer.GetData()) + first, static_cast<size_t>(size - first));
+
+        position += size;
+        free -= size;
+    }
+
+    // sequentially consistent, to order the store before the load in ConsumeReaderWaiting
+    _header->writePosition.store(position, std::memory_order_seq_cst);
+
+    return static_cast<size_t>(position - writePosition);
+}
+
+
+auto SharedMemoryRingBuffer::Read(MutableBufferSequence bufferSequence) -> size_t
+{
+    const auto readPosition = _header->readPosition.load(std::memory_order_relaxed);
+
+    auto available = GetAvailable();
+    auto position = readPosition;
+
+    for (const auto& buffer : bufferSequence)
+    {
+        if (available == 0)
+        {
+            break;
+        }
+
+        const auto size = std::min<uint64_t>(buffer.GetSize(), available);
+        if (size == 0)
+        {
+            continue;
+        }
+
+        const auto offset = position & (_capacity - 1);
+        const auto first = std::min(size, _capacity - offset);
+
+        std::memcpy(buffer.GetData(), _data + offset, static_cast<size_t>(first));
+        std::memcpy(static_cast<uint8_t*>(buffer.GetData()) + first, _data, static_cast<size_t>(size - first));
+
+        position += size;
+        available -= size;
+    }
+
+    // sequentially consistent, to order the store before the load in ConsumeWriterWaiting
+    _header->readPosition.store(position, std::memory_order_seq_cst);
+
+    return static_cast<size_t>(position - readPosition);
+}
+
+
+auto SharedMemoryRingBuffer::WaitForData() -> bool
+{
+    _header->readerWaiting.store(1, std::memory_order_seq_cst);
+
+    if (GetAvailable() != 0)
+    {
+        _header->readerWaiting.store(0, std::memory_order_relaxed);
+        return false;
+    }
+
+    return true;
+}
+
+
+auto SharedMemoryRingBuffer::WaitForSpace() -> bool
+{
+    _header->writerWaiting.store(1, std::memory_order_seq_cst);
+
+    const auto writePosition = _header->writePosition.load(std::memory_order_relaxed);
+    const auto readPosition = _header->readPosition.load(std::memory_order_seq_cst);
+    if (writePosition - readPosition < _capacity)
+    {
+        _header->writerWaiting.store(0, std::memory_order_relaxed);
+        return false;
+    }
+
+    return true;
+}
+
+
+auto SharedMemoryRingBuffer::ConsumeReaderWaiting() -> bool
+{
+    // avoid the (more expensive) exchange in the common case, where the consumer is busy
+    return _header->readerWaiting.load(std::memory_order_seq_cst) != 0
+           && _header->readerWaiting.exchange(0, std::memory_order_seq_cst) != 0;
+}
+
+
+auto SharedMemoryRingBuffer::ConsumeWriterWaiting() -> bool
+{
+    return _header->writerWaiting.load(std::memory_order_seq_cst) != 0
+           && _header->writerWaiting.exchange(0, std::memory_order_seq_cst) != 0;
+}
+
+
+auto SharedMemoryRingBuffer::GetAvailable() const -> uint64_t
+{
+    const auto readPosition = _header->readPosition.load(std::memory_order_relaxed);
+    const auto writePosition = _header->writePosition.load(std::memory_order_seq_cst);
+
+    const auto available = writePosition - readPosition;
+    if (available > _capacity)
+    {
+        throw SilKit::ProtocolError{"SharedMemoryRingBuffer: ring buffer positions are corrupted"};
+    }
+
+    return available;
+}
+
+
+} // namespace VSilKit
@@ -0,0 +1,76 @@
+#pragma once
+
+
+#include "util/Buffer.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace VSilKit {
+
+
+//! Single-producer single-consumer byte ring buffer residing in (shared) memory.
+//!
+//! The producer and the consumer may live in different processes. Both sides access the ring buffer through their own
+//! SharedMemoryRingBuffer object, which only holds a pointer into the memory and the validated capacity.
+//!
+//! Neither side ever blocks. A side that cannot make progress announces that it is waiting (WaitForData or
+//! WaitForSpace) and relies on the other side to wake it up via some out-of-band notification, whenever
+//! ConsumeReaderWaiting or ConsumeWriterWaiting returns true.
+class SharedMemoryRingBuffer
+{
+public:
+    struct Header;
+
+private:
+    Header* _header{nullptr};
+    uint8_t* _data{nullptr};
+    uint64_t _capacity{0};
+
+public:
+    //! Number of bytes required for a ring buffer with the given capacity (which must be a power of two).
+    static auto GetRequiredSize(size_t capacity) -> size_t;
+
+    //! Initialize an empty ring buffer in the memory. Must be called exactly once, before any side attaches to it.
+    static void Initialize(void* memory, size_t capacity);
+
+    //! Attach to a ring buffer initialized in the memory. Throws if the memory does not contain a valid ring buffer.
+    SharedMemoryRingBuffer(void* memory, size_t size);
+
+    auto GetCapacity() const -> size_t;
+
+    //! Copy as many bytes from the buffer sequence as fit into the ring buffer. Returns the number of bytes copied.
+    auto Write(ConstBufferSequence bufferSequence) -> size_t;
+
+    //! Copy as many bytes from the ring buffer into the buffer sequence as are available. Returns the number of bytes
+    //! copied.
+    auto Read(MutableBufferSequence bufferSequence) -> size_t;
+
+    //! Announce that the consumer waits for data. Returns false (and withdraws the announcement) if data is available.
+    auto WaitForData() -> bool;
+
+    //! Announce that the producer waits for space. Returns false (and withdraws the announcement) if space is
+    //! available.
+    auto WaitForSpace() -> bool;
+
+    //! Called by the producer after writing. Returns true if the consumer was waiting and must be woken up.
+    auto ConsumeReaderWaiting() -> bool;
+
+    //! Called by the consumer after reading. Returns true if the producer was waiting and must be woken up.
+    auto ConsumeWriterWaiting() -> bool;
+
+private:
+    auto GetAvailable() const -> uint64_t;
+};
+
+
+} // namespace VSilKit
+
+
+namespace SilKit {
+namespace Core {
+using VSilKit::SharedMemoryRingBuffer;
+} // namespace Core
+} // namespace SilKit
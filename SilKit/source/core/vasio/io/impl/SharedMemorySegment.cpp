@@ -0,0 +1,211 @@
+#include "SharedMemorySegment.hpp"
+
+#include "silkit/participant/exception.hpp"
+
+#include "fmt/format.h"
+
+#include <random>
+
+#if !defined(_WIN32)
+#    include <cerrno>
+#    include <cstring>
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+
+namespace VSilKit {
+
+
+#if !defined(_WIN32)
+
+
+namespace {
+
+
+//! Number of attempts to find an unused segment name.
+constexpr int MAX_CREATE_ATTEMPTS{16};
+
+
+auto MakeErrorMessage(const char* operation, const std::string& name, int error) -> std::string
+{
+    return fmt::format("SharedMemorySegment: {} of '{}' failed: {}", operation, name, std::strerror(error));
+}
+
+
+auto MakeSegmentName() -> std::string
+{
+    thread_local std::mt19937 generator{std::random_device{}()};
+    // Keep the name short, some platforms (e.g., macOS) limit it to 31 characters.
+    return fmt::format("/silkit-{:x}-{:08x}", static_cast<unsigned long>(::getpid()),
+                       static_cast<uint32_t>(generator()));
+}
+
+
+} // namespace
+
+
+auto SharedMemorySegment::IsSupported() -> bool
+{
+    return true;
+}
+
+
+auto SharedMemorySegment::Create(size_t size) -> std::unique_ptr<SharedMemorySegment>
+{
+    std::string name;
+    int fd{-1};
+
+    for (int attempt = 0; attempt != MAX_CREATE_ATTEMPTS && fd == -1; ++attempt)
+    {
+        name = MakeSegmentName();
+        fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+        if (fd == -1 && errno != EEXIST)
+        {
+            throw SilKit::SilKitError{MakeErrorMessage("shm_open", name, errno)};
+        }
+    }
+
+    if (fd == -1)
+    {
+        throw SilKit::SilKitError{"SharedMemorySegment: unable to find an unused segment name"};
+    }
+
+    if (::ftruncate(fd, static_cast<off_t>(size)) == -1)
+    {
+        const auto error = errno;
+        ::close(fd);
+        ::shm_unlink(name.c_str());
+        throw SilKit::SilKitError{MakeErrorMessage("ftruncate", name, error)};
+    }
+
+    auto* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    const auto error = errno;
+    ::close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        ::shm_unlink(name.c_str());
+        throw SilKit::SilKitError{MakeErrorMessage("mmap", name, error)};
+    }
+
+    return std::unique_ptr<SharedMemorySegment>{new SharedMemorySegment{std::move(name), data, size, true}};
+}
+
+
+auto SharedMemorySegment::Open(const std::string& name) -> std::unique_ptr<SharedMemorySegment>
+{
+    const int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+    if (fd == -1)
+    {
+        throw SilKit::SilKitError{MakeErrorMessage("shm_open", name, errno)};
+    }
+
+    // the name is not needed anymore, the segment is removed when both sides have unmapped it
+    ::shm_unlink(name.c_str());
+
+    struct stat status
+    {
+    };
+    if (::fstat(fd, &status) == -1)
+    {
+        const auto error = errno;
+        ::close(fd);
+        throw SilKit::SilKitError{MakeErrorMessage("fstat", name, error)};
+    }
+
+    const auto size = static_cast<size_t>(status.st_size);
+
+    auto* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    const auto error = errno;
+    ::close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        throw SilKit::SilKitError{MakeErrorMessage("mmap", name, error)};
+    }
+
+    return std::unique_ptr<SharedMemorySegment>{new SharedMemorySegment{name, data, size, false}};
+}
+
+
+SharedMemorySegment::~SharedMemorySegment()
+{
+    Unlink();
+    ::munmap(_data, _size);
+}
+
+
+void SharedMemorySegment::Unlink()
+{
+    if (_linked)
+    {
+        _linked = false;
+        ::shm_unlink(_name.c_str());
+    }
+}
+
+
+#else
+
+
+auto SharedMemorySegment::IsSupported() -> bool
+{
+    return false;
+}
+
+
+auto SharedMemorySegment::Create(size_t) -> std::unique_ptr<SharedMemorySegment>
+{
+    throw SilKit::SilKitError{"SharedMemorySegment: shared memory segments are not supported on this platform"};
+}
+
+
+auto SharedMemorySegment::Open(const std::string&) -> std::unique_ptr<SharedMemorySegment>
+{
+    throw SilKit::SilKitError{"SharedMemorySegment: shared memory segments are not supported on this platform"};
+}
+
+
+SharedMemorySegment::~SharedMemorySegment() = default;
+
+
+void SharedMemorySegment::Unlink()
+{
+    _linked = false;
+}
+
+
+#endif
+
+
+SharedMemorySegment::SharedMemorySegment(std::string name, void* data, size_t size, bool linked)
+    : _name{std::move(name)}
+    , _data{data}
+    , _size{size}
+    , _linked{linked}
+{
+}
+
+
+auto SharedMemorySegment::GetName() const -> const std::string&
+{
+    return _name;
+}
+
+
+auto SharedMemorySegment::GetData() const -> void*
+{
+    return _data;
+}
+
+
+auto SharedMemorySegment::GetSize() const -> size_t
+{
+    return _size;
+}
+
+
+} // namespace VSilKit
@@ -0,0 +1,56 @@
+#pragma once
+
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+
+namespace VSilKit {
+
+
+//! Named shared memory segment, mapped into the address space of the current process.
+//!
+//! One side creates the segment and passes its name to the other side, which opens it. The name is only required
+//! until the other side has opened the segment, the mapping stays valid after the name has been removed.
+class SharedMemorySegment
+{
+    std::string _name;
+    void* _data{nullptr};
+    size_t _size{0};
+    bool _linked{false};
+
+public:
+    SharedMemorySegment(const SharedMemorySegment&) = delete;
+    SharedMemorySegment& operator=(const SharedMemorySegment&) = delete;
+    ~SharedMemorySegment();
+
+    //! Returns true if shared memory segments are supported on this platform.
+    static auto IsSupported() -> bool;
+
+    //! Create a new, zero-initialized segment of the given size with a unique name. Throws on failure.
+    static auto Create(size_t size) -> std::unique_ptr<SharedMemorySegment>;
+
+    //! Open the segment with the given name and remove the name afterwards. Throws on failure.
+    static auto Open(const std::string& name) -> std::unique_ptr<SharedMemorySegment>;
+
+    auto GetName() const -> const std::string&;
+    auto GetData() const -> void*;
+    auto GetSize() const -> size_t;
+
+    //! Remove the name of the segment. The mapping stays valid.
+    void Unlink();
+
+private:
+    SharedMemorySegment(std::string name, void* data, size_t size, bool linked);
+};
+
+
+} // namespace VSilKit
+
+
+namespace SilKit {
+namespace Core {
+using VSilKit::SharedMemorySegment;
+} // namespace Core
+} // namespace SilKit
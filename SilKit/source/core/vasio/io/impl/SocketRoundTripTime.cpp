@@ -0,0 +1,40 @@
+#include "SocketRoundTripTime.hpp"
+
+
+#if defined(__linux__)
+#    include <netinet/in.h>
+#    include <netinet/tcp.h>
+#    include <sys/socket.h>
+#endif
+
+
+namespace VSilKit {
+
+
+#if defined(__linux__)
+
+auto GetSocketRoundTripTime(int fd) -> std::chrono::microseconds
+{
+    tcp_info info{};
+    socklen_t length = sizeof(info);
+
+    // fails for local-domain sockets
+    if (getsockopt(fd, IPPROTO_TCP, TCP_INFO, &info, &length) != 0)
+    {
+        return std::chrono::microseconds{0};
+    }
+
+    return std::chrono::microseconds{info.tcpi_rtt};
+}
+
+#else
+
+auto GetSocketRoundTripTime(int) -> std::chrono::microseconds
+{
+    return std::chrono::microseconds{0};
+}
+
+#endif
+
+
+} // namespace VSilKit
@@ -0,0 +1,15 @@
+#pragma once
+
+
+#include <chrono>
+
+
+namespace VSilKit {
+
+
+//! Smoothed round-trip time of a connected TCP socket, as estimated by the kernel. Returns zero for other sockets,
+//! and on platforms other than Linux.
+auto GetSocketRoundTripTime(int fd) -> std::chrono::microseconds;
+
+
+} // namespace VSilKit
@@ -0,0 +1,252 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include "SharedMemoryRingBuffer.hpp"
+#include "SharedMemorySegment.hpp"
+
+#include "silkit/participant/exception.hpp"
+
+#include <cstring>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+
+namespace {
+
+
+using SilKit::Core::ConstBuffer;
+using SilKit::Core::ConstBufferSequence;
+using SilKit::Core::MutableBuffer;
+using SilKit::Core::MutableBufferSequence;
+using SilKit::Core::SharedMemoryRingBuffer;
+using SilKit::Core::SharedMemorySegment;
+
+
+struct Test_SharedMemoryRingBuffer : ::testing::Test
+{
+    static constexpr size_t capacity{64};
+
+    std::vector<uint64_t> memory = std::vector<uint64_t>(SharedMemoryRingBuffer::GetRequiredSize(capacity) / 8 + 8);
+
+    auto GetAlignedMemory() -> void*
+    {
+        // the header requires cache-line alignment
+        auto address = reinterpret_cast<uintptr_t>(memory.data());
+        address = (address + 63) / 64 * 64;
+        return reinterpret_cast<void*>(address);
+    }
+
+    auto MakeRingBuffer() -> SharedMemoryRingBuffer
+    {
+        SharedMemoryRingBuffer::Initialize(GetAlignedMemory(), capacity);
+        return SharedMemoryRingBuffer{GetAlignedMemory(), SharedMemoryRingBuffer::GetRequiredSize(capacity)};
+    }
+
+    static auto Write(SharedMemoryRingBuffer& ringBuffer, const std::vector<uint8_t>& data) -> size_t
+    {
+        ConstBuffer buffer{data.data(), data.size()};
+        return ringBuffer.Write(ConstBufferSequence{&buffer, 1});
+    }
+
+    static auto Read(SharedMemoryRingBuffer& ringBuffer, size_t size) -> std::vector<uint8_t>
+    {
+        std::vector<uint8_t> data(size);
+        MutableBuffer buffer{data.data(), data.size()};
+        data.resize(ringBuffer.Read(MutableBufferSequence{&buffer, 1}));
+        return data;
+    }
+
+    static auto MakeData(size_t size, uint8_t first) -> std::vector<uint8_t>
+    {
+        std::vector<uint8_t> data(size);
+        std::iota(data.begin(), data.end(), first);
+        return data;
+    }
+};
+
+constexpr size_t Test_SharedMemoryRingBuffer::capacity;
+
+
+TEST_F(Test_SharedMemoryRingBuffer, capacity_must_be_a_power_of_two)
+{
+    EXPECT_THROW(SharedMemoryRingBuffer::Initialize(GetAlignedMemory(), 48), SilKit::SilKitError);
+}
+
+TEST_F(Test_SharedMemoryRingBuffer, uninitialized_memory_is_rejected)
+{
+    EXPECT_THROW((SharedMemoryRingBuffer{GetAlignedMemory(), SharedMemoryRingBuffer::GetRequiredSize(capacity)}),
+                 SilKit::SilKitError);
+}
+
+TEST_F(Test_SharedMemoryRingBuffer, read_returns_written_data)
+{
+    auto ringBuffer{MakeRingBuffer()};
+    EXPECT_EQ(ringBuffer.GetCapacity(), capacity);
+
+    const auto data{MakeData(10, 1)};
+    EXPECT_EQ(Write(ringBuffer, data), data.size());
+    EXPECT_EQ(Read(ringBuffer, 100), data);
+    EXPECT_TRUE(Read(ringBuffer, 100).empty());
+}
+
+TEST_F(Test_SharedMemoryRingBuffer, write_is_limited_to_free_space)
+{
+    auto ringBuffer{MakeRingBuffer()};
+
+    const auto data{MakeData(100, 0)};
+    EXPECT_EQ(Write(ringBuffer, data), capacity);
+    EXPECT_EQ(Write(ringBuffer, data), 0u);
+
+    EXPECT_EQ(Read(ringBuffer, 16), MakeData(16, 0));
+    EXPECT_EQ(Write(ringBuffer, MakeData(100, 64)), 16u);
+
+    EXPECT_EQ(Read(ringBuffer, 100), MakeData(capacity, 16));
+}
+
+TEST_F(Test_SharedMemoryRingBuffer, data_wraps_around_the_end)
+{
+    auto ringBuffer{MakeRingBuffer()};
+
+    for (uint8_t round = 0; round != 20; ++round)
+    {
+        const auto data{MakeData(27, round)};
+        ASSERT_EQ(Write(ringBuffer, data), data.size());
+        ASSERT_EQ(Read(ringBuffer, data.size()), data);
+    }
+}
+
+TEST_F(Test_SharedMemoryRingBuffer, buffer_sequences_are_gathered_and_scattered)
+{
+    auto ringBuffer{MakeRingBuffer()};
+
+    const auto first{MakeData(5, 0)};
+    const auto second{MakeData(7, 5)};
+    std::vector<ConstBuffer> writeBuffers{{first.data(), first.size()}, {nullptr, 0}, {second.data(), second.size()}};
+    EXPECT_EQ(ringBuffer.Write(ConstBufferSequence{writeBuffers.data(), writeBuffers.size()}), 12u);
+
+    std::vector<uint8_t> head(3);
+    std::vector<uint8_t> tail(20);
+    std::vector<MutableBuffer> readBuffers{{head.data(), head.size()}, {tail.data(), tail.size()}};
+    EXPECT_EQ(ringBuffer.Read(MutableBufferSequence{readBuffers.data(), readBuffers.size()}), 12u);
+
+    EXPECT_EQ(head, MakeData(3, 0));
+    tail.resize(9);
+    EXPECT_EQ(tail, MakeData(9, 3));
+}
+
+TEST_F(Test_SharedMemoryRingBuffer, waiting_reader_is_woken_up_by_writer)
+{
+    auto ringBuffer{MakeRingBuffer()};
+
+    EXPECT_FALSE(ringBuffer.ConsumeReaderWaiting());
+    EXPECT_TRUE(ringBuffer.WaitForData());
+
+    Write(ringBuffer, MakeData(1, 0));
+    EXPECT_TRUE(ringBuffer.ConsumeReaderWaiting());
+    EXPECT_FALSE(ringBuffer.ConsumeReaderWaiting());
+
+    // data is available, the reader must not wait
+    EXPECT_FALSE(ringBuffer.WaitForData());
+    EXPECT_FALSE(ringBuffer.ConsumeReaderWaiting());
+}
+
+TEST_F(Test_SharedMemoryRingBuffer, waiting_writer_is_woken_up_by_reader)
+{
+    auto ringBuffer{MakeRingBuffer()};
+
+    EXPECT_FALSE(ringBuffer.WaitForSpace());
+
+    Write(ringBuffer, MakeData(capacity, 0));
+    EXPECT_TRUE(ringBuffer.WaitForSpace());
+
+    Read(ringBuffer, 1);
+    EXPECT_TRUE(ringBuffer.ConsumeWriterWaiting());
+    EXPECT_FALSE(ringBuffer.ConsumeWriterWaiting());
+}
+
+TEST_F(Test_SharedMemoryRingBuffer, transfer_between_threads_through_shared_memory_segment)
+{
+    if (!SharedMemorySegment::IsSupported())
+    {
+        return;
+    }
+
+    constexpr size_t ringBufferCapacity{4096};
+    constexpr uint32_t count{200000};
+
+    auto creator{SharedMemorySegment::Create(SharedMemoryRingBuffer::GetRequiredSize(ringBufferCapacity))};
+    SharedMemoryRingBuffer::Initialize(creator->GetData(), ringBufferCapacity);
+
+    // the opener maps the segment to a different address
+    auto opener{SharedMemorySegment::Open(creator->GetName())};
+    ASSERT_NE(opener->GetData(), creator->GetData());
+    ASSERT_EQ(opener->GetSize(), creator->GetSize());
+
+    SharedMemoryRingBuffer producer{creator->GetData(), creator->GetSize()};
+    SharedMemoryRingBuffer consumer{opener->GetData(), opener->GetSize()};
+
+    std::thread producerThread{[&producer] {
+        for (uint32_t value = 0; value != count;)
+        {
+            ConstBuffer buffer{&value, sizeof(value)};
+            // values are written as a whole, because the capacity is a multiple of their size
+            if (producer.Write(ConstBufferSequence{&buffer, 1}) == sizeof(value))
+            {
+                ++value;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    }};
+
+    uint32_t expected{0};
+    uint32_t mismatches{0};
+    while (expected != count)
+    {
+        uint32_t values[64];
+        MutableBuffer buffer{values, sizeof(values)};
+        const auto size = consumer.Read(MutableBufferSequence{&buffer, 1});
+
+        for (size_t index = 0; index != size / sizeof(uint32_t); ++index)
+        {
+            mismatches += values[index] != expected ? 1 : 0;
+            ++expected;
+        }
+
+        if (size == 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    producerThread.join();
+
+    EXPECT_EQ(mismatches, 0u);
+}
+
+
+} // anonymous namespace
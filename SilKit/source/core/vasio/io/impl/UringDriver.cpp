@@ -0,0 +1,646 @@
+#include "UringDriver.hpp"
+#include "SocketRoundTripTime.hpp"
+
+#include "util/Exceptions.hpp"
+#include "util/TracingMacros.hpp"
+
+#include "silkit/participant/exception.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+
+#if SILKIT_ENABLE_TRACING_INSTRUMENTATION_UringDriver
+#    define SILKIT_TRACE_METHOD_(logger, ...) SILKIT_TRACE_METHOD(logger, __VA_ARGS__)
+#else
+#    define SILKIT_TRACE_METHOD_(...)
+#endif
+
+
+namespace {
+
+
+namespace Log = SilKit::Services::Logging;
+
+//! Number of submission queue entries. The completion queue has twice as many entries.
+constexpr unsigned RING_ENTRIES{256};
+
+//! Number and size of the buffers each socket receives into, before the data is consumed by reads.
+constexpr unsigned SOCKET_BUFFER_COUNT{16};
+constexpr size_t SOCKET_BUFFER_SIZE{16 * 1024};
+
+constexpr unsigned OPERATION_BITS{2};
+
+
+} // namespace
+
+
+namespace VSilKit {
+
+
+struct UringDriver::Socket
+{
+    struct Chunk
+    {
+        uint16_t bufferId{0};
+        size_t offset{0};
+        size_t size{0};
+    };
+
+    SocketId id{0};
+    int fd{-1};
+    std::unique_ptr<IoUringBufferRing> bufferRing;
+
+    IRawByteStream* stream{nullptr};
+    IStrand* strand{nullptr};
+    IRawByteStreamListener* listener{nullptr};
+
+    // received data, not yet consumed by reads
+    std::deque<Chunk> chunks;
+    bool receiving{false};
+    bool receiveClosed{false};
+    bool outOfBuffers{false};
+    bool multishot{true};
+
+    bool reading{false};
+    std::vector<MutableBuffer> readBufferSequence;
+
+    bool writing{false};
+    std::vector<iovec> writeIovecs;
+    msghdr writeMessage{};
+
+    bool shutdownPending{false};
+    bool shutdownPosted{false};
+    bool removed{false};
+};
+
+
+UringDriver::UringDriver(std::shared_ptr<asio::io_context> asioIoContext, SilKit::Services::Logging::ILogger* logger)
+    : _asioIoContext{std::move(asioIoContext)}
+    , _ring{RING_ENTRIES}
+    , _eventFdDescriptor{*_asioIoContext}
+    , _logger{logger}
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    const int eventFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (eventFd < 0)
+    {
+        throw SilKit::SilKitError{std::string{"UringDriver: eventfd failed: "} + std::strerror(errno)};
+    }
+
+    // the descriptor closes the eventfd on destruction
+    _eventFdDescriptor.assign(eventFd);
+    _eventFd = eventFd;
+
+    _ring.RegisterEventFd(_eventFd);
+}
+
+
+UringDriver::~UringDriver()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    // the buffer rings must be unregistered before the ring is destroyed
+    for (auto& pair : _sockets)
+    {
+        auto& socket = *pair.second;
+        if (socket.fd >= 0)
+        {
+            ::close(socket.fd);
+        }
+        socket.bufferRing.reset();
+    }
+}
+
+
+void UringDriver::SetLogger(SilKit::Services::Logging::ILogger& logger)
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    _logger = &logger;
+}
+
+
+auto UringDriver::AddSocket(int fd, IRawByteStream& stream, IStrand& strand) -> SocketId
+{
+    SILKIT_TRACE_METHOD_(_logger, "({}, ...)", fd);
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    const auto groupId = AllocateGroupId();
+
+    auto socket = std::make_shared<Socket>();
+    try
+    {
+        socket->bufferRing =
+            std::make_unique<IoUringBufferRing>(_ring, groupId, SOCKET_BUFFER_COUNT, SOCKET_BUFFER_SIZE);
+    }
+    catch (...)
+    {
+        _freeGroupIds.push_back(groupId);
+        throw;
+    }
+
+    socket->id = _nextSocketId++;
+    socket->fd = fd;
+    socket->stream = &stream;
+    socket->strand = &strand;
+
+    _sockets.emplace(socket->id, socket);
+
+    return socket->id;
+}
+
+
+void UringDriver::RemoveSocket(SocketId id)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", id);
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    auto& socket = GetSocket(id);
+    socket.stream = nullptr;
+    socket.strand = nullptr;
+    socket.listener = nullptr;
+    socket.removed = true;
+
+    HandleShutdownOrError(socket);
+    TryReleaseSocket(socket);
+
+    SubmitAndStartWait();
+}
+
+
+void UringDriver::SetListener(SocketId id, IRawByteStreamListener& listener)
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    GetSocket(id).listener = &listener;
+}
+
+
+void UringDriver::AsyncReadSome(SocketId id, MutableBufferSequence bufferSequence)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({}, ...)", id);
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    auto& socket = GetSocket(id);
+
+    if (socket.shutdownPending)
+    {
+        SILKIT_TRACE_METHOD_(_logger, "ignored, already shutting down");
+        return;
+    }
+
+    if (socket.reading)
+    {
+        throw InvalidStateError{};
+    }
+
+    socket.reading = true;
+    socket.readBufferSequence.assign(bufferSequence.begin(), bufferSequence.end());
+
+    TryCompleteRead(socket);
+    SubmitReceive(socket);
+
+    SubmitAndStartWait();
+}
+
+
+void UringDriver::AsyncWriteSome(SocketId id, ConstBufferSequence bufferSequence)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({}, ...)", id);
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    auto& socket = GetSocket(id);
+
+    if (socket.shutdownPending)
+    {
+        SILKIT_TRACE_METHOD_(_logger, "ignored, already shutting down");
+        return;
+    }
+
+    if (socket.writing)
+    {
+        throw InvalidStateError{};
+    }
+
+    socket.writeIovecs.resize(bufferSequence.size());
+    std::transform(bufferSequence.begin(), bufferSequence.end(), socket.writeIovecs.begin(),
+                   [](const ConstBuffer& buffer) -> iovec {
+                       return iovec{const_cast<void*>(buffer.GetData()), buffer.GetSize()};
+                   });
+
+    socket.writeMessage = msghdr{};
+    socket.writeMessage.msg_iov = socket.writeIovecs.data();
+    socket.writeMessage.msg_iovlen = socket.writeIovecs.size();
+
+    SubmitSend(socket);
+
+    SubmitAndStartWait();
+}
+
+
+void UringDriver::Shutdown(SocketId id)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", id);
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    HandleShutdownOrError(GetSocket(id));
+
+    SubmitAndStartWait();
+}
+
+
+auto UringDriver::GetRoundTripTime(SocketId id) -> std::chrono::microseconds
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    const auto& socket = GetSocket(id);
+    if (socket.shutdownPending || socket.fd < 0)
+    {
+        return std::chrono::microseconds{0};
+    }
+
+    return GetSocketRoundTripTime(socket.fd);
+}
+
+
+auto UringDriver::GetSocket(SocketId id) -> Socket&
+{
+    const auto it = _sockets.find(id);
+    if (it == _sockets.end())
+    {
+        throw InvalidStateError{};
+    }
+    return *it->second;
+}
+
+
+auto UringDriver::AllocateGroupId() -> uint16_t
+{
+    if (!_freeGroupIds.empty())
+    {
+        const auto groupId = _freeGroupIds.back();
+        _freeGroupIds.pop_back();
+        return groupId;
+    }
+
+    if (_sockets.size() > UINT16_MAX)
+    {
+        throw SilKit::SilKitError{"UringDriver: too many sockets"};
+    }
+
+    return _nextGroupId++;
+}
+
+
+auto UringDriver::MakeUserData(SocketId id, Operation operation) -> uint64_t
+{
+    return (id << OPERATION_BITS) | static_cast<uint64_t>(operation);
+}
+
+
+void UringDriver::SubmitReceive(Socket& socket)
+{
+    if (socket.receiving || socket.receiveClosed || socket.outOfBuffers || socket.shutdownPending)
+    {
+        return;
+    }
+
+    _ring.PrepareReceive(socket.fd, socket.bufferRing->GetGroupId(), socket.multishot,
+                         MakeUserData(socket.id, Operation::Receive));
+    socket.receiving = true;
+}
+
+
+void UringDriver::SubmitSend(Socket& socket)
+{
+    _ring.PrepareSendMessage(socket.fd, &socket.writeMessage, MakeUserData(socket.id, Operation::Send));
+    socket.writing = true;
+}
+
+
+void UringDriver::SubmitCancel(Socket& socket, Operation operation)
+{
+    _ring.PrepareCancel(MakeUserData(socket.id, operation), MakeUserData(socket.id, Operation::Cancel));
+}
+
+
+void UringDriver::OnReceiveComplete(Socket& socket, const IoUringCompletion& completion)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({}, {}, {})", socket.id, completion.result, completion.more);
+
+    if (!completion.more)
+    {
+        socket.receiving = false;
+    }
+
+    if (completion.hasBuffer)
+    {
+        if (completion.result > 0)
+        {
+            socket.chunks.push_back(Socket::Chunk{completion.bufferId, 0, static_cast<size_t>(completion.result)});
+        }
+        else
+        {
+            socket.bufferRing->Recycle(completion.bufferId);
+        }
+    }
+
+    if (completion.result == 0)
+    {
+        socket.receiveClosed = true;
+    }
+    else if (completion.result < 0)
+    {
+        switch (-completion.result)
+        {
+        case ENOBUFS:
+            // receiving continues once a buffer has been consumed
+            socket.outOfBuffers = !socket.chunks.empty();
+            break;
+        case EINVAL:
+            if (socket.multishot)
+            {
+                Log::Debug(_logger, "UringDriver: multishot receive is not supported, falling back to single receives");
+                socket.multishot = false;
+            }
+            else
+            {
+                socket.receiveClosed = true;
+            }
+            break;
+        case EINTR:
+        case EAGAIN:
+            break;
+        default:
+            socket.receiveClosed = true;
+            break;
+        }
+    }
+
+    if (socket.shutdownPending)
+    {
+        HandleShutdownOrError(socket);
+        return;
+    }
+
+    TryCompleteRead(socket);
+    SubmitReceive(socket);
+}
+
+
+void UringDriver::OnSendComplete(Socket& socket, const IoUringCompletion& completion)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({}, {})", socket.id, completion.result);
+
+    socket.writing = false;
+
+    const auto result = completion.result;
+
+    if (socket.shutdownPending || (result < 0 && result != -EINTR && result != -EAGAIN && result != -ENOBUFS))
+    {
+        HandleShutdownOrError(socket);
+        return;
+    }
+
+    if (result < 0)
+    {
+        // only re-trigger the write if no bytes were transferred
+        SubmitSend(socket);
+        return;
+    }
+
+    PostToStream(socket, [bytesTransferred = static_cast<size_t>(result)](auto& listener, auto& stream) {
+        listener.OnAsyncWriteSomeDone(stream, bytesTransferred);
+    });
+}
+
+
+void UringDriver::TryCompleteRead(Socket& socket)
+{
+    if (!socket.reading)
+    {
+        return;
+    }
+
+    if (socket.chunks.empty())
+    {
+        if (socket.receiveClosed)
+        {
+            socket.reading = false;
+            HandleShutdownOrError(socket);
+        }
+        return;
+    }
+
+    size_t bytesTransferred{0};
+
+    for (const auto& buffer : socket.readBufferSequence)
+    {
+        auto* data = static_cast<uint8_t*>(buffer.GetData());
+        auto size = buffer.GetSize();
+
+        while (size != 0 && !socket.chunks.empty())
+        {
+            auto& chunk = socket.chunks.front();
+
+            const auto count = std::min(size, chunk.size);
+            std::memcpy(data, socket.bufferRing->GetBuffer(chunk.bufferId) + chunk.offset, count);
+
+            data += count;
+            size -= count;
+            bytesTransferred += count;
+
+            chunk.offset += count;
+            chunk.size -= count;
+
+            if (chunk.size == 0)
+            {
+                socket.bufferRing->Recycle(chunk.bufferId);
+                socket.chunks.pop_front();
+                socket.outOfBuffers = false;
+            }
+        }
+    }
+
+    socket.reading = false;
+
+    PostToStream(socket, [bytesTransferred](auto& listener, auto& stream) {
+        listener.OnAsyncReadSomeDone(stream, bytesTransferred);
+    });
+}
+
+
+void UringDriver::HandleShutdownOrError(Socket& socket)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({}) [shutdownPending={}, shutdownPosted={}, receiving={}, writing={}]", socket.id,
+                        socket.shutdownPending, socket.shutdownPosted, socket.receiving, socket.writing);
+
+    if (!socket.shutdownPending)
+    {
+        socket.shutdownPending = true;
+
+        // wakes up the operations in flight, the cancellations make sure they complete
+        (void)::shutdown(socket.fd, SHUT_RDWR);
+
+        if (socket.receiving)
+        {
+            SubmitCancel(socket, Operation::Receive);
+        }
+        if (socket.writing)
+        {
+            SubmitCancel(socket, Operation::Send);
+        }
+    }
+
+    if (socket.receiving || socket.writing)
+    {
+        return;
+    }
+
+    if (socket.fd >= 0)
+    {
+        ::close(socket.fd);
+        socket.fd = -1;
+    }
+
+    if (!socket.shutdownPosted)
+    {
+        socket.shutdownPosted = true;
+
+        PostToStream(socket, [](auto& listener, auto& stream) {
+            listener.OnShutdown(stream);
+        });
+    }
+}
+
+
+void UringDriver::TryReleaseSocket(Socket& socket)
+{
+    if (!socket.removed || socket.receiving || socket.writing)
+    {
+        return;
+    }
+
+    const auto groupId = socket.bufferRing->GetGroupId();
+    socket.bufferRing.reset();
+    _freeGroupIds.push_back(groupId);
+
+    // destroys the socket
+    _sockets.erase(socket.id);
+}
+
+
+void UringDriver::PostToStream(Socket& socket, std::function<void(IRawByteStreamListener&, IRawByteStream&)> function)
+{
+    if (socket.strand == nullptr || socket.listener == nullptr)
+    {
+        return;
+    }
+
+    socket.strand->Post([listener = socket.listener, stream = socket.stream, function = std::move(function)] {
+        function(*listener, *stream);
+    });
+}
+
+
+void UringDriver::SubmitAndStartWait()
+{
+    _ring.Submit();
+
+    if (_waiting || !HasPendingWork())
+    {
+        return;
+    }
+
+    _waiting = true;
+
+    std::weak_ptr<UringDriver> weak{shared_from_this()};
+    _eventFdDescriptor.async_wait(asio::posix::stream_descriptor::wait_read, [weak](const asio::error_code& e) {
+        if (auto self = weak.lock())
+        {
+            self->OnEventFdReadable(e);
+        }
+    });
+}
+
+
+auto UringDriver::HasPendingWork() const -> bool
+{
+    return std::any_of(_sockets.begin(), _sockets.end(), [](const auto& pair) {
+        const auto& socket = *pair.second;
+        return socket.reading || socket.writing || (socket.shutdownPending && !socket.shutdownPosted)
+               || (socket.removed && socket.receiving);
+    });
+}
+
+
+void UringDriver::OnEventFdReadable(const asio::error_code& errorCode)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", errorCode.message());
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    _waiting = false;
+
+    if (errorCode)
+    {
+        return;
+    }
+
+    uint64_t counter{0};
+    (void)::read(_eventFd, &counter, sizeof(counter));
+
+    ProcessCompletions();
+    SubmitAndStartWait();
+}
+
+
+void UringDriver::ProcessCompletions()
+{
+    IoUringCompletion completion;
+    while (_ring.PopCompletion(completion))
+    {
+        const auto id = completion.userData >> OPERATION_BITS;
+        const auto operation = static_cast<Operation>(completion.userData & ((1u << OPERATION_BITS) - 1));
+
+        const auto it = _sockets.find(id);
+        if (it == _sockets.end())
+        {
+            continue;
+        }
+
+        auto& socket = *it->second;
+
+        switch (operation)
+        {
+        case Operation::Receive:
+            OnReceiveComplete(socket, completion);
+            break;
+        case Operation::Send:
+            OnSendComplete(socket, completion);
+            break;
+        case Operation::Cancel:
+            break;
+        }
+
+        TryReleaseSocket(socket);
+    }
+}
+
+
+} // namespace VSilKit
+
+
+#undef SILKIT_TRACE_METHOD_
@@ -0,0 +1,114 @@
+#pragma once
+
+
+#include "IRawByteStream.hpp"
+#include "IStrand.hpp"
+
+#include "IoUring.hpp"
+
+#include "ILogger.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "asio.hpp"
+
+
+namespace VSilKit {
+
+
+//! Drives the sockets of the UringRawByteStreams of one I/O context through a single io_uring instance.
+//!
+//! Once the first read has been started, each socket has a multishot receive pending, which fills the buffers of the
+//! socket's buffer ring (i.e., data is received ahead of the reads of the stream, until all buffers are in use). The
+//! reads copy the data out of these buffers. Writes are submitted as a single vectored send.
+//!
+//! The completions are signalled through an eventfd, which is waited on by the asio::io_context. The wait is only
+//! pending while a stream has a read, write, or shutdown in progress, such that running the I/O context returns once
+//! it runs out of work (like it does with asio sockets). The listener callbacks are posted to the strand of the
+//! respective stream.
+//!
+//! All methods are thread-safe.
+class UringDriver final : public std::enable_shared_from_this<UringDriver>
+{
+public:
+    using SocketId = uint64_t;
+
+private:
+    struct Socket;
+
+    std::mutex _mutex;
+
+    std::shared_ptr<asio::io_context> _asioIoContext;
+    IoUring _ring;
+    int _eventFd{-1};
+    asio::posix::stream_descriptor _eventFdDescriptor;
+    bool _waiting{false};
+
+    SocketId _nextSocketId{1};
+    std::unordered_map<SocketId, std::shared_ptr<Socket>> _sockets;
+    std::vector<uint16_t> _freeGroupIds;
+    uint16_t _nextGroupId{0};
+
+    SilKit::Services::Logging::ILogger* _logger{nullptr};
+
+public:
+    //! Throws if io_uring is not available.
+    UringDriver(std::shared_ptr<asio::io_context> asioIoContext, SilKit::Services::Logging::ILogger* logger);
+    ~UringDriver();
+
+    void SetLogger(SilKit::Services::Logging::ILogger& logger);
+
+    //! Take ownership of the connected socket. The listener callbacks of the stream are posted to the given strand. The
+    //! caller keeps the ownership if this throws.
+    auto AddSocket(int fd, IRawByteStream& stream, IStrand& strand) -> SocketId;
+
+    //! Forget the stream of the socket. The socket is closed, once all of its operations have completed.
+    void RemoveSocket(SocketId id);
+
+    void SetListener(SocketId id, IRawByteStreamListener& listener);
+    void AsyncReadSome(SocketId id, MutableBufferSequence bufferSequence);
+    void AsyncWriteSome(SocketId id, ConstBufferSequence bufferSequence);
+    void Shutdown(SocketId id);
+
+    //! Returns the smoothed round-trip time of the socket, or zero once the socket has been shut down.
+    auto GetRoundTripTime(SocketId id) -> std::chrono::microseconds;
+
+private:
+    enum class Operation : uint64_t
+    {
+        Receive = 0,
+        Send = 1,
+        Cancel = 2,
+    };
+
+    auto GetSocket(SocketId id) -> Socket&;
+    auto AllocateGroupId() -> uint16_t;
+
+    static auto MakeUserData(SocketId id, Operation operation) -> uint64_t;
+
+    void SubmitReceive(Socket& socket);
+    void SubmitSend(Socket& socket);
+    void SubmitCancel(Socket& socket, Operation operation);
+
+    void OnReceiveComplete(Socket& socket, const IoUringCompletion& completion);
+    void OnSendComplete(Socket& socket, const IoUringCompletion& completion);
+
+    void TryCompleteRead(Socket& socket);
+    void HandleShutdownOrError(Socket& socket);
+    void TryReleaseSocket(Socket& socket);
+    void PostToStream(Socket& socket, std::function<void(IRawByteStreamListener&, IRawByteStream&)> function);
+
+    void SubmitAndStartWait();
+    auto HasPendingWork() const -> bool;
+    void OnEventFdReadable(const asio::error_code& errorCode);
+    void ProcessCompletions();
+};
+
+
+} // namespace VSilKit
@@ -0,0 +1,253 @@
+#include "UringIoContext.hpp"
+
+#include "AsioGenericRawByteStream.hpp"
+#include "IoUring.hpp"
+#include "UringRawByteStream.hpp"
+
+#include "util/TracingMacros.hpp"
+
+
+#if SILKIT_ENABLE_TRACING_INSTRUMENTATION_UringIoContext
+#    define SILKIT_TRACE_METHOD_(logger, ...) SILKIT_TRACE_METHOD(logger, __VA_ARGS__)
+#else
+#    define SILKIT_TRACE_METHOD_(...)
+#endif
+
+
+namespace VSilKit {
+
+
+namespace {
+
+
+namespace Log = SilKit::Services::Logging;
+
+
+//! Passes the accepted streams to the I/O context, which replaces them by streams driven by io_uring.
+class UringAcceptor final
+    : public IAcceptor
+    , private IAcceptorListener
+{
+    UringIoContext* _ioContext{nullptr};
+    std::unique_ptr<IAcceptor> _acceptor;
+    IAcceptorListener* _listener{nullptr};
+
+public:
+    UringAcceptor(UringIoContext& ioContext, std::unique_ptr<IAcceptor> acceptor)
+        : _ioContext{&ioContext}
+        , _acceptor{std::move(acceptor)}
+    {
+        _acceptor->SetListener(*this);
+    }
+
+public: // IAcceptor
+    void SetListener(IAcceptorListener& listener) override
+    {
+        _listener = &listener;
+    }
+
+    auto GetLocalEndpoint() const -> std::string override
+    {
+        return _acceptor->GetLocalEndpoint();
+    }
+
+    void AsyncAccept(std::chrono::milliseconds timeout) override
+    {
+        _acceptor->AsyncAccept(timeout);
+    }
+
+    void Shutdown() override
+    {
+        _acceptor->Shutdown();
+    }
+
+private: // IAcceptorListener
+    void OnAsyncAcceptSuccess(IAcceptor&, std::unique_ptr<IRawByteStream> stream) override
+    {
+        _listener->OnAsyncAcceptSuccess(*this, _ioContext->AdoptStream(std::move(stream)));
+    }
+
+    void OnAsyncAcceptFailure(IAcceptor&) override
+    {
+        _listener->OnAsyncAcceptFailure(*this);
+    }
+};
+
+
+//! Passes the connected streams to the I/O context, which replaces them by streams driven by io_uring.
+class UringConnector final
+    : public IConnector
+    , private IConnectorListener
+{
+    UringIoContext* _ioContext{nullptr};
+    std::unique_ptr<IConnector> _connector;
+    IConnectorListener* _listener{nullptr};
+
+public:
+    UringConnector(UringIoContext& ioContext, std::unique_ptr<IConnector> connector)
+        : _ioContext{&ioContext}
+        , _connector{std::move(connector)}
+    {
+        _connector->SetListener(*this);
+    }
+
+public: // IConnector
+    void SetListener(IConnectorListener& listener) override
+    {
+        _listener = &listener;
+    }
+
+    void AsyncConnect(std::chrono::milliseconds timeout) override
+    {
+        _connector->AsyncConnect(timeout);
+    }
+
+    void Shutdown() override
+    {
+        _connector->Shutdown();
+    }
+
+private: // IConnectorListener
+    void OnAsyncConnectSuccess(IConnector&, std::unique_ptr<IRawByteStream> stream) override
+    {
+        _listener->OnAsyncConnectSuccess(*this, _ioContext->AdoptStream(std::move(stream)));
+    }
+
+    void OnAsyncConnectFailure(IConnector&) override
+    {
+        _listener->OnAsyncConnectFailure(*this);
+    }
+};
+
+
+} // namespace
+
+
+UringIoContext::UringIoContext(const AsioSocketOptions& socketOptions, size_t threadCount,
+                               const IoPollingOptions& pollingOptions)
+    : _ioContext{std::make_unique<AsioIoContext>(socketOptions, threadCount, pollingOptions)}
+    , _driver{std::make_shared<UringDriver>(_ioContext->GetAsioIoContext(), nullptr)}
+{
+    SILKIT_TRACE_METHOD_(_logger, "(..., {})", threadCount);
+}
+
+
+UringIoContext::~UringIoContext()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+}
+
+
+auto UringIoContext::IsSupported() -> bool
+{
+    return IoUring::IsSupported();
+}
+
+
+auto UringIoContext::AdoptStream(std::unique_ptr<IRawByteStream> stream) -> std::unique_ptr<IRawByteStream>
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    auto* asioStream = dynamic_cast<AsioGenericRawByteStream*>(stream.get());
+    if (asioStream == nullptr)
+    {
+        return stream;
+    }
+
+    std::unique_ptr<IRawByteStream> uringStream;
+    try
+    {
+        uringStream = std::make_unique<UringRawByteStream>(
+            _driver, _ioContext->GetAsioIoContext(), _ioContext->GetThreadCount(), asioStream->GetNativeHandle(),
+            asioStream->GetLocalEndpoint(), asioStream->GetRemoteEndpoint(), _logger);
+    }
+    catch (const std::exception& error)
+    {
+        Log::Warn(_logger, "UringIoContext: The connection is not driven by io_uring: {}", error.what());
+        return stream;
+    }
+
+    // the socket is owned by the new stream
+    asioStream->ReleaseNativeHandle();
+
+    return uringStream;
+}
+
+
+// IIoContext
+
+
+void UringIoContext::Run()
+{
+    _ioContext->Run();
+}
+
+
+void UringIoContext::Post(IoTask task)
+{
+    _ioContext->Post(std::move(task));
+}
+
+
+void UringIoContext::Dispatch(IoTask task)
+{
+    _ioContext->Dispatch(std::move(task));
+}
+
+
+auto UringIoContext::MakeTcpAcceptor(const std::string& address, uint16_t port) -> std::unique_ptr<IAcceptor>
+{
+    return std::make_unique<UringAcceptor>(*this, _ioContext->MakeTcpAcceptor(address, port));
+}
+
+
+auto UringIoContext::MakeLocalAcceptor(const std::string& path) -> std::unique_ptr<IAcceptor>
+{
+    return std::make_unique<UringAcceptor>(*this, _ioContext->MakeLocalAcceptor(path));
+}
+
+
+auto UringIoContext::MakeTcpConnector(const std::string& address, uint16_t port) -> std::unique_ptr<IConnector>
+{
+    return std::make_unique<UringConnector>(*this, _ioContext->MakeTcpConnector(address, port));
+}
+
+
+auto UringIoContext::MakeLocalConnector(const std::string& path) -> std::unique_ptr<IConnector>
+{
+    return std::make_unique<UringConnector>(*this, _ioContext->MakeLocalConnector(path));
+}
+
+
+auto UringIoContext::MakeTimer() -> std::unique_ptr<ITimer>
+{
+    return _ioContext->MakeTimer();
+}
+
+
+auto UringIoContext::Resolve(const std::string& name) -> std::vector<std::string>
+{
+    return _ioContext->Resolve(name);
+}
+
+
+void UringIoContext::SetLogger(SilKit::Services::Logging::ILogger& logger)
+{
+    SILKIT_TRACE_METHOD_(&logger, "({})", static_cast<const void*>(&logger));
+
+    _logger = &logger;
+    _ioContext->SetLogger(logger);
+    _driver->SetLogger(logger);
+}
+
+
+auto UringIoContext::IsRunningInThisThread() const -> bool
+{
+    return _ioContext->IsRunningInThisThread();
+}
+
+
+} // namespace VSilKit
+
+
+#undef SILKIT_TRACE_METHOD_
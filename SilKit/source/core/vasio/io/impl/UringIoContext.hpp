@@ -0,0 +1,56 @@
+#pragma once
+
+
+#include "IIoContext.hpp"
+
+#include "AsioIoContext.hpp"
+#include "AsioSocketOptions.hpp"
+#include "IoPollingOptions.hpp"
+#include "UringDriver.hpp"
+
+#include "ILogger.hpp"
+
+#include <memory>
+
+
+namespace VSilKit {
+
+
+//! I/O context which drives the established connections through io_uring (Linux only).
+//!
+//! The event loop, timers, strands, and the establishment of connections (accept and connect) are provided by an
+//! AsioIoContext. The sockets of the connections are taken over from asio, once they have been accepted or connected.
+class UringIoContext final : public IIoContext
+{
+    std::unique_ptr<AsioIoContext> _ioContext;
+    std::shared_ptr<UringDriver> _driver;
+    SilKit::Services::Logging::ILogger* _logger{nullptr};
+
+public:
+    //! Throws if io_uring is not available.
+    UringIoContext(const AsioSocketOptions& socketOptions, size_t threadCount, const IoPollingOptions& pollingOptions);
+    ~UringIoContext() override;
+
+    //! Returns true if io_uring is available, including the features required by this I/O context.
+    static auto IsSupported() -> bool;
+
+    //! Replace an accepted or connected asio stream by a stream driven by io_uring. Returns the given stream, if it
+    //! cannot be taken over.
+    auto AdoptStream(std::unique_ptr<IRawByteStream> stream) -> std::unique_ptr<IRawByteStream>;
+
+public: // IIoContext
+    void Run() override;
+    void Post(IoTask task) override;
+    void Dispatch(IoTask task) override;
+    auto MakeTcpAcceptor(const std::string& address, uint16_t port) -> std::unique_ptr<IAcceptor> override;
+    auto MakeLocalAcceptor(const std::string& path) -> std::unique_ptr<IAcceptor> override;
+    auto MakeTcpConnector(const std::string& address, uint16_t port) -> std::unique_ptr<IConnector> override;
+    auto MakeLocalConnector(const std::string& path) -> std::unique_ptr<IConnector> override;
+    auto MakeTimer() -> std::unique_ptr<ITimer> override;
+    auto Resolve(const std::string& name) -> std::vector<std::string> override;
+    void SetLogger(SilKit::Services::Logging::ILogger& logger) override;
+    auto IsRunningInThisThread() const -> bool override;
+};
+
+
+} // namespace VSilKit
@@ -0,0 +1,101 @@
+#include "UringRawByteStream.hpp"
+
+#include "util/TracingMacros.hpp"
+
+
+#if SILKIT_ENABLE_TRACING_INSTRUMENTATION_UringRawByteStream
+#    define SILKIT_TRACE_METHOD_(logger, ...) SILKIT_TRACE_METHOD(logger, __VA_ARGS__)
+#else
+#    define SILKIT_TRACE_METHOD_(...)
+#endif
+
+
+namespace VSilKit {
+
+
+UringRawByteStream::UringRawByteStream(std::shared_ptr<UringDriver> driver,
+                                       std::shared_ptr<asio::io_context> asioIoContext, size_t threadCount, int fd,
+                                       std::string localEndpoint, std::string remoteEndpoint,
+                                       SilKit::Services::Logging::ILogger* logger)
+    : _driver{std::move(driver)}
+    , _asioIoContext{std::move(asioIoContext)}
+    , _strand{*_asioIoContext, threadCount}
+    , _localEndpoint{std::move(localEndpoint)}
+    , _remoteEndpoint{std::move(remoteEndpoint)}
+    , _logger{logger}
+{
+    SILKIT_TRACE_METHOD_(_logger, "({}, ...)", fd);
+
+    _socketId = _driver->AddSocket(fd, *this, _strand);
+}
+
+
+UringRawByteStream::~UringRawByteStream()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    _driver->RemoveSocket(_socketId);
+}
+
+
+void UringRawByteStream::SetListener(IRawByteStreamListener& listener)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", static_cast<const void*>(&listener));
+
+    _driver->SetListener(_socketId, listener);
+}
+
+
+auto UringRawByteStream::GetLocalEndpoint() const -> std::string
+{
+    return _localEndpoint;
+}
+
+
+auto UringRawByteStream::GetRemoteEndpoint() const -> std::string
+{
+    return _remoteEndpoint;
+}
+
+
+auto UringRawByteStream::GetStrand() -> IStrand&
+{
+    return _strand;
+}
+
+
+void UringRawByteStream::AsyncReadSome(MutableBufferSequence bufferSequence)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    _driver->AsyncReadSome(_socketId, bufferSequence);
+}
+
+
+void UringRawByteStream::AsyncWriteSome(ConstBufferSequence bufferSequence)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    _driver->AsyncWriteSome(_socketId, bufferSequence);
+}
+
+
+void UringRawByteStream::Shutdown()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    _driver->Shutdown(_socketId);
+}
+
+
+auto UringRawByteStream::GetRoundTripTime() const -> std::chrono::microseconds
+{
+    // the driver closes the socket on shutdown, after which its descriptor may have been reused
+    return _driver->GetRoundTripTime(_socketId);
+}
+
+
+} // namespace VSilKit
+
+
+#undef SILKIT_TRACE_METHOD_
@@ -0,0 +1,52 @@
+#pragma once
+
+
+#include "IRawByteStream.hpp"
+
+#include "AsioStrand.hpp"
+#include "UringDriver.hpp"
+
+#include "ILogger.hpp"
+
+#include <memory>
+#include <string>
+
+#include "asio.hpp"
+
+
+namespace VSilKit {
+
+
+//! Byte stream on a connected socket, which is driven by io_uring. The actual I/O is implemented by the UringDriver.
+class UringRawByteStream final : public IRawByteStream
+{
+    std::shared_ptr<UringDriver> _driver;
+    std::shared_ptr<asio::io_context> _asioIoContext;
+    AsioStrand _strand;
+    UringDriver::SocketId _socketId{0};
+
+    std::string _localEndpoint;
+    std::string _remoteEndpoint;
+
+    SilKit::Services::Logging::ILogger* _logger{nullptr};
+
+public:
+    //! Takes ownership of the socket, unless this throws. The logger may be null.
+    UringRawByteStream(std::shared_ptr<UringDriver> driver, std::shared_ptr<asio::io_context> asioIoContext,
+                       size_t threadCount, int fd, std::string localEndpoint, std::string remoteEndpoint,
+                       SilKit::Services::Logging::ILogger* logger);
+    ~UringRawByteStream() override;
+
+public: // IRawByteStream
+    void SetListener(IRawByteStreamListener& listener) override;
+    auto GetLocalEndpoint() const -> std::string override;
+    auto GetRemoteEndpoint() const -> std::string override;
+    auto GetStrand() -> IStrand& override;
+    void AsyncReadSome(MutableBufferSequence bufferSequence) override;
+    void AsyncWriteSome(ConstBufferSequence bufferSequence) override;
+    void Shutdown() override;
+    auto GetRoundTripTime() const -> std::chrono::microseconds override;
+};
+
+
+} // namespace VSilKit
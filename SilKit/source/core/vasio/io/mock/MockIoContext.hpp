@@ -38,9 +38,9 @@ struct MockIoContext : IIoContext
 {
     MOCK_METHOD(void, Run, (), (override));
 
-    MOCK_METHOD(void, Post, (std::function<void()>), (override));
+    MOCK_METHOD(void, Post, (IoTask), (override));
 
-    MOCK_METHOD(void, Dispatch, (std::function<void()>), (override));
+    MOCK_METHOD(void, Dispatch, (IoTask), (override));
 
     MOCK_METHOD(std::unique_ptr<IAcceptor>, MakeTcpAcceptor, (std::string const&, uint16_t), (override));
 
@@ -55,6 +55,8 @@ struct MockIoContext : IIoContext
     MOCK_METHOD(std::vector<std::string>, Resolve, (std::string const&), (override));
 
     MOCK_METHOD(void, SetLogger, (SilKit::Services::Logging::ILogger&), (override));
+
+    MOCK_METHOD(bool, IsRunningInThisThread, (), (const, override));
 };
 
 
@@ -62,39 +64,44 @@ struct MockIoContext : IIoContext
 /// not thread-safe, do not use it in multi-threaded tests.
 struct MockIoContextWithExecutionQueue : IIoContext
 {
-    std::deque<std::function<void()>> handlerQueue;
+    std::deque<IoTask> handlerQueue;
     bool executingHandler{false};
 
     void Run() override
     {
         while (!handlerQueue.empty())
         {
-            auto function{std::move(handlerQueue.front())};
+            auto task{std::move(handlerQueue.front())};
             handlerQueue.pop_front();
 
             executingHandler = true;
-            function();
+            task();
             executingHandler = false;
         }
     }
 
-    void Post(std::function<void()> function) override
+    void Post(IoTask task) override
     {
-        handlerQueue.emplace_back(std::move(function));
+        handlerQueue.emplace_back(std::move(task));
     }
 
-    void Dispatch(std::function<void()> function) override
+    void Dispatch(IoTask task) override
     {
         if (executingHandler)
         {
-            function();
+            task();
         }
         else
         {
-            Post(std::move(function));
+            Post(std::move(task));
         }
     }
 
+    auto IsRunningInThisThread() const -> bool override
+    {
+        return executingHandler;
+    }
+
     MOCK_METHOD(std::unique_ptr<IAcceptor>, MakeTcpAcceptor, (std::string const&, uint16_t), (override));
 
     MOCK_METHOD(std::unique_ptr<IAcceptor>, MakeLocalAcceptor, (std::string const&), (override));
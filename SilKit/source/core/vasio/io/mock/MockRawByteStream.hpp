@@ -23,6 +23,7 @@
 
 
 #include "IRawByteStream.hpp"
+#include "IStrand.hpp"
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -34,11 +35,14 @@ namespace VSilKit {
 /// Implementation of IRawByteStream that provides most methods as mock-methods.
 ///
 /// The methods GetLocalEndpoint and GetRemoteEndpoint are not mock-methods, to enable their usage in matchers. See
-/// https://github.com/google/googletest/issues/3016.
+/// https://github.com/google/googletest/issues/3016. GetStrand returns the strand assigned to the strand member, and
+/// GetRoundTripTime the round-trip time assigned to the roundTripTime member.
 struct MockRawByteStream : IRawByteStream
 {
     std::string localEndpoint;
     std::string remoteEndpoint;
+    IStrand* strand{nullptr};
+    std::chrono::microseconds roundTripTime{0};
 
     auto GetLocalEndpoint() const -> std::string override
     {
@@ -50,6 +54,16 @@ struct MockRawByteStream : IRawByteStream
         return remoteEndpoint;
     }
 
+    auto GetStrand() -> IStrand& override
+    {
+        return *strand;
+    }
+
+    auto GetRoundTripTime() const -> std::chrono::microseconds override
+    {
+        return roundTripTime;
+    }
+
     MOCK_METHOD(void, SetListener, (IRawByteStreamListener&), (override));
     MOCK_METHOD(void, AsyncReadSome, (MutableBufferSequence), (override));
     MOCK_METHOD(void, AsyncWriteSome, (ConstBufferSequence), (override));
@@ -113,6 +113,7 @@ inline constexpr auto ExtractFileNameFromFileMacro(fmt::string_view s) -> fmt::s
 #define SILKIT_ENABLE_TRACING_INSTRUMENTATION_AsioConnector 0
 #define SILKIT_ENABLE_TRACING_INSTRUMENTATION_AsioIoContext 0
 #define SILKIT_ENABLE_TRACING_INSTRUMENTATION_AsioGenericRawByteStream 0
+#define SILKIT_ENABLE_TRACING_INSTRUMENTATION_SharedMemoryRawByteStream 0
 
 #define SILKIT_ENABLE_TRACING_INSTRUMENTATION_ConnectPeer 0
 
@@ -30,6 +30,8 @@ struct MockVAsioPeer : IVAsioPeer
     MOCK_METHOD(std::string, GetLocalAddress, (), (const, override));
     MOCK_METHOD(void, StartAsyncRead, (), (override));
     MOCK_METHOD(void, Shutdown, (), (override));
+    MOCK_METHOD(void, StartSendBuffering, (), (override));
+    MOCK_METHOD(void, FlushSendBuffer, (), (override));
     MOCK_METHOD(void, SetProtocolVersion, (ProtocolVersion), (override));
     MOCK_METHOD(ProtocolVersion, GetProtocolVersion, (), (const, override));
 
@@ -28,6 +28,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "IServiceDiscovery.hpp"
 
 #include "CreateParticipantImpl.hpp"
+#include "ParticipantConfiguration.hpp"
 
 #include "CachingSilKitEventHandler.hpp"
 #include "SilKitEventQueue.hpp"
@@ -55,7 +56,11 @@ DashboardParticipant::DashboardParticipant(std::shared_ptr<SilKit::Config::IPart
     auto serviceClient = std::make_shared<DashboardSystemServiceClient>(_logger, apiClient, objectMapper);
     auto eventHandler = std::make_shared<SilKitEventHandler>(_logger, serviceClient, silKitToOatppMapper);
     auto eventQueue = std::make_shared<SilKitEventQueue>();
-    _cachingEventHandler = std::make_unique<CachingSilKitEventHandler>(registryUri, _logger, eventHandler, eventQueue);
+    auto participantConfiguration = std::dynamic_pointer_cast<Config::ParticipantConfiguration>(participantConfig);
+    const auto threadSettings =
+        participantConfiguration ? participantConfiguration->middleware.threads.dashboard : Config::ThreadSettings{};
+    _cachingEventHandler = std::make_unique<CachingSilKitEventHandler>(registryUri, _logger, eventHandler, eventQueue,
+                                                                       threadSettings);
 
     _systemMonitor->SetParticipantConnectedHandler([this](auto&& participantInformation) {
         OnParticipantConnected(participantInformation);
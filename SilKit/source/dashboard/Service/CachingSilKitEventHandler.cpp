@@ -22,9 +22,11 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "CachingSilKitEventHandler.hpp"
 
 #include <chrono>
+#include <system_error>
 
 #include "ILogger.hpp"
 #include "SetThreadName.hpp"
+#include "SetThreadScheduling.hpp"
 
 namespace SilKit {
 namespace Dashboard {
@@ -37,14 +39,24 @@ uint64_t GetCurrentTime()
 
 CachingSilKitEventHandler::CachingSilKitEventHandler(const std::string& connectUri, Services::Logging::ILogger* logger,
                                                      std::shared_ptr<ISilKitEventHandler> eventHandler,
-                                                     std::shared_ptr<ISilKitEventQueue> eventQueue)
+                                                     std::shared_ptr<ISilKitEventQueue> eventQueue,
+                                                     const Config::ThreadSettings& threadSettings)
     : _connectUri(connectUri)
     , _logger(logger)
     , _eventHandler(eventHandler)
     , _eventQueue(eventQueue)
 {
-    _done = std::async(std::launch::async, [this]() {
+    _done = std::async(std::launch::async, [this, threadSettings]() {
         SilKit::Util::SetThreadName("SK-Dash-Cons");
+        try
+        {
+            SilKit::Util::SetThreadScheduling(threadSettings.cpuAffinity, threadSettings.schedulingPolicy,
+                                              threadSettings.schedulingPriority);
+        }
+        catch (const std::system_error& error)
+        {
+            Services::Logging::Warn(_logger, "Dashboard: Cannot apply the thread settings: {}", error.what());
+        }
         uint64_t simulationId = 0;
         std::vector<SilKitEvent> events;
         while (_eventQueue->DequeueAllInto(events))
@@ -29,6 +29,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "silkit/services/logging/ILogger.hpp"
 
+#include "Configuration.hpp"
+
 #include "ISilKitEventQueue.hpp"
 #include "ISilKitEventHandler.hpp"
 
@@ -42,7 +44,8 @@ class CachingSilKitEventHandler : public ICachingSilKitEventHandler
 public:
     CachingSilKitEventHandler(const std::string& connectUri, Services::Logging::ILogger* logger,
                               std::shared_ptr<ISilKitEventHandler> eventHandler,
-                              std::shared_ptr<ISilKitEventQueue> eventQueue);
+                              std::shared_ptr<ISilKitEventQueue> eventQueue,
+                              const Config::ThreadSettings& threadSettings = {});
     ~CachingSilKitEventHandler();
 
 public: //methods
@@ -42,6 +42,46 @@ auto CreateSystemControllerImpl(IParticipant* participant)
     return participantInternal->GetSystemController();
 }
 
+void BeginRegistrationBatchImpl(IParticipant* participant)
+{
+    auto participantInternal = dynamic_cast<SilKit::Core::IParticipantInternal*>(participant);
+    if (participantInternal == nullptr)
+    {
+        throw SilKitError("participant is not a valid SilKit::IParticipant*");
+    }
+    participantInternal->BeginRegistrationBatch();
+}
+
+void EndRegistrationBatchImpl(IParticipant* participant)
+{
+    auto participantInternal = dynamic_cast<SilKit::Core::IParticipantInternal*>(participant);
+    if (participantInternal == nullptr)
+    {
+        throw SilKitError("participant is not a valid SilKit::IParticipant*");
+    }
+    participantInternal->EndRegistrationBatch();
+}
+
+auto GetPeerStatisticsImpl(IParticipant* participant) -> std::vector<PeerStatistics>
+{
+    auto participantInternal = dynamic_cast<SilKit::Core::IParticipantInternal*>(participant);
+    if (participantInternal == nullptr)
+    {
+        throw SilKitError("participant is not a valid SilKit::IParticipant*");
+    }
+    return participantInternal->GetPeerStatistics();
+}
+
+auto GetSimulationStepStatisticsImpl(IParticipant* participant) -> SimulationStepStatistics
+{
+    auto participantInternal = dynamic_cast<SilKit::Core::IParticipantInternal*>(participant);
+    if (participantInternal == nullptr)
+    {
+        throw SilKitError("participant is not a valid SilKit::IParticipant*");
+    }
+    return participantInternal->GetSimulationStepStatistics();
+}
+
 } // namespace Participant
 } // namespace Experimental
 } // namespace SilKit
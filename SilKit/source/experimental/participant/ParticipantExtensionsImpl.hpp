@@ -27,12 +27,24 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 // ================================================================================
 
 
+#include <vector>
+
+
 // Forward Declarations
 
 namespace SilKit {
 class IParticipant;
 } // namespace SilKit
 
+namespace SilKit {
+namespace Experimental {
+namespace Participant {
+struct PeerStatistics;
+struct SimulationStepStatistics;
+} // namespace Participant
+} // namespace Experimental
+} // namespace SilKit
+
 namespace SilKit {
 namespace Experimental {
 namespace Services {
@@ -53,6 +65,14 @@ namespace Participant {
 auto CreateSystemControllerImpl(IParticipant* participant)
     -> SilKit::Experimental::Services::Orchestration::ISystemController*;
 
+void BeginRegistrationBatchImpl(IParticipant* participant);
+
+void EndRegistrationBatchImpl(IParticipant* participant);
+
+auto GetPeerStatisticsImpl(IParticipant* participant) -> std::vector<PeerStatistics>;
+
+auto GetSimulationStepStatisticsImpl(IParticipant* participant) -> SimulationStepStatistics;
+
 } // namespace Participant
 } // namespace Experimental
 } // namespace SilKit
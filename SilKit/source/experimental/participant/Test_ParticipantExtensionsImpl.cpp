@@ -60,4 +60,20 @@ TEST_F(Test_ParticipantExtensionsImpl, error_on_create_system_controller_twice)
     EXPECT_THROW(SilKit::Experimental::Participant::CreateSystemControllerImpl(participant.get()), SilKit::SilKitError);
 }
 
+TEST_F(Test_ParticipantExtensionsImpl, registration_batch)
+{
+    auto participant =
+        CreateNullConnectionParticipantImpl(SilKit::Config::MakeEmptyParticipantConfigurationImpl(), "TestParticipant");
+
+    EXPECT_NO_THROW(SilKit::Experimental::Participant::BeginRegistrationBatchImpl(participant.get()));
+    EXPECT_NO_THROW(participant->CreateDataPublisher("Publisher", {"Topic", {}}, 0));
+    EXPECT_NO_THROW(SilKit::Experimental::Participant::EndRegistrationBatchImpl(participant.get()));
+}
+
+TEST_F(Test_ParticipantExtensionsImpl, error_on_registration_batch_without_participant)
+{
+    EXPECT_THROW(SilKit::Experimental::Participant::BeginRegistrationBatchImpl(nullptr), SilKit::SilKitError);
+    EXPECT_THROW(SilKit::Experimental::Participant::EndRegistrationBatchImpl(nullptr), SilKit::SilKitError);
+}
+
 } // anonymous namespace
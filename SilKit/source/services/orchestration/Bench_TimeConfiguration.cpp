@@ -0,0 +1,132 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+// Scaling benchmark of the time synchronization bookkeeping: A single participant receives the NextSimTask of all
+// other synchronized participants in each simulation step, and checks after each one whether it may advance, as done
+// by TimeSyncService. The time per received NextSimTask should stay (almost) flat from 4 to 256 participants.
+//
+// Usage: SilKitBenchTimeConfiguration [numberOfSteps]
+
+#include "TimeConfiguration.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+using namespace std::chrono_literals;
+using namespace SilKit::Services::Orchestration;
+
+struct Result
+{
+    double nanosecondsPerStep{0.0};
+    double nanosecondsPerNextSimTask{0.0};
+    size_t numberOfDueSteps{0};
+};
+
+auto Measure(size_t numberOfParticipants, size_t numberOfSteps) -> Result
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.SetStepDuration(1ms);
+
+    std::vector<std::string> otherParticipantNames;
+    for (size_t index = 1; index != numberOfParticipants; ++index)
+    {
+        otherParticipantNames.emplace_back("Participant" + std::to_string(index));
+        configuration.AddSynchronizedParticipant(otherParticipantNames.back());
+    }
+
+    // The NextSimTasks of the other participants arrive in a different order in every step
+    std::mt19937 random{42};
+    std::vector<std::vector<size_t>> arrivalOrders(16);
+    for (auto& arrivalOrder : arrivalOrders)
+    {
+        for (size_t index = 0; index != otherParticipantNames.size(); ++index)
+        {
+            arrivalOrder.push_back(index);
+        }
+        std::shuffle(arrivalOrder.begin(), arrivalOrder.end(), random);
+    }
+
+    Result result;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t step = 0; step != numberOfSteps; ++step)
+    {
+        NextSimTask task;
+        task.timePoint = std::chrono::milliseconds{step};
+        task.duration = 1ms;
+
+        for (const auto index : arrivalOrders[step % arrivalOrders.size()])
+        {
+            configuration.OnReceiveNextSimStep(otherParticipantNames[index], task);
+            if (!configuration.OtherParticipantHasLowerTimepoint())
+            {
+                ++result.numberOfDueSteps;
+            }
+        }
+
+        configuration.AdvanceTimeStep();
+    }
+    const auto duration = std::chrono::steady_clock::now() - start;
+
+    const auto nanoseconds = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    result.nanosecondsPerStep = nanoseconds / static_cast<double>(numberOfSteps);
+    result.nanosecondsPerNextSimTask = result.nanosecondsPerStep / static_cast<double>(numberOfParticipants - 1);
+    return result;
+}
+
+} // namespace
+
+
+int main(int argc, char** argv)
+{
+    const size_t numberOfSteps = argc > 1 ? std::stoul(argv[1]) : 20000;
+
+    std::cout << std::setw(14) << "participants" << std::setw(18) << "ns/step" << std::setw(22) << "ns/NextSimTask"
+              << std::setw(30) << "ns/step (all participants)" << std::endl;
+
+    for (size_t numberOfParticipants = 4; numberOfParticipants <= 256; numberOfParticipants *= 2)
+    {
+        const auto result = Measure(numberOfParticipants, numberOfSteps);
+
+        // Every participant does the same bookkeeping in each step
+        std::cout << std::setw(14) << numberOfParticipants << std::setw(18) << result.nanosecondsPerStep
+                  << std::setw(22) << result.nanosecondsPerNextSimTask << std::setw(30)
+                  << result.nanosecondsPerStep * static_cast<double>(numberOfParticipants) << std::endl;
+
+        // The last NextSimTask of every step must allow advancing
+        if (result.numberOfDueSteps < numberOfSteps)
+        {
+            std::cerr << "error: the participant did not advance in every step" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
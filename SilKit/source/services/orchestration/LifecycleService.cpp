@@ -307,6 +307,10 @@ void LifecycleService::TriggerStopHandler()
 
 void LifecycleService::TriggerShutdownHandler()
 {
+    if (_timeSyncService)
+    {
+        _timeSyncService->WriteStepTimeline();
+    }
     if (_shutdownHandler)
     {
         _shutdownHandler();
@@ -0,0 +1,212 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "StepProfiler.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+
+#include "Hash.hpp"
+
+namespace {
+
+using SilKit::Services::Orchestration::StepRecord;
+
+// Nearest-rank percentile of the ascending durations
+auto Percentile(const std::vector<std::chrono::nanoseconds>& sortedDurations, size_t percent) -> std::chrono::nanoseconds
+{
+    if (sortedDurations.empty())
+    {
+        return std::chrono::nanoseconds{0};
+    }
+    const auto rank = (sortedDurations.size() * percent + 99) / 100;
+    return sortedDurations[std::max<size_t>(rank, 1) - 1];
+}
+
+void WriteJsonString(std::ostream& out, const std::string& s)
+{
+    out << '"';
+    for (const auto c : s)
+    {
+        switch (c)
+        {
+        case '"': out << "\\\""; break;
+        case '\\': out << "\\\\"; break;
+        case '\n': out << "\\n"; break;
+        case '\r': out << "\\r"; break;
+        case '\t': out << "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+            {
+                out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+            }
+            else
+            {
+                out << c;
+            }
+        }
+    }
+    out << '"';
+}
+
+// The trace event format expects microseconds, fractions keep the resolution of nanoseconds
+void WriteMicroseconds(std::ostream& out, std::chrono::nanoseconds duration)
+{
+    const auto ns = std::max<int64_t>(duration.count(), 0);
+    out << ns / 1000 << '.' << std::setw(3) << std::setfill('0') << ns % 1000;
+}
+
+void WriteEvent(std::ostream& out, uint32_t pid, const std::string& name, std::chrono::nanoseconds start,
+                std::chrono::nanoseconds duration)
+{
+    out << "{\"name\":";
+    WriteJsonString(out, name);
+    out << ",\"cat\":\"SimulationStep\",\"ph\":\"X\",\"pid\":" << pid << ",\"tid\":0,\"ts\":";
+    WriteMicroseconds(out, start);
+    out << ",\"dur\":";
+    WriteMicroseconds(out, duration);
+}
+
+} // namespace
+
+namespace SilKit {
+namespace Services {
+namespace Orchestration {
+
+StepProfiler::StepProfiler(size_t capacity)
+    : _capacity{capacity}
+{
+}
+
+bool StepProfiler::IsEnabled() const
+{
+    return _capacity > 0;
+}
+
+void StepProfiler::RecordStep(StepRecord record)
+{
+    if (!IsEnabled())
+    {
+        return;
+    }
+
+    std::lock_guard<decltype(_mx)> lock{_mx};
+    ++_executedSteps;
+    if (_records.size() < _capacity)
+    {
+        _records.push_back(std::move(record));
+        return;
+    }
+    _records[_nextRecord] = std::move(record);
+    _nextRecord = (_nextRecord + 1) % _capacity;
+}
+
+auto StepProfiler::GetRecords() const -> std::vector<StepRecord>
+{
+    std::lock_guard<decltype(_mx)> lock{_mx};
+    std::vector<StepRecord> records;
+    records.reserve(_records.size());
+    records.insert(records.end(), _records.begin() + _nextRecord, _records.end());
+    records.insert(records.end(), _records.begin(), _records.begin() + _nextRecord);
+    return records;
+}
+
+auto StepProfiler::GetStatistics() const -> Experimental::Participant::SimulationStepStatistics
+{
+    Experimental::Participant::SimulationStepStatistics statistics;
+
+    std::vector<std::chrono::nanoseconds> waitTimes;
+    std::vector<std::chrono::nanoseconds> execTimes;
+    std::map<std::string, Experimental::Participant::SimulationStepBlockingParticipant> blockingParticipants;
+    {
+        std::lock_guard<decltype(_mx)> lock{_mx};
+        statistics.executedSteps = _executedSteps;
+        statistics.recordedSteps = _records.size();
+
+        waitTimes.reserve(_records.size());
+        execTimes.reserve(_records.size());
+        for (const auto& record : _records)
+        {
+            waitTimes.push_back(record.waitTime);
+            execTimes.push_back(record.execTime);
+            if (!record.blockingParticipant.empty())
+            {
+                auto& blockingParticipant = blockingParticipants[record.blockingParticipant];
+                blockingParticipant.blockedSteps++;
+                blockingParticipant.waitTime += record.waitTime;
+            }
+        }
+    }
+
+    std::sort(waitTimes.begin(), waitTimes.end());
+    std::sort(execTimes.begin(), execTimes.end());
+
+    statistics.waitTimeMedian = Percentile(waitTimes, 50);
+    statistics.waitTimeP90 = Percentile(waitTimes, 90);
+    statistics.waitTimeP99 = Percentile(waitTimes, 99);
+    statistics.waitTimeMax = Percentile(waitTimes, 100);
+    statistics.execTimeMedian = Percentile(execTimes, 50);
+    statistics.execTimeP90 = Percentile(execTimes, 90);
+    statistics.execTimeP99 = Percentile(execTimes, 99);
+    statistics.execTimeMax = Percentile(execTimes, 100);
+
+    for (auto& kv : blockingParticipants)
+    {
+        kv.second.participantName = kv.first;
+        statistics.blockingParticipants.push_back(std::move(kv.second));
+    }
+    std::stable_sort(statistics.blockingParticipants.begin(), statistics.blockingParticipants.end(),
+                     [](const auto& lhs, const auto& rhs) { return lhs.waitTime > rhs.waitTime; });
+
+    return statistics;
+}
+
+void StepProfiler::WriteTimeline(std::ostream& out, const std::string& participantName) const
+{
+    // Timelines of several participants can be merged, as long as their process ids differ
+    const auto pid = static_cast<uint32_t>(Util::Hash::Hash(participantName) & 0x7fffffff);
+
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":0,\"args\":{\"name\":";
+    WriteJsonString(out, participantName);
+    out << "}}";
+
+    for (const auto& record : GetRecords())
+    {
+        const auto start = std::chrono::duration_cast<std::chrono::nanoseconds>(record.startTime.time_since_epoch());
+
+        out << ",\n";
+        WriteEvent(out, pid, record.blockingParticipant.empty() ? "Wait" : "Wait for " + record.blockingParticipant,
+                   start - record.waitTime, record.waitTime);
+        out << "}";
+
+        out << ",\n";
+        WriteEvent(out, pid, "Step", start, record.execTime);
+        out << ",\"args\":{\"timePoint\":" << record.timePoint.count() << ",\"duration\":" << record.duration.count()
+            << "}}";
+    }
+    out << "\n]}\n";
+}
+
+} // namespace Orchestration
+} // namespace Services
+} // namespace SilKit
@@ -0,0 +1,86 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "silkit/experimental/participant/ParticipantDatatypesExtensions.hpp"
+
+namespace SilKit {
+namespace Services {
+namespace Orchestration {
+
+//! Waiting and execution time of a single simulation step
+struct StepRecord
+{
+    std::chrono::nanoseconds timePoint{0};
+    std::chrono::nanoseconds duration{0};
+    //! Wall clock time when the simulation step handler was called
+    std::chrono::system_clock::time_point startTime;
+    //! Since the end of the previous step
+    std::chrono::nanoseconds waitTime{0};
+    std::chrono::nanoseconds execTime{0};
+    //! Participant that prevented the time advance last, empty if the step did not wait for another participant
+    std::string blockingParticipant;
+};
+
+//! Keeps the most recent simulation steps of a participant in a ring buffer of fixed capacity
+class StepProfiler
+{
+public:
+    // ----------------------------------------
+    // Constructors, Destructor, and Assignment
+    //! A capacity of zero disables the profiler
+    explicit StepProfiler(size_t capacity = 0);
+
+public:
+    // ----------------------------------------
+    // Public Methods
+    bool IsEnabled() const;
+    void RecordStep(StepRecord record);
+
+    //! The recorded steps, the oldest one first
+    auto GetRecords() const -> std::vector<StepRecord>;
+    auto GetStatistics() const -> Experimental::Participant::SimulationStepStatistics;
+
+    //! Writes the recorded steps as Chrome trace events in the JSON object format, which is also read by Perfetto
+    void WriteTimeline(std::ostream& out, const std::string& participantName) const;
+
+private:
+    // ----------------------------------------
+    // private members
+    mutable std::mutex _mx;
+    size_t _capacity{0};
+    std::vector<StepRecord> _records;
+    //! Position of the oldest record, once the ring buffer is full
+    size_t _nextRecord{0};
+    uint64_t _executedSteps{0};
+};
+
+} // namespace Orchestration
+} // namespace Services
+} // namespace SilKit
@@ -26,16 +26,53 @@ namespace SilKit {
 namespace Services {
 namespace Orchestration {
 
+inline SilKit::Core::MessageBuffer& operator<<(SilKit::Core::MessageBuffer& buffer, const SilKit::Services::Orchestration::TimeGrantDependency& dependency)
+{
+    buffer << dependency.participantName
+           << dependency.timePoint;
+    return buffer;
+}
+inline SilKit::Core::MessageBuffer& operator>>(SilKit::Core::MessageBuffer& buffer, SilKit::Services::Orchestration::TimeGrantDependency& dependency)
+{
+    buffer >> dependency.participantName
+           >> dependency.timePoint;
+    return buffer;
+}
+
 inline SilKit::Core::MessageBuffer& operator<<(SilKit::Core::MessageBuffer& buffer, const SilKit::Services::Orchestration::NextSimTask& task)
 {
     buffer << task.timePoint
-           << task.duration;
+           << task.duration
+           << task.lookahead
+           << task.eventDriven
+           << task.currentTimePoint
+           << task.sentMessages
+           << task.timeGrant
+           << task.timeGrantDependencies;
     return buffer;
 }
 inline SilKit::Core::MessageBuffer& operator>>(SilKit::Core::MessageBuffer& buffer, SilKit::Services::Orchestration::NextSimTask& task)
 {
     buffer >> task.timePoint
            >> task.duration;
+    // Participants of older versions do not send a lookahead
+    if (buffer.RemainingBytesLeft() >= sizeof(task.lookahead))
+    {
+        buffer >> task.lookahead;
+    }
+    // Participants of older versions are not event-driven
+    if (buffer.RemainingBytesLeft() >= sizeof(task.eventDriven) + sizeof(task.currentTimePoint) + sizeof(task.sentMessages))
+    {
+        buffer >> task.eventDriven
+               >> task.currentTimePoint
+               >> task.sentMessages;
+    }
+    // Participants of older versions do not take part in a coordinated time synchronization
+    if (buffer.RemainingBytesLeft() >= sizeof(task.timeGrant))
+    {
+        buffer >> task.timeGrant
+               >> task.timeGrantDependencies;
+    }
     return buffer;
 }
 
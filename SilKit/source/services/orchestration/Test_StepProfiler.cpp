@@ -0,0 +1,128 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <chrono>
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "StepProfiler.hpp"
+
+namespace {
+
+using namespace std::chrono_literals;
+
+using namespace SilKit::Services::Orchestration;
+
+auto MakeStepRecord(std::chrono::nanoseconds timePoint, std::chrono::nanoseconds waitTime,
+                    std::chrono::nanoseconds execTime, std::string blockingParticipant = {}) -> StepRecord
+{
+    StepRecord record;
+    record.timePoint = timePoint;
+    record.duration = 1ms;
+    record.startTime = std::chrono::system_clock::time_point{std::chrono::seconds{1}};
+    record.waitTime = waitTime;
+    record.execTime = execTime;
+    record.blockingParticipant = std::move(blockingParticipant);
+    return record;
+}
+
+TEST(Test_StepProfiler, disabled_profiler_records_nothing)
+{
+    StepProfiler profiler;
+    ASSERT_FALSE(profiler.IsEnabled());
+
+    profiler.RecordStep(MakeStepRecord(0ms, 1ms, 1ms));
+
+    const auto statistics = profiler.GetStatistics();
+    ASSERT_EQ(statistics.executedSteps, 0u);
+    ASSERT_EQ(statistics.recordedSteps, 0u);
+    ASSERT_EQ(statistics.waitTimeMax, 0ns);
+    ASSERT_TRUE(profiler.GetRecords().empty());
+}
+
+TEST(Test_StepProfiler, keeps_the_most_recent_steps)
+{
+    StepProfiler profiler{3};
+    for (auto i = 0; i < 5; ++i)
+    {
+        profiler.RecordStep(MakeStepRecord(i * 1ms, 0ms, 0ms));
+    }
+
+    const auto records = profiler.GetRecords();
+    ASSERT_EQ(records.size(), 3u);
+    ASSERT_EQ(records[0].timePoint, 2ms);
+    ASSERT_EQ(records[1].timePoint, 3ms);
+    ASSERT_EQ(records[2].timePoint, 4ms);
+
+    const auto statistics = profiler.GetStatistics();
+    ASSERT_EQ(statistics.executedSteps, 5u);
+    ASSERT_EQ(statistics.recordedSteps, 3u);
+}
+
+TEST(Test_StepProfiler, statistics_summarize_the_recorded_steps)
+{
+    StepProfiler profiler{100};
+    for (auto i = 1; i <= 100; ++i)
+    {
+        // P2 blocks the steps with the longest waiting times, P1 every other step before
+        profiler.RecordStep(MakeStepRecord(i * 1ms, i * 1ms, (101 - i) * 1us, i > 90 ? "P2" : i % 2 ? "P1" : ""));
+    }
+
+    const auto statistics = profiler.GetStatistics();
+    ASSERT_EQ(statistics.waitTimeMedian, 50ms);
+    ASSERT_EQ(statistics.waitTimeP90, 90ms);
+    ASSERT_EQ(statistics.waitTimeP99, 99ms);
+    ASSERT_EQ(statistics.waitTimeMax, 100ms);
+    ASSERT_EQ(statistics.execTimeMedian, 50us);
+    ASSERT_EQ(statistics.execTimeP90, 90us);
+    ASSERT_EQ(statistics.execTimeP99, 99us);
+    ASSERT_EQ(statistics.execTimeMax, 100us);
+
+    // Sorted by the total waiting time, rather than by the number of steps
+    ASSERT_EQ(statistics.blockingParticipants.size(), 2u);
+    ASSERT_EQ(statistics.blockingParticipants[0].participantName, "P1");
+    ASSERT_EQ(statistics.blockingParticipants[0].blockedSteps, 45u);
+    ASSERT_EQ(statistics.blockingParticipants[0].waitTime, 2025ms);
+    ASSERT_EQ(statistics.blockingParticipants[1].participantName, "P2");
+    ASSERT_EQ(statistics.blockingParticipants[1].blockedSteps, 10u);
+    ASSERT_EQ(statistics.blockingParticipants[1].waitTime, 955ms);
+}
+
+TEST(Test_StepProfiler, timeline_contains_wait_and_step_events)
+{
+    StepProfiler profiler{10};
+    profiler.RecordStep(MakeStepRecord(2ms, 1500us, 250ns, "Other \"P\""));
+
+    std::ostringstream out;
+    profiler.WriteTimeline(out, "Me");
+    const auto timeline = out.str();
+
+    ASSERT_NE(timeline.find(R"("ph":"M")"), std::string::npos);
+    ASSERT_NE(timeline.find(R"("args":{"name":"Me"})"), std::string::npos);
+    ASSERT_NE(timeline.find(R"({"name":"Wait for Other \"P\"","cat":"SimulationStep","ph":"X")"), std::string::npos);
+    ASSERT_NE(timeline.find(R"("ts":998500.000,"dur":1500.000})"), std::string::npos);
+    ASSERT_NE(timeline.find(R"("ts":1000000.000,"dur":0.250,"args":{"timePoint":2000000,"duration":1000000}})"),
+              std::string::npos);
+}
+
+} // namespace
@@ -70,5 +70,79 @@ TEST(Test_SyncSerdes, MwSync_ParticipantStatus)
     EXPECT_EQ(in.refreshTime, out.refreshTime);
 }
 
+TEST(Test_SyncSerdes, MwSync_NextSimTask)
+{
+    using namespace SilKit::Services::Orchestration;
+    SilKit::Core::MessageBuffer buffer;
+
+    NextSimTask in{2ms, 1ms, 10ms};
+    NextSimTask out{};
+
+    Serialize(buffer, in);
+    Deserialize(buffer, out);
+
+    EXPECT_EQ(in.timePoint, out.timePoint);
+    EXPECT_EQ(in.duration, out.duration);
+    EXPECT_EQ(in.lookahead, out.lookahead);
+}
+
+TEST(Test_SyncSerdes, MwSync_NextSimTask_event_driven)
+{
+    using namespace SilKit::Services::Orchestration;
+    SilKit::Core::MessageBuffer buffer;
+
+    NextSimTask in{10ms, 10ms, 0ms};
+    in.eventDriven = true;
+    in.currentTimePoint = 3ms;
+    in.sentMessages = false;
+    NextSimTask out{};
+
+    Serialize(buffer, in);
+    Deserialize(buffer, out);
+
+    EXPECT_EQ(in.timePoint, out.timePoint);
+    EXPECT_EQ(in.eventDriven, out.eventDriven);
+    EXPECT_EQ(in.currentTimePoint, out.currentTimePoint);
+    EXPECT_EQ(in.sentMessages, out.sentMessages);
+}
+
+TEST(Test_SyncSerdes, MwSync_NextSimTask_time_grant)
+{
+    using namespace SilKit::Services::Orchestration;
+    SilKit::Core::MessageBuffer buffer;
+
+    NextSimTask in{10ms, 0ms, 0ms};
+    in.timeGrant = true;
+    in.timeGrantDependencies = {{"P1", 5ms}, {"P2", 10ms}};
+    NextSimTask out{};
+
+    Serialize(buffer, in);
+    Deserialize(buffer, out);
+
+    EXPECT_EQ(in.timePoint, out.timePoint);
+    EXPECT_TRUE(out.timeGrant);
+    ASSERT_EQ(out.timeGrantDependencies.size(), 2u);
+    EXPECT_EQ(out.timeGrantDependencies[1].participantName, "P2");
+    EXPECT_EQ(out.timeGrantDependencies[1].timePoint, 10ms);
+}
+
+TEST(Test_SyncSerdes, MwSync_NextSimTask_without_lookahead)
+{
+    using namespace SilKit::Services::Orchestration;
+    SilKit::Core::MessageBuffer buffer;
+
+    // Participants of older versions only send the time point and the duration
+    buffer << std::chrono::nanoseconds{2ms} << std::chrono::nanoseconds{1ms};
+
+    NextSimTask out{};
+    Deserialize(buffer, out);
+
+    EXPECT_EQ(out.timePoint, 2ms);
+    EXPECT_EQ(out.duration, 1ms);
+    EXPECT_EQ(out.lookahead, 0ns);
+    EXPECT_FALSE(out.eventDriven);
+    EXPECT_FALSE(out.timeGrant);
+}
+
 } // anonymous namespace
 
@@ -0,0 +1,424 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <random>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "TimeConfiguration.hpp"
+
+namespace {
+
+using namespace std::chrono_literals;
+
+using namespace SilKit::Services::Orchestration;
+
+auto MakeNextSimTask(std::chrono::nanoseconds timePoint, std::chrono::nanoseconds duration = 1ms) -> NextSimTask
+{
+    NextSimTask task;
+    task.timePoint = timePoint;
+    task.duration = duration;
+    return task;
+}
+
+auto MakeEventDrivenNextSimTask(std::chrono::nanoseconds timePoint, std::chrono::nanoseconds currentTimePoint)
+    -> NextSimTask
+{
+    NextSimTask task = MakeNextSimTask(timePoint);
+    task.eventDriven = true;
+    task.currentTimePoint = currentTimePoint;
+    task.sentMessages = false;
+    return task;
+}
+
+auto MakeTimeGrant(std::chrono::nanoseconds timePoint, std::vector<TimeGrantDependency> dependencies = {})
+    -> NextSimTask
+{
+    NextSimTask task = MakeNextSimTask(timePoint, 0ns);
+    task.sentMessages = false;
+    task.timeGrant = true;
+    task.timeGrantDependencies = std::move(dependencies);
+    return task;
+}
+
+TEST(Test_TimeConfiguration, waits_for_participants_until_they_announced_their_next_step)
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.AddSynchronizedParticipant("P1");
+    configuration.AddSynchronizedParticipant("P2");
+
+    // Newly added participants have not announced any step yet
+    configuration.AdvanceTimeStep();
+    ASSERT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("P1", MakeNextSimTask(1ms));
+    ASSERT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("P2", MakeNextSimTask(2ms));
+    ASSERT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+}
+
+TEST(Test_TimeConfiguration, lowest_time_point_follows_updates)
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.AddSynchronizedParticipant("P1");
+    configuration.AddSynchronizedParticipant("P2");
+    configuration.OnReceiveNextSimStep("P1", MakeNextSimTask(0ms));
+    configuration.OnReceiveNextSimStep("P2", MakeNextSimTask(0ms));
+
+    configuration.AdvanceTimeStep(); // next step at 1ms
+    ASSERT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("P2", MakeNextSimTask(1ms));
+    ASSERT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("P1", MakeNextSimTask(5ms));
+    ASSERT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.AdvanceTimeStep(); // next step at 2ms
+    ASSERT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("P2", MakeNextSimTask(2ms));
+    ASSERT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+}
+
+TEST(Test_TimeConfiguration, blocking_participant_is_the_last_one_waited_for)
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.AddSynchronizedParticipant("P1");
+    configuration.AddSynchronizedParticipant("P2");
+    configuration.OnReceiveNextSimStep("P1", MakeNextSimTask(0ms));
+    configuration.OnReceiveNextSimStep("P2", MakeNextSimTask(0ms));
+    ASSERT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+    ASSERT_EQ(configuration.TakeBlockingParticipant(), "");
+
+    configuration.AdvanceTimeStep(); // next step at 1ms
+    configuration.OnReceiveNextSimStep("P1", MakeNextSimTask(1ms));
+    ASSERT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+    configuration.OnReceiveNextSimStep("P2", MakeNextSimTask(1ms));
+    ASSERT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+
+    // The blocking participant is only reported once
+    ASSERT_EQ(configuration.TakeBlockingParticipant(), "P2");
+    ASSERT_EQ(configuration.TakeBlockingParticipant(), "");
+}
+
+TEST(Test_TimeConfiguration, removed_participants_are_not_waited_for)
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.AddSynchronizedParticipant("P1");
+    configuration.AddSynchronizedParticipant("P2");
+    configuration.OnReceiveNextSimStep("P2", MakeNextSimTask(3ms));
+
+    configuration.AdvanceTimeStep();
+    ASSERT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    ASSERT_TRUE(configuration.RemoveSynchronizedParticipant("P1"));
+    ASSERT_FALSE(configuration.RemoveSynchronizedParticipant("P1"));
+    ASSERT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+
+    ASSERT_TRUE(configuration.RemoveSynchronizedParticipant("P2"));
+    ASSERT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+}
+
+TEST(Test_TimeConfiguration, participants_may_be_overtaken_by_their_lookahead)
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.AddSynchronizedParticipant("P1");
+    configuration.AddSynchronizedParticipant("P2");
+
+    NextSimTask p1Task = MakeNextSimTask(0ms);
+    p1Task.lookahead = 3ms;
+    configuration.OnReceiveNextSimStep("P1", p1Task);
+    configuration.OnReceiveNextSimStep("P2", MakeNextSimTask(10ms));
+
+    for (int step = 0; step != 3; ++step)
+    {
+        configuration.AdvanceTimeStep(); // next steps at 1ms, 2ms, 3ms
+        ASSERT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+    }
+
+    configuration.AdvanceTimeStep(); // next step at 4ms
+    ASSERT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    p1Task.timePoint = 1ms;
+    configuration.OnReceiveNextSimStep("P1", p1Task);
+    ASSERT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+}
+
+TEST(Test_TimeConfiguration, own_lookahead_is_announced_with_the_next_step)
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.SetLookahead(10ms);
+    configuration.AdvanceTimeStep();
+    ASSERT_EQ(configuration.NextSimStep().lookahead, 10ms);
+}
+
+TEST(Test_TimeConfiguration, lowest_time_point_matches_all_participants)
+{
+    TimeConfiguration configuration{nullptr};
+    std::map<std::string, std::chrono::nanoseconds> timePoints;
+    for (int index = 0; index != 32; ++index)
+    {
+        const auto name = "P" + std::to_string(index);
+        configuration.AddSynchronizedParticipant(name);
+        timePoints[name] = -1ns;
+    }
+
+    std::mt19937 random{1};
+    configuration.AdvanceTimeStep(); // next step at 1ms
+    for (int round = 0; round != 1000; ++round)
+    {
+        const auto name = "P" + std::to_string(random() % 32);
+        if (round % 100 == 99)
+        {
+            // Participants leave and join again
+            configuration.RemoveSynchronizedParticipant(name);
+            configuration.AddSynchronizedParticipant(name);
+            timePoints[name] = -1ns;
+        }
+        else
+        {
+            timePoints[name] += std::chrono::microseconds{random() % 500};
+            configuration.OnReceiveNextSimStep(name, MakeNextSimTask(timePoints[name]));
+        }
+
+        const auto expected = std::any_of(timePoints.begin(), timePoints.end(), [](const auto& timePoint) {
+            return timePoint.second < 1ms;
+        });
+        ASSERT_EQ(configuration.OtherParticipantHasLowerTimepoint(), expected) << "round " << round;
+    }
+}
+
+TEST(Test_TimeConfiguration, messages_from_unknown_participants_are_ignored)
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.AddSynchronizedParticipant("P1");
+    configuration.OnReceiveNextSimStep("P1", MakeNextSimTask(1ms));
+    configuration.OnReceiveNextSimStep("Unknown", MakeNextSimTask(0ms));
+
+    configuration.AdvanceTimeStep();
+    ASSERT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+}
+
+TEST(Test_TimeConfiguration, event_driven_participants_are_not_waited_for_until_their_next_step)
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.AddSynchronizedParticipant("P1");
+    configuration.OnReceiveNextSimStep("P1", MakeEventDrivenNextSimTask(10ms, 0ms));
+
+    for (int step = 0; step != 10; ++step)
+    {
+        configuration.AdvanceTimeStep(); // next steps at 1ms, ..., 10ms
+        ASSERT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+        configuration.AnnounceNextSimStep(false);
+    }
+
+    configuration.AdvanceTimeStep(); // next step at 11ms
+    ASSERT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+}
+
+TEST(Test_TimeConfiguration, event_driven_participants_are_woken_up_by_sent_messages)
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.AddSynchronizedParticipant("P1");
+    configuration.AddSynchronizedParticipant("P2");
+    configuration.OnReceiveNextSimStep("P1", MakeEventDrivenNextSimTask(10ms, 0ms));
+
+    // P2 sent messages before announcing its step at 3ms, which P1 handles at 3ms
+    auto p2Task = MakeNextSimTask(3ms);
+    p2Task.sentMessages = true;
+    configuration.OnReceiveNextSimStep("P2", p2Task);
+
+    for (int step = 0; step != 3; ++step)
+    {
+        configuration.AdvanceTimeStep(); // next steps at 1ms, 2ms, 3ms
+        configuration.AnnounceNextSimStep(false);
+    }
+    ASSERT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+
+    p2Task.timePoint = 20ms;
+    p2Task.sentMessages = false;
+    configuration.OnReceiveNextSimStep("P2", p2Task);
+    configuration.AdvanceTimeStep(); // next step at 4ms
+    ASSERT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    // P1 executed its step at 3ms
+    configuration.OnReceiveNextSimStep("P1", MakeEventDrivenNextSimTask(10ms, 3ms));
+    ASSERT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+}
+
+TEST(Test_TimeConfiguration, own_sent_messages_wake_up_event_driven_participants)
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.AddSynchronizedParticipant("P1");
+    configuration.OnReceiveNextSimStep("P1", MakeEventDrivenNextSimTask(10ms, 0ms));
+
+    configuration.AdvanceTimeStep(); // next step at 1ms
+    ASSERT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+    configuration.AnnounceNextSimStep(true);
+
+    configuration.AdvanceTimeStep(); // next step at 2ms
+    ASSERT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("P1", MakeEventDrivenNextSimTask(10ms, 1ms));
+    ASSERT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+}
+
+TEST(Test_TimeConfiguration, event_driven_participant_is_woken_up_before_its_scheduled_step)
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.SetEventDriven(true);
+    configuration.SetStepDuration(10ms);
+    configuration.AddSynchronizedParticipant("P1");
+
+    configuration.AdvanceTimeStep(); // scheduled step at 10ms
+    ASSERT_EQ(configuration.AnnounceNextSimStep(false).timePoint, 10ms);
+
+    auto p1Task = MakeNextSimTask(3ms);
+    p1Task.sentMessages = true;
+    configuration.OnReceiveNextSimStep("P1", p1Task);
+    ASSERT_EQ(configuration.NextSimStep().timePoint, 3ms);
+    ASSERT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.AdvanceTimeStep();
+    ASSERT_EQ(configuration.CurrentSimStep().timePoint, 3ms);
+    ASSERT_EQ(configuration.CurrentSimStep().duration, 7ms);
+
+    const auto nextTask = configuration.AnnounceNextSimStep(false);
+    ASSERT_EQ(nextTask.timePoint, 10ms);
+    ASSERT_EQ(nextTask.currentTimePoint, 3ms);
+    ASSERT_TRUE(nextTask.eventDriven);
+}
+
+TEST(Test_TimeConfiguration, time_coordinator_grants_the_lowest_safe_time_point)
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.SetTimeCoordinator("C", "C");
+    configuration.SetLookahead(5ms);
+    configuration.AddSynchronizedParticipant("P1");
+    configuration.AddSynchronizedParticipant("P2");
+
+    NextSimTask timeGrant;
+    configuration.AnnounceNextSimStep(false);
+    ASSERT_FALSE(configuration.MakeTimeGrant(timeGrant));
+
+    auto p1Task = MakeNextSimTask(0ms);
+    p1Task.sentMessages = false;
+    configuration.OnReceiveNextSimStep("P1", p1Task);
+    configuration.OnReceiveNextSimStep("P2", p1Task);
+    ASSERT_TRUE(configuration.MakeTimeGrant(timeGrant));
+    ASSERT_TRUE(timeGrant.timeGrant);
+    ASSERT_EQ(timeGrant.timePoint, 0ms);
+    ASSERT_TRUE(timeGrant.timeGrantDependencies.empty());
+    ASSERT_FALSE(configuration.MakeTimeGrant(timeGrant));
+
+    // P2 sent messages before its NextSimTask, which is also sent to all participants
+    auto p2Task = MakeNextSimTask(1ms);
+    configuration.OnReceiveNextSimStep("P2", p2Task);
+    ASSERT_TRUE(configuration.MakeTimeGrant(timeGrant));
+    ASSERT_EQ(timeGrant.timePoint, 0ms);
+    ASSERT_EQ(timeGrant.timeGrantDependencies.size(), 1u);
+    ASSERT_EQ(timeGrant.timeGrantDependencies[0].participantName, "P2");
+    ASSERT_EQ(timeGrant.timeGrantDependencies[0].timePoint, 1ms);
+
+    p1Task.timePoint = 1ms;
+    configuration.OnReceiveNextSimStep("P1", p1Task);
+    ASSERT_TRUE(configuration.MakeTimeGrant(timeGrant));
+    ASSERT_EQ(timeGrant.timePoint, 1ms);
+    ASSERT_TRUE(timeGrant.timeGrantDependencies.empty());
+
+    // The coordinator itself is the lowest, including its lookahead
+    p1Task.timePoint = 10ms;
+    configuration.OnReceiveNextSimStep("P1", p1Task);
+    configuration.OnReceiveNextSimStep("P2", p1Task);
+    ASSERT_TRUE(configuration.MakeTimeGrant(timeGrant));
+    ASSERT_EQ(timeGrant.timePoint, 5ms);
+}
+
+TEST(Test_TimeConfiguration, time_coordinated_participant_waits_for_time_grants)
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.SetTimeCoordinator("C", "P1");
+    configuration.AddSynchronizedParticipant("C");
+    configuration.AddSynchronizedParticipant("P2");
+    ASSERT_TRUE(configuration.IsTimeCoordinated());
+    ASSERT_FALSE(configuration.IsTimeCoordinator());
+
+    // The NextSimTasks of the other participants are only sent to the coordinator
+    ASSERT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("C", MakeTimeGrant(0ms));
+    ASSERT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.AdvanceTimeStep();
+    ASSERT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    // Only the time coordinator grants time advances
+    configuration.OnReceiveNextSimStep("P2", MakeTimeGrant(1ms));
+    ASSERT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("C", MakeTimeGrant(1ms));
+    ASSERT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+}
+
+TEST(Test_TimeConfiguration, time_grant_waits_for_next_sim_tasks_sent_behind_messages)
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.SetTimeCoordinator("C", "P1");
+    configuration.AddSynchronizedParticipant("C");
+    configuration.AddSynchronizedParticipant("P2");
+
+    configuration.OnReceiveNextSimStep("C", MakeTimeGrant(0ms));
+    configuration.AdvanceTimeStep();
+
+    // The messages of P2 may not have arrived yet, its own NextSimTasks are not waited for
+    configuration.OnReceiveNextSimStep("C", MakeTimeGrant(1ms, {{"P2", 1ms}, {"P1", 1ms}}));
+    ASSERT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    // Later time grants depend on the same NextSimTask
+    configuration.OnReceiveNextSimStep("C", MakeTimeGrant(2ms));
+    ASSERT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("P2", MakeNextSimTask(1ms));
+    ASSERT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+    configuration.AdvanceTimeStep();
+    ASSERT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+
+    // NextSimTasks received before the time grant are taken into account
+    configuration.AdvanceTimeStep();
+    configuration.OnReceiveNextSimStep("P2", MakeNextSimTask(3ms));
+    configuration.OnReceiveNextSimStep("C", MakeTimeGrant(3ms, {{"P2", 3ms}}));
+    ASSERT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+
+    // Dependencies on removed participants are dropped
+    configuration.OnReceiveNextSimStep("C", MakeTimeGrant(4ms, {{"P2", 4ms}}));
+    configuration.AdvanceTimeStep();
+    ASSERT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+    configuration.RemoveSynchronizedParticipant("P2");
+    ASSERT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+}
+
+} // namespace
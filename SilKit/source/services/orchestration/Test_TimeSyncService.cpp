@@ -22,6 +22,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <chrono>
 #include <functional>
 #include <string>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -50,6 +51,15 @@ using namespace SilKit::Util;
 
 using ::SilKit::Core::Tests::DummyParticipant;
 
+//! Tracks whether the messages sent by the services are buffered
+class SendBufferingParticipant : public DummyParticipant
+{
+public:
+    void StartSendBuffering() override { isSendBuffering = true; }
+    void FlushSendBuffers() override { isSendBuffering = false; }
+
+    bool isSendBuffering{false};
+};
 
 class Test_TimeSyncService : public testing::Test
 {
@@ -95,7 +105,7 @@ protected:
     // Members
     NiceMock<MockServiceEndpoint> endpoint{"P1", "N1", "C1"};
 
-    NiceMock<DummyParticipant> participant;
+    NiceMock<SendBufferingParticipant> participant;
     Callbacks callbacks;
     Config::HealthCheck healthCheckConfig;
 
@@ -168,4 +178,186 @@ TEST_F(Test_TimeSyncService, async_simtask_mismatching_number_of_complete_calls)
         << "Calling too many CompleteSimulationStep() should not wreak havoc"; 
 }
 
+TEST_F(Test_TimeSyncService, messages_sent_in_the_step_handler_are_buffered_until_it_returns)
+{
+    std::vector<bool> isSendBufferingInHandler;
+    timeSyncService->SetSimulationStepHandler([&](auto now, auto){
+        isSendBufferingInHandler.push_back(participant.isSendBuffering);
+        if (now == 1ms)
+        {
+            throw SilKitError{"step handler failed"};
+        }
+    }, 1ms);
+
+    PrepareLifecycle();
+
+    timeSyncService->ReceiveMsg(&endpoint, {0ms, 1ms});
+    ASSERT_EQ(isSendBufferingInHandler, std::vector<bool>{true});
+    ASSERT_FALSE(participant.isSendBuffering);
+
+    // The buffered messages are also written if the handler throws
+    ASSERT_THROW(timeSyncService->ReceiveMsg(&endpoint, {1ms, 1ms}), SilKitError);
+    ASSERT_EQ(isSendBufferingInHandler, (std::vector<bool>{true, true}));
+    ASSERT_FALSE(participant.isSendBuffering);
+}
+
+TEST_F(Test_TimeSyncService, lookahead_of_other_participant_allows_running_ahead)
+{
+    std::vector<std::chrono::nanoseconds> executedTimePoints;
+    timeSyncService->SetSimulationStepHandler([&](auto now, auto){
+        executedTimePoints.push_back(now);
+    }, 1ms);
+
+    PrepareLifecycle();
+
+    // P1 executes its step at 0ms, but its messages cannot affect other participants before 5ms
+    timeSyncService->ReceiveMsg(&endpoint, {0ms, 1ms, 5ms});
+
+    const std::vector<std::chrono::nanoseconds> expectedTimePoints{0ms, 1ms, 2ms, 3ms, 4ms, 5ms};
+    ASSERT_EQ(executedTimePoints, expectedTimePoints);
+
+    timeSyncService->ReceiveMsg(&endpoint, {1ms, 1ms, 5ms});
+    ASSERT_EQ(executedTimePoints.size(), 7u);
+    ASSERT_EQ(executedTimePoints.back(), 6ms);
+}
+
+TEST_F(Test_TimeSyncService, step_profiler_records_the_blocking_participant)
+{
+    Config::TimeSynchronization timeSynchronizationConfig;
+    timeSynchronizationConfig.profiledSteps = 10;
+    timeSyncService = std::make_unique<TimeSyncService>(&participant, &timeProvider, healthCheckConfig,
+                                                        lifecycleService.get(), Config::ThreadSettings{},
+                                                        timeSynchronizationConfig);
+    lifecycleService->SetTimeSyncService(timeSyncService.get());
+    timeSyncService->SetSimulationStepHandler([](auto, auto) {}, 1ms);
+
+    PrepareLifecycle();
+
+    timeSyncService->ReceiveMsg(&endpoint, {0ms, 1ms});
+    timeSyncService->ReceiveMsg(&endpoint, {1ms, 1ms});
+
+    const auto records = timeSyncService->GetStepProfiler().GetRecords();
+    ASSERT_EQ(records.size(), 2u);
+    ASSERT_EQ(records[0].timePoint, 0ms);
+    ASSERT_EQ(records[0].waitTime, 0ns);
+    ASSERT_EQ(records[0].blockingParticipant, "P1");
+    ASSERT_EQ(records[1].timePoint, 1ms);
+    ASSERT_EQ(records[1].blockingParticipant, "P1");
+
+    const auto statistics = timeSyncService->GetStepProfiler().GetStatistics();
+    ASSERT_EQ(statistics.executedSteps, 2u);
+    ASSERT_EQ(statistics.blockingParticipants.size(), 1u);
+    ASSERT_EQ(statistics.blockingParticipants[0].participantName, "P1");
+    ASSERT_EQ(statistics.blockingParticipants[0].blockedSteps, 2u);
+}
+
+TEST_F(Test_TimeSyncService, event_driven_participant_is_woken_up_by_messages_of_others)
+{
+    Config::TimeSynchronization timeSynchronizationConfig;
+    timeSynchronizationConfig.eventDriven = true;
+    timeSyncService = std::make_unique<TimeSyncService>(&participant, &timeProvider, healthCheckConfig,
+                                                        lifecycleService.get(), Config::ThreadSettings{},
+                                                        timeSynchronizationConfig);
+    lifecycleService->SetTimeSyncService(timeSyncService.get());
+
+    using Step = std::pair<std::chrono::nanoseconds, std::chrono::nanoseconds>;
+    std::vector<Step> executedSteps;
+    timeSyncService->SetSimulationStepHandler([&](auto now, auto duration){
+        executedSteps.emplace_back(now, duration);
+    }, 10ms);
+
+    PrepareLifecycle();
+
+    NextSimTask p1Task{0ms, 1ms};
+    p1Task.sentMessages = false;
+    timeSyncService->ReceiveMsg(&endpoint, p1Task);
+    p1Task.timePoint = 1ms;
+    timeSyncService->ReceiveMsg(&endpoint, p1Task);
+    ASSERT_EQ(executedSteps, (std::vector<Step>{{0ms, 10ms}}));
+
+    // P1 sent messages before announcing its step at 3ms
+    p1Task.timePoint = 3ms;
+    p1Task.sentMessages = true;
+    timeSyncService->ReceiveMsg(&endpoint, p1Task);
+    ASSERT_EQ(executedSteps, (std::vector<Step>{{0ms, 10ms}, {3ms, 7ms}}));
+
+    p1Task.timePoint = 10ms;
+    p1Task.sentMessages = false;
+    timeSyncService->ReceiveMsg(&endpoint, p1Task);
+    ASSERT_EQ(executedSteps, (std::vector<Step>{{0ms, 10ms}, {3ms, 7ms}, {10ms, 10ms}}));
+}
+
+TEST_F(Test_TimeSyncService, time_coordinated_participant_advances_on_time_grants)
+{
+    Config::TimeSynchronization timeSynchronizationConfig;
+    timeSynchronizationConfig.coordinator = "P1";
+    timeSyncService = std::make_unique<TimeSyncService>(&participant, &timeProvider, healthCheckConfig,
+                                                        lifecycleService.get(), Config::ThreadSettings{},
+                                                        timeSynchronizationConfig);
+    lifecycleService->SetTimeSyncService(timeSyncService.get());
+
+    std::vector<std::chrono::nanoseconds> executedTimePoints;
+    timeSyncService->SetSimulationStepHandler([&](auto now, auto){
+        executedTimePoints.push_back(now);
+    }, 1ms);
+
+    PrepareLifecycle();
+
+    // The NextSimTask of the coordinator does not grant a time advance by itself
+    timeSyncService->ReceiveMsg(&endpoint, {0ms});
+    ASSERT_TRUE(executedTimePoints.empty());
+
+    NextSimTask timeGrant{2ms};
+    timeGrant.timeGrant = true;
+    timeSyncService->ReceiveMsg(&endpoint, timeGrant);
+
+    const std::vector<std::chrono::nanoseconds> expectedTimePoints{0ms, 1ms, 2ms};
+    ASSERT_EQ(executedTimePoints, expectedTimePoints);
+}
+
+TEST_F(Test_TimeSyncService, removal_of_the_time_coordinator_is_reported_as_error)
+{
+    Discovery::ServiceDiscoveryHandler discoveryHandler;
+    EXPECT_CALL(participant.mockServiceDiscovery, RegisterServiceDiscoveryHandler(_))
+        .WillOnce(SaveArg<0>(&discoveryHandler));
+
+    Config::TimeSynchronization timeSynchronizationConfig;
+    timeSynchronizationConfig.coordinator = "P1";
+    timeSyncService = std::make_unique<TimeSyncService>(&participant, &timeProvider, healthCheckConfig,
+                                                        lifecycleService.get(), Config::ThreadSettings{},
+                                                        timeSynchronizationConfig);
+    lifecycleService->SetTimeSyncService(timeSyncService.get());
+    timeSyncService->SetSimulationStepHandler([](auto, auto) {}, 1ms);
+
+    PrepareLifecycle();
+    ASSERT_EQ(lifecycleService->State(), ParticipantState::Running);
+
+    ServiceDescriptor coordinatorDescriptor;
+    coordinatorDescriptor.SetParticipantNameAndComputeId("P1");
+    coordinatorDescriptor.SetServiceType(ServiceType::InternalController);
+    coordinatorDescriptor.SetSupplementalDataItem(Discovery::controllerType,
+                                                  Discovery::controllerTypeTimeSyncService);
+    coordinatorDescriptor.SetSupplementalDataItem(Discovery::timeSyncActive, "1");
+    discoveryHandler(Discovery::ServiceDiscoveryEvent::Type::ServiceRemoved, coordinatorDescriptor);
+
+    EXPECT_EQ(lifecycleService->State(), ParticipantState::Error);
+}
+
+TEST_F(Test_TimeSyncService, warn_if_the_time_coordinator_is_not_a_synchronized_participant)
+{
+    Config::TimeSynchronization timeSynchronizationConfig;
+    timeSynchronizationConfig.coordinator = "P2";
+    timeSyncService = std::make_unique<TimeSyncService>(&participant, &timeProvider, healthCheckConfig,
+                                                        lifecycleService.get(), Config::ThreadSettings{},
+                                                        timeSynchronizationConfig);
+    lifecycleService->SetTimeSyncService(timeSyncService.get());
+    timeSyncService->SetSimulationStepHandler([](auto, auto) {}, 1ms);
+
+    EXPECT_CALL(participant.logger, Log(_, _)).Times(AnyNumber());
+    EXPECT_CALL(participant.logger, Log(Services::Logging::Level::Warn, HasSubstr("time coordinator 'P2'")))
+        .Times(1);
+
+    PrepareLifecycle();
+}
+
 } // namespace
@@ -22,10 +22,32 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "TimeConfiguration.hpp"
 #include "ILogger.hpp"
 
+#include <algorithm>
+
 namespace SilKit {
 namespace Services {
 namespace Orchestration {
 
+namespace {
+
+void InsertWakeTimePoint(std::vector<std::chrono::nanoseconds>& wakeTimePoints, std::chrono::nanoseconds wakeTimePoint)
+{
+    auto it = std::lower_bound(wakeTimePoints.begin(), wakeTimePoints.end(), wakeTimePoint);
+    if (it == wakeTimePoints.end() || *it != wakeTimePoint)
+    {
+        wakeTimePoints.insert(it, wakeTimePoint);
+    }
+}
+
+// Removes the wake-ups that were handled by the simulation step at timePoint
+void EraseWakeTimePointsUntil(std::vector<std::chrono::nanoseconds>& wakeTimePoints, std::chrono::nanoseconds timePoint)
+{
+    wakeTimePoints.erase(wakeTimePoints.begin(),
+                         std::upper_bound(wakeTimePoints.begin(), wakeTimePoints.end(), timePoint));
+}
+
+} // namespace
+
 TimeConfiguration::TimeConfiguration(Logging::ILogger* logger) 
     : _blocking(false)
     , _logger(logger)
@@ -52,17 +74,25 @@ void TimeConfiguration::AddSynchronizedParticipant(const std::string& otherParti
     NextSimTask task;
     task.timePoint = -1ns;
     task.duration = 0ns;
-    _otherNextTasks.emplace(otherParticipantName, task);
+    auto it = _otherNextTasks.emplace(otherParticipantName, OtherNextTask{task, _otherTimePointHeap.size()}).first;
+    _otherTimePointHeap.push_back(HeapEntry{task.timePoint + task.lookahead, it});
+    SiftUp(it->second.heapIndex);
 }
 
 
 bool TimeConfiguration::RemoveSynchronizedParticipant(const std::string& otherParticipantName)
 {
     Lock lock{_mx};
+    if (IsTimeCoordinatedByOther())
+    {
+        // The NextSimTasks of the participant will not arrive anymore
+        _receivedTimePoints.erase(otherParticipantName);
+        RemoveTimeGrantDependency(otherParticipantName, std::chrono::nanoseconds::max());
+    }
     auto it = _otherNextTasks.find(otherParticipantName);
     if (it != _otherNextTasks.end())
     {
-        _otherNextTasks.erase(it);
+        EraseOtherNextTask(it);
         return true;
     }
     return false;
@@ -82,6 +112,18 @@ void TimeConfiguration::OnReceiveNextSimStep(const std::string& participantName,
 {
     Lock lock{_mx};
 
+    if (nextStep.timeGrant)
+    {
+        OnReceiveTimeGrant(participantName, nextStep);
+        return;
+    }
+    if (IsTimeCoordinatedByOther())
+    {
+        auto& receivedTimePoint = _receivedTimePoints[participantName];
+        receivedTimePoint = std::max(receivedTimePoint, nextStep.timePoint);
+        RemoveTimeGrantDependency(participantName, receivedTimePoint);
+    }
+
     auto&& itOtherNextTask = _otherNextTasks.find(participantName);
     if (itOtherNextTask == _otherNextTasks.end())
     {
@@ -89,15 +131,25 @@ void TimeConfiguration::OnReceiveNextSimStep(const std::string& participantName,
         return;
     }
 
-    if (nextStep.timePoint < itOtherNextTask->second.timePoint)
+    // The time point of event-driven participants is preponed when they are woken up
+    if (!nextStep.eventDriven && nextStep.timePoint < itOtherNextTask->second.task.timePoint)
     {
         Logging::Error(_logger,
                        "Chonology error: Received NextSimTask from participant \'{}\' with lower timePoint {} than last "
                        "known timePoint {}",
-                       participantName, nextStep.timePoint.count(), itOtherNextTask->second.timePoint.count());
+                       participantName, nextStep.timePoint.count(), itOtherNextTask->second.task.timePoint.count());
     }
 
-    _otherNextTasks.at(participantName) = std::move(nextStep);
+    UpdateOtherNextTask(itOtherNextTask, nextStep);
+    if (nextStep.sentMessages)
+    {
+        AddWakeTimePoint(itOtherNextTask, nextStep.timePoint + nextStep.lookahead);
+        if (_isTimeCoordinator)
+        {
+            // The participant sent this NextSimTask to all participants, behind its messages
+            _timeGrantDependencies.push_back(TimeGrantDependency{participantName, nextStep.timePoint});
+        }
+    }
     Logging::Debug(_logger, "Updated _otherNextTasks for participant {} with time {}", participantName,
                    nextStep.timePoint.count());
 }
@@ -113,7 +165,7 @@ void TimeConfiguration::SynchronizedParticipantRemoved(const std::string& otherP
     auto it = _otherNextTasks.find(otherParticipantName);
     if (it != _otherNextTasks.end())
     {
-        _otherNextTasks.erase(it);
+        EraseOtherNextTask(it);
     }
 }
 void TimeConfiguration::SetStepDuration(std::chrono::nanoseconds duration)
@@ -122,11 +174,97 @@ void TimeConfiguration::SetStepDuration(std::chrono::nanoseconds duration)
     _myNextTask.duration = duration;
 }
 
+void TimeConfiguration::SetLookahead(std::chrono::nanoseconds lookahead)
+{
+    Lock lock{_mx};
+    _myNextTask.lookahead = lookahead;
+}
+
+void TimeConfiguration::SetEventDriven(bool eventDriven)
+{
+    Lock lock{_mx};
+    _myNextTask.eventDriven = eventDriven;
+}
+
+bool TimeConfiguration::IsEventDriven() const
+{
+    Lock lock{_mx};
+    return _myNextTask.eventDriven;
+}
+
+void TimeConfiguration::SetTimeCoordinator(const std::string& coordinatorName, const std::string& participantName)
+{
+    Lock lock{_mx};
+    _timeCoordinator = coordinatorName;
+    _participantName = participantName;
+    _isTimeCoordinator = !coordinatorName.empty() && coordinatorName == participantName;
+}
+
+auto TimeConfiguration::GetTimeCoordinator() const -> std::string
+{
+    Lock lock{_mx};
+    return _timeCoordinator;
+}
+
+bool TimeConfiguration::IsTimeCoordinated() const
+{
+    Lock lock{_mx};
+    return !_timeCoordinator.empty();
+}
+
+bool TimeConfiguration::IsTimeCoordinator() const
+{
+    Lock lock{_mx};
+    return _isTimeCoordinator;
+}
+
+bool TimeConfiguration::MakeTimeGrant(NextSimTask& timeGrant)
+{
+    Lock lock{_mx};
+    if (!_isTimeCoordinator)
+    {
+        return false;
+    }
+
+    // No participant can affect the others before the lowest safe time point, including the coordinator itself
+    auto grantedTimePoint = _myAnnouncedSafeTimePoint;
+    if (!_otherTimePointHeap.empty())
+    {
+        grantedTimePoint = std::min(grantedTimePoint, _otherTimePointHeap.front().safeTimePoint);
+    }
+    if (grantedTimePoint == _grantedTimePoint && _timeGrantDependencies.empty())
+    {
+        return false;
+    }
+    _grantedTimePoint = grantedTimePoint;
+
+    timeGrant = NextSimTask{};
+    timeGrant.timePoint = grantedTimePoint;
+    timeGrant.sentMessages = false;
+    timeGrant.timeGrant = true;
+    timeGrant.timeGrantDependencies = std::move(_timeGrantDependencies);
+    _timeGrantDependencies.clear();
+    return true;
+}
+
 void TimeConfiguration::AdvanceTimeStep()
 {
     Lock lock{_mx};
-    _currentTask = _myNextTask;
-    _myNextTask.timePoint = _currentTask.timePoint + _currentTask.duration;
+    const auto nextTimePoint = MyNextTimePoint();
+    if (nextTimePoint < _myNextTask.timePoint)
+    {
+        // Woken up by messages of other participants, the scheduled step is kept
+        _currentTask = _myNextTask;
+        _currentTask.timePoint = nextTimePoint;
+        _currentTask.duration = _myNextTask.timePoint - nextTimePoint;
+    }
+    else
+    {
+        _currentTask = _myNextTask;
+        _myNextTask.timePoint = _currentTask.timePoint + _currentTask.duration;
+    }
+    EraseWakeTimePointsUntil(_myWakeTimePoints, _currentTask.timePoint);
+    _myNextTask.currentTimePoint = _currentTask.timePoint;
 }
 
 auto TimeConfiguration::CurrentSimStep() const -> NextSimTask
@@ -138,31 +276,289 @@ auto TimeConfiguration::CurrentSimStep() const -> NextSimTask
 auto TimeConfiguration::NextSimStep() const -> NextSimTask
 {
     Lock lock{_mx};
-    return _myNextTask;
+    auto nextTask = _myNextTask;
+    nextTask.timePoint = MyNextTimePoint();
+    return nextTask;
+}
+
+auto TimeConfiguration::AnnounceNextSimStep(bool sentMessages) -> NextSimTask
+{
+    Lock lock{_mx};
+    _myNextTask.sentMessages = sentMessages;
+    auto nextTask = _myNextTask;
+    nextTask.timePoint = MyNextTimePoint();
+    if (sentMessages)
+    {
+        AddWakeTimePoint(_otherNextTasks.end(), nextTask.timePoint + nextTask.lookahead);
+    }
+    _myAnnouncedSafeTimePoint = nextTask.timePoint + nextTask.lookahead;
+    return nextTask;
+}
+
+bool TimeConfiguration::HasAnnouncedNextSimStep() const
+{
+    Lock lock{_mx};
+    return _myAnnouncedSafeTimePoint >= 0ns;
 }
 
 bool TimeConfiguration::OtherParticipantHasLowerTimepoint() const
 {
     Lock lock{_mx};
 
-    for (const auto& otherTask : _otherNextTasks)
+    if (IsTimeCoordinatedByOther())
     {
-        if (_myNextTask.timePoint > otherTask.second.timePoint)
+        if (MyNextTimePoint() > _grantedTimePoint)
         {
-            Debug(_logger, "Not advancing because participant \'{}\' has lower timepoint {}", otherTask.first,
-                  otherTask.second.timePoint.count());
+            Debug(_logger,
+                  "Not advancing because the time coordinator \'{}\' granted time point {} (pending time grant {})",
+                  _timeCoordinator, _grantedTimePoint.count(), _pendingGrantedTimePoint.count());
+            _blockingParticipant = _timeCoordinator;
             return true;
         }
+        return false;
+    }
+
+    if (_otherTimePointHeap.empty())
+    {
+        return false;
+    }
+
+    // Other participants may be overtaken by their lookahead, since they cannot affect this participant before
+    const auto& lowest = _otherTimePointHeap.front();
+    if (MyNextTimePoint() > lowest.safeTimePoint)
+    {
+        const auto& otherTask = lowest.otherNextTaskIt->second.task;
+        Debug(_logger, "Not advancing because participant \'{}\' has lower timepoint {} (lookahead {})",
+              lowest.otherNextTaskIt->first, otherTask.timePoint.count(), otherTask.lookahead.count());
+        _blockingParticipant = lowest.otherNextTaskIt->first;
+        return true;
     }
     return false;
 }
 
+auto TimeConfiguration::TakeBlockingParticipant() -> std::string
+{
+    Lock lock{_mx};
+    std::string blockingParticipant;
+    blockingParticipant.swap(_blockingParticipant);
+    return blockingParticipant;
+}
+
+void TimeConfiguration::UpdateOtherNextTask(OtherNextTasks::iterator it, NextSimTask nextTask)
+{
+    auto& other = it->second;
+    if (other.task.eventDriven != nextTask.eventDriven)
+    {
+        nextTask.eventDriven ? ++_numEventDrivenParticipants : --_numEventDrivenParticipants;
+    }
+    other.task = std::move(nextTask);
+
+    if (other.task.eventDriven)
+    {
+        EraseWakeTimePointsUntil(other.wakeTimePoints, other.task.currentTimePoint);
+    }
+    else
+    {
+        other.wakeTimePoints.clear();
+    }
+    UpdateHeapEntry(it);
+}
+
+void TimeConfiguration::UpdateHeapEntry(OtherNextTasks::iterator it)
+{
+    const auto& other = it->second;
+    auto timePoint = other.task.timePoint;
+    if (!other.wakeTimePoints.empty())
+    {
+        timePoint = std::min(timePoint, other.wakeTimePoints.front());
+    }
+
+    const auto heapIndex = other.heapIndex;
+    const auto previousSafeTimePoint = _otherTimePointHeap[heapIndex].safeTimePoint;
+    const auto safeTimePoint = timePoint + other.task.lookahead;
+    _otherTimePointHeap[heapIndex].safeTimePoint = safeTimePoint;
+    if (safeTimePoint < previousSafeTimePoint)
+    {
+        SiftUp(heapIndex);
+    }
+    else
+    {
+        SiftDown(heapIndex);
+    }
+}
+
+void TimeConfiguration::EraseOtherNextTask(OtherNextTasks::iterator it)
+{
+    if (it->second.task.eventDriven)
+    {
+        --_numEventDrivenParticipants;
+    }
+
+    const auto heapIndex = it->second.heapIndex;
+    const auto lastIndex = _otherTimePointHeap.size() - 1;
+    if (heapIndex != lastIndex)
+    {
+        SetHeapEntry(heapIndex, _otherTimePointHeap[lastIndex]);
+    }
+    _otherTimePointHeap.pop_back();
+    _otherNextTasks.erase(it);
+
+    if (heapIndex < _otherTimePointHeap.size())
+    {
+        SiftUp(heapIndex);
+        SiftDown(_otherTimePointHeap[heapIndex].otherNextTaskIt->second.heapIndex);
+    }
+}
+
+void TimeConfiguration::AddWakeTimePoint(OtherNextTasks::iterator sender, std::chrono::nanoseconds wakeTimePoint)
+{
+    if (_myNextTask.eventDriven && sender != _otherNextTasks.end() && wakeTimePoint > _currentTask.timePoint)
+    {
+        InsertWakeTimePoint(_myWakeTimePoints, wakeTimePoint);
+    }
+
+    if (_numEventDrivenParticipants == 0)
+    {
+        return;
+    }
+    for (auto it = _otherNextTasks.begin(); it != _otherNextTasks.end(); ++it)
+    {
+        if (it == sender || !it->second.task.eventDriven || wakeTimePoint <= it->second.task.currentTimePoint)
+        {
+            continue;
+        }
+        InsertWakeTimePoint(it->second.wakeTimePoints, wakeTimePoint);
+        UpdateHeapEntry(it);
+    }
+}
+
+auto TimeConfiguration::MyNextTimePoint() const -> std::chrono::nanoseconds
+{
+    if (_myWakeTimePoints.empty())
+    {
+        return _myNextTask.timePoint;
+    }
+    return std::min(_myNextTask.timePoint, _myWakeTimePoints.front());
+}
+
+void TimeConfiguration::OnReceiveTimeGrant(const std::string& participantName, const NextSimTask& timeGrant)
+{
+    if (!IsTimeCoordinatedByOther() || participantName != _timeCoordinator)
+    {
+        Logging::Error(_logger, "Received time grant from participant \'{}\', which is not the time coordinator",
+                       participantName);
+        return;
+    }
+
+    for (const auto& dependency : timeGrant.timeGrantDependencies)
+    {
+        if (dependency.participantName == _participantName)
+        {
+            continue;
+        }
+        auto it = _receivedTimePoints.find(dependency.participantName);
+        if (it != _receivedTimePoints.end() && it->second >= dependency.timePoint)
+        {
+            continue;
+        }
+        auto result = _pendingTimeGrantDependencies.emplace(dependency.participantName, dependency.timePoint);
+        if (!result.second)
+        {
+            result.first->second = std::max(result.first->second, dependency.timePoint);
+        }
+    }
+
+    _pendingGrantedTimePoint = timeGrant.timePoint;
+    ApplyPendingTimeGrant();
+}
+
+void TimeConfiguration::RemoveTimeGrantDependency(const std::string& participantName,
+                                                  std::chrono::nanoseconds timePoint)
+{
+    auto it = _pendingTimeGrantDependencies.find(participantName);
+    if (it != _pendingTimeGrantDependencies.end() && it->second <= timePoint)
+    {
+        _pendingTimeGrantDependencies.erase(it);
+        ApplyPendingTimeGrant();
+    }
+}
+
+void TimeConfiguration::ApplyPendingTimeGrant()
+{
+    // Until then, the messages sent before the NextSimTasks might not have arrived yet
+    if (_pendingTimeGrantDependencies.empty())
+    {
+        _grantedTimePoint = _pendingGrantedTimePoint;
+    }
+}
+
+bool TimeConfiguration::IsTimeCoordinatedByOther() const
+{
+    return !_timeCoordinator.empty() && !_isTimeCoordinator;
+}
+
+void TimeConfiguration::SiftUp(size_t heapIndex)
+{
+    const auto entry = _otherTimePointHeap[heapIndex];
+    while (heapIndex > 0)
+    {
+        const auto parentIndex = (heapIndex - 1) / 2;
+        if (!(entry.safeTimePoint < _otherTimePointHeap[parentIndex].safeTimePoint))
+        {
+            break;
+        }
+        SetHeapEntry(heapIndex, _otherTimePointHeap[parentIndex]);
+        heapIndex = parentIndex;
+    }
+    SetHeapEntry(heapIndex, entry);
+}
+
+void TimeConfiguration::SiftDown(size_t heapIndex)
+{
+    const auto entry = _otherTimePointHeap[heapIndex];
+    const auto size = _otherTimePointHeap.size();
+    while (true)
+    {
+        auto childIndex = 2 * heapIndex + 1;
+        if (childIndex >= size)
+        {
+            break;
+        }
+        if (childIndex + 1 < size
+            && _otherTimePointHeap[childIndex + 1].safeTimePoint < _otherTimePointHeap[childIndex].safeTimePoint)
+        {
+            ++childIndex;
+        }
+        if (!(_otherTimePointHeap[childIndex].safeTimePoint < entry.safeTimePoint))
+        {
+            break;
+        }
+        SetHeapEntry(heapIndex, _otherTimePointHeap[childIndex]);
+        heapIndex = childIndex;
+    }
+    SetHeapEntry(heapIndex, entry);
+}
+
+void TimeConfiguration::SetHeapEntry(size_t heapIndex, HeapEntry entry)
+{
+    entry.otherNextTaskIt->second.heapIndex = heapIndex;
+    _otherTimePointHeap[heapIndex] = entry;
+}
+
 void TimeConfiguration::Initialize()
 {
     Lock lock{_mx};
     _currentTask.timePoint = -1ns;
     _currentTask.duration = 0ns;
     _myNextTask.timePoint = 0ns;
+    _myNextTask.currentTimePoint = -1ns;
+    _myWakeTimePoints.clear();
+    _myAnnouncedSafeTimePoint = -1ns;
+    _timeGrantDependencies.clear();
+    _grantedTimePoint = -1ns;
+    _pendingGrantedTimePoint = -1ns;
+    _pendingTimeGrantDependencies.clear();
+    _blockingParticipant.clear();
     _hoppedOn = false;
 }
 
@@ -184,12 +580,12 @@ bool TimeConfiguration::HandleHopOn()
             for (const auto& otherTask : _otherNextTasks)
             {
                 // Any other participant has already advanced further that its duration -> HopOn
-                if (otherTask.second.timePoint > otherTask.second.duration)
+                if (otherTask.second.task.timePoint > otherTask.second.task.duration)
                 {
                     _hoppedOn = true;
-                    if (otherTask.second.timePoint < minimalOtherTime)
+                    if (otherTask.second.task.timePoint < minimalOtherTime)
                     {
-                        minimalOtherTime = otherTask.second.timePoint;
+                        minimalOtherTime = otherTask.second.task.timePoint;
                     }
                 }
             }
@@ -23,6 +23,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <chrono>
 #include <map>
 #include <mutex>
+#include <vector>
 
 #include "OrchestrationDatatypes.hpp"
 #include "silkit/services/logging/ILogger.hpp"
@@ -45,10 +46,27 @@ public: //Methods
     void OnReceiveNextSimStep(const std::string& participantName, NextSimTask nextStep);
     void SynchronizedParticipantRemoved(const std::string& otherParticipantName);
     void SetStepDuration(std::chrono::nanoseconds duration);
+    // Other participants may run ahead of this participant by up to the lookahead
+    void SetLookahead(std::chrono::nanoseconds lookahead);
+    // Messages of other participants prepone the next step of an event-driven participant
+    void SetEventDriven(bool eventDriven);
+    bool IsEventDriven() const;
+    // The participants send their NextSimTask only to the time coordinator, which grants the time advances
+    void SetTimeCoordinator(const std::string& coordinatorName, const std::string& participantName);
+    auto GetTimeCoordinator() const -> std::string;
+    bool IsTimeCoordinated() const;
+    bool IsTimeCoordinator() const;
+    // Time coordinator: Returns true and the time grant for all participants, if it changed since the last one
+    bool MakeTimeGrant(NextSimTask& timeGrant);
     void AdvanceTimeStep();
     auto CurrentSimStep() const -> NextSimTask;
     auto NextSimStep() const -> NextSimTask;
+    // Returns the NextSimTask to be sent to the other participants
+    auto AnnounceNextSimStep(bool sentMessages) -> NextSimTask;
+    bool HasAnnouncedNextSimStep() const;
     bool OtherParticipantHasLowerTimepoint() const;
+    // Returns the participant that prevented the last time advance (or the time coordinator), and forgets it
+    auto TakeBlockingParticipant() -> std::string;
     void Initialize();
     bool IsBlocking() const;
 
@@ -57,12 +75,66 @@ public: //Methods
     // Returns true (only once) in the step the actual hop-on happened
     bool HandleHopOn();
 
+private: //Types
+    struct OtherNextTask
+    {
+        NextSimTask task;
+        //! Position of the participant in _otherTimePointHeap
+        size_t heapIndex;
+        //! Event-driven participants: pending wake-ups by messages of others, in ascending order
+        std::vector<std::chrono::nanoseconds> wakeTimePoints{};
+    };
+
+    using OtherNextTasks = std::map<std::string, OtherNextTask>;
+
+    struct HeapEntry
+    {
+        //! Messages of the participant cannot affect others before this time point (timePoint + lookahead, where
+        //! the timePoint of event-driven participants is preponed by their pending wake-ups)
+        std::chrono::nanoseconds safeTimePoint;
+        OtherNextTasks::iterator otherNextTaskIt;
+    };
+
+private: //Methods
+    // The binary min-heap keeps the participant with the lowest safe time point at its front
+    void UpdateOtherNextTask(OtherNextTasks::iterator it, NextSimTask nextTask);
+    void UpdateHeapEntry(OtherNextTasks::iterator it);
+    void EraseOtherNextTask(OtherNextTasks::iterator it);
+    // Event-driven participants wake up at the safe time point of a NextSimTask that follows sent messages
+    void AddWakeTimePoint(OtherNextTasks::iterator sender, std::chrono::nanoseconds wakeTimePoint);
+    auto MyNextTimePoint() const -> std::chrono::nanoseconds;
+    void OnReceiveTimeGrant(const std::string& participantName, const NextSimTask& timeGrant);
+    // The pending time grant is used, once the NextSimTasks it depends on were received
+    void RemoveTimeGrantDependency(const std::string& participantName, std::chrono::nanoseconds timePoint);
+    void ApplyPendingTimeGrant();
+    bool IsTimeCoordinatedByOther() const;
+    void SiftUp(size_t heapIndex);
+    void SiftDown(size_t heapIndex);
+    void SetHeapEntry(size_t heapIndex, HeapEntry entry);
+
 private: //Members
     mutable std::mutex _mx;
     using Lock = std::unique_lock<decltype(_mx)>;
     NextSimTask _currentTask;
     NextSimTask _myNextTask;
-    std::map<std::string, NextSimTask> _otherNextTasks;
+    OtherNextTasks _otherNextTasks;
+    std::vector<HeapEntry> _otherTimePointHeap;
+    size_t _numEventDrivenParticipants{0};
+    std::vector<std::chrono::nanoseconds> _myWakeTimePoints;
+    std::string _timeCoordinator;
+    std::string _participantName;
+    bool _isTimeCoordinator{false};
+    // Time coordinator: safe time point of this participant's last NextSimTask and dependencies of the next time grant
+    std::chrono::nanoseconds _myAnnouncedSafeTimePoint{-1};
+    std::vector<TimeGrantDependency> _timeGrantDependencies;
+    // Last time grant, sent by the time coordinator or used by the other participants
+    std::chrono::nanoseconds _grantedTimePoint{-1};
+    std::chrono::nanoseconds _pendingGrantedTimePoint{-1};
+    std::map<std::string, std::chrono::nanoseconds> _pendingTimeGrantDependencies;
+    // Time points of the NextSimTasks that were received directly from the other participants
+    std::map<std::string, std::chrono::nanoseconds> _receivedTimePoints;
+    // Set by OtherParticipantHasLowerTimepoint, until it is taken for the step profiler
+    mutable std::string _blockingParticipant;
     bool _blocking;
 
     bool _hoppedOn = false;
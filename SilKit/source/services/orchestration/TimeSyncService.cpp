@@ -22,6 +22,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <future>
 #include <functional>
 #include <atomic>
+#include <algorithm>
+#include <fstream>
 
 #include "silkit/services/orchestration/string_utils.hpp"
 #include "silkit/services/orchestration/ISystemMonitor.hpp"
@@ -88,7 +90,25 @@ public:
         if (_controller.State() == ParticipantState::Running
             && !_controller.StopRequested()) // ensure that a call to Stop() in a SimTask won't send out a new step and eventually call the SimTask again
         {
-            _controller.SendMsg(_configuration->NextSimStep());
+            // Event-driven participants are woken up if messages were sent since the last NextSimTask
+            const auto numberOfSentMessages = _participant->GetNumberOfSentMessages();
+            const auto sentMessages = numberOfSentMessages != _numberOfSentMessages;
+            _numberOfSentMessages = numberOfSentMessages;
+            const auto nextTask = _configuration->AnnounceNextSimStep(sentMessages);
+            if (_configuration->IsTimeCoordinator())
+            {
+                // The time grant replaces the NextSimTask of the time coordinator
+                _controller.SendTimeGrant();
+            }
+            else if (_configuration->IsTimeCoordinated() && !sentMessages)
+            {
+                _controller.SendMsg(_configuration->GetTimeCoordinator(), nextTask);
+            }
+            else
+            {
+                // The NextSimTask must arrive behind the sent messages at all participants
+                _controller.SendMsg(nextTask);
+            }
             // Bootstrap checked execution, in case there is no other participant.
             // Else, checked execution is initiated when we receive their NextSimTask messages.
             _participant->ExecuteDeferred([this]() {
@@ -100,6 +120,7 @@ public:
     void ReceiveNextSimTask(const Core::IServiceEndpoint* from, const NextSimTask& task) override
     {
         _configuration->OnReceiveNextSimStep(from->GetServiceDescriptor().GetParticipantName(), task);
+        _controller.SendTimeGrant();
 
         switch (_controller.State())
         {
@@ -229,20 +250,71 @@ private:
     }
 
     std::atomic<bool> _isExecutingSimStep{false};
+    uint64_t _numberOfSentMessages{0};
     TimeSyncService& _controller;
     Core::IParticipantInternal* _participant;
     TimeConfiguration* _configuration;
 };
 
+namespace {
+
+//! True in the states in which the participant relies on the virtual time to advance
+bool IsAwaitingVirtualTime(ParticipantState state)
+{
+    switch (state)
+    {
+    case ParticipantState::ServicesCreated:
+    case ParticipantState::CommunicationInitializing:
+    case ParticipantState::CommunicationInitialized:
+    case ParticipantState::ReadyToRun:
+    case ParticipantState::Running:
+    case ParticipantState::Paused:
+        return true;
+    default:
+        return false;
+    }
+}
+
+} // namespace
+
 TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeProvider* timeProvider,
-                                 const Config::HealthCheck& healthCheckConfig, LifecycleService* lifecycleService)
+                                 const Config::HealthCheck& healthCheckConfig, LifecycleService* lifecycleService,
+                                 const Config::ThreadSettings& watchDogThreadSettings,
+                                 const Config::TimeSynchronization& timeSynchronizationConfig)
     : _participant{participant}
     , _lifecycleService{lifecycleService}
     , _logger{participant->GetLogger()}
     , _timeProvider{timeProvider}
     , _timeConfiguration{participant->GetLogger()}
-    , _watchDog{healthCheckConfig}
+    , _stepProfiler{static_cast<size_t>(std::max(timeSynchronizationConfig.profiledSteps, 0))}
+    , _stepTimelineOutputPath{timeSynchronizationConfig.stepTimelineOutputPath}
+    , _watchDog{healthCheckConfig, nullptr, watchDogThreadSettings, participant->GetLogger()}
 {
+    if (timeSynchronizationConfig.lookahead < 0ns)
+    {
+        throw ConfigurationError{"TimeSynchronization/Lookahead must not be negative"};
+    }
+    _timeConfiguration.SetLookahead(timeSynchronizationConfig.lookahead);
+    _timeConfiguration.SetEventDriven(timeSynchronizationConfig.eventDriven);
+    if (!timeSynchronizationConfig.coordinator.empty())
+    {
+        if (timeSynchronizationConfig.eventDriven)
+        {
+            throw ConfigurationError{
+                "TimeSynchronization/EventDriven cannot be combined with TimeSynchronization/Coordinator"};
+        }
+        _timeConfiguration.SetTimeCoordinator(timeSynchronizationConfig.coordinator, participant->GetParticipantName());
+        _isTimeCoordinator = timeSynchronizationConfig.coordinator == participant->GetParticipantName();
+    }
+    if (timeSynchronizationConfig.profiledSteps < 0)
+    {
+        throw ConfigurationError{"TimeSynchronization/ProfiledSteps must not be negative"};
+    }
+    if (!_stepTimelineOutputPath.empty() && !_stepProfiler.IsEnabled())
+    {
+        throw ConfigurationError{"TimeSynchronization/StepTimelineOutputPath requires TimeSynchronization/ProfiledSteps"};
+    }
+
     _watchDog.SetWarnHandler([logger = _logger](std::chrono::milliseconds timeout) {
         Warn(logger, "SimStep did not finish within soft time limit. Timeout detected after {} ms",
                      std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(timeout).count());
@@ -280,7 +352,10 @@ TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeP
                             // Check capabilities of newly discovered participants. 
                             // This might happen before TimeSyncService and LifecycleService are finally configured,
                             // so this check happens also in TimeSyncService::StartTime() 
-                            if (!ParticipantHasAutonomousSynchronousCapability(descriptorParticipantName))
+                            if (!ParticipantHasAutonomousSynchronousCapability(descriptorParticipantName)
+                                || !ParticipantHasEventDrivenTimeSyncCapability(descriptorParticipantName)
+                                || !ParticipantHasTimeCoordinatorCapability(descriptorParticipantName)
+                                || !ParticipantHasSameTimeCoordinator(descriptor))
                             {
                                 _participant->GetSystemController()->AbortSimulation();
                                 return;
@@ -291,8 +366,18 @@ TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeP
 
                             _timeConfiguration.AddSynchronizedParticipant(descriptorParticipantName);
 
+                            if (_timeConfiguration.IsTimeCoordinated())
+                            {
+                                // The participant only receives the NextSimTasks of others that sent messages. It
+                                // needs ours for a hop-on, and to use time grants depending on our earlier ones.
+                                if (_timeConfiguration.HasAnnouncedNextSimStep())
+                                {
+                                    SendMsg(descriptorParticipantName, _timeConfiguration.NextSimStep());
+                                }
+                                SendTimeGrant();
+                            }
                             // If our time has advanced, we just added a late-joining participant. 
-                            if (_timeConfiguration.CurrentSimStep().timePoint >= 0ns)
+                            else if (_timeConfiguration.CurrentSimStep().timePoint >= 0ns)
                             {
                                 // Resend our NextSimTask again because it is not assured that the late-joiner has seen our last update.
                                 // At this point, the late-joiner will receive it because its TimeSyncPolicy is configured when the 
@@ -312,6 +397,17 @@ TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeP
                                       "distributed time synchronization.",
                                       descriptorParticipantName);
 
+                                if (descriptorParticipantName == _timeConfiguration.GetTimeCoordinator()
+                                    && IsAwaitingVirtualTime(State()))
+                                {
+                                    // Nobody grants the time advances anymore, the participant would block forever
+                                    _lifecycleService->ReportError("The time coordinator '" + descriptorParticipantName
+                                                                   + "' left the simulation, the virtual time cannot "
+                                                                     "advance anymore");
+                                    return;
+                                }
+
+                                SendTimeGrant();
                                 if (_timeSyncPolicy)
                                 {
                                     // _otherNextTasks has changed, check if our sim task is due
@@ -408,6 +504,31 @@ void TimeSyncService::ReceiveMsg(const IServiceEndpoint* from, const NextSimTask
     }
 }
 
+namespace {
+
+//! Writes the messages buffered during a simulation step, also if the step handler throws
+class SendBufferingScope
+{
+public:
+    explicit SendBufferingScope(Core::IParticipantInternal* participant)
+        : _participant{participant}
+    {
+        _participant->StartSendBuffering();
+    }
+    ~SendBufferingScope()
+    {
+        _participant->FlushSendBuffers();
+    }
+
+    SendBufferingScope(const SendBufferingScope&) = delete;
+    SendBufferingScope& operator=(const SendBufferingScope&) = delete;
+
+private:
+    Core::IParticipantInternal* _participant;
+};
+
+} // namespace
+
 void TimeSyncService::ExecuteSimStep(std::chrono::nanoseconds timePoint, std::chrono::nanoseconds duration)
 {
     SILKIT_ASSERT(_simTask);
@@ -417,17 +538,78 @@ void TimeSyncService::ExecuteSimStep(std::chrono::nanoseconds timePoint, std::ch
     Trace(_logger, "Starting next Simulation Task. Waiting time was: {}ms",
                    std::chrono::duration_cast<DoubleMSecs>(_waitTimeMonitor.CurrentDuration()).count());
 
+    StepRecord stepRecord;
+    if (_stepProfiler.IsEnabled())
+    {
+        stepRecord.timePoint = timePoint;
+        stepRecord.duration = duration;
+        stepRecord.startTime = std::chrono::system_clock::now();
+        // The waiting time is only measured from the end of the first step on
+        if (_execTimeMonitor.SampleCount() > 0)
+        {
+            stepRecord.waitTime = _waitTimeMonitor.CurrentDuration();
+        }
+        stepRecord.blockingParticipant = _timeConfiguration.TakeBlockingParticipant();
+    }
+
     _timeProvider->SetTime(timePoint, duration);
 
     _execTimeMonitor.StartMeasurement();
     _watchDog.Start();
-    _simTask(timePoint, duration);
+    {
+        // The messages sent by the handler are written together, before the NextSimTask of this participant
+        SendBufferingScope sendBuffering{_participant};
+        _simTask(timePoint, duration);
+    }
     _watchDog.Reset();
     _execTimeMonitor.StopMeasurement();
 
     Trace(_logger, "Finished Simulation Step. Execution time was: {}ms",
                    std::chrono::duration_cast<DoubleMSecs>(_execTimeMonitor.CurrentDuration()).count());
     _waitTimeMonitor.StartMeasurement();
+
+    if (_stepProfiler.IsEnabled())
+    {
+        stepRecord.execTime = _execTimeMonitor.CurrentDuration();
+        _stepProfiler.RecordStep(std::move(stepRecord));
+    }
+}
+
+auto TimeSyncService::GetStepProfiler() const -> const StepProfiler&
+{
+    return _stepProfiler;
+}
+
+void TimeSyncService::WriteStepTimeline()
+{
+    if (_stepTimelineOutputPath.empty())
+    {
+        return;
+    }
+
+    std::ofstream file{_stepTimelineOutputPath, std::ios_base::out | std::ios_base::trunc};
+    if (!file.is_open())
+    {
+        Logging::Error(_logger, "Cannot write the simulation step timeline to \'{}\'", _stepTimelineOutputPath);
+        return;
+    }
+    _stepProfiler.WriteTimeline(file, _participant->GetParticipantName());
+    Logging::Info(_logger, "Wrote the simulation step timeline to \'{}\'", _stepTimelineOutputPath);
+}
+
+void TimeSyncService::SendTimeGrant()
+{
+    if (!_isTimeCoordinator)
+    {
+        return;
+    }
+
+    std::lock_guard<decltype(_timeGrantMx)> lock{_timeGrantMx};
+    NextSimTask timeGrant;
+    if (_timeConfiguration.MakeTimeGrant(timeGrant))
+    {
+        SendMsg(std::move(timeGrant));
+    }
 }
 
 void TimeSyncService::CompleteSimulationStep()
@@ -455,6 +637,8 @@ void TimeSyncService::InitializeTimeSyncPolicy(bool isSynchronizingVirtualTime)
         }
 
         _serviceDescriptor.SetSupplementalDataItem(SilKit::Core::Discovery::timeSyncActive, (isSynchronizingVirtualTime) ? "1" : "0");
+        _serviceDescriptor.SetSupplementalDataItem(SilKit::Core::Discovery::timeSyncCoordinator,
+                                                   _timeConfiguration.GetTimeCoordinator());
         ResetTime();
     }
     catch (const std::exception& e)
@@ -482,11 +666,15 @@ void TimeSyncService::StartTime()
         SILKIT_ASSERT(timeSyncPolicy);
         if (_isSynchronizingVirtualTime)
         {
+            const auto synchronizedParticipantNames = _timeConfiguration.GetSynchronizedParticipantNames();
+
             // Check if all synchronous participants have the necessary capabilities
             bool missingCapability = false;
-            for (auto&& participantName : _timeConfiguration.GetSynchronizedParticipantNames())
+            for (auto&& participantName : synchronizedParticipantNames)
             {
-                if (!ParticipantHasAutonomousSynchronousCapability(participantName))
+                if (!ParticipantHasAutonomousSynchronousCapability(participantName)
+                    || !ParticipantHasEventDrivenTimeSyncCapability(participantName)
+                    || !ParticipantHasTimeCoordinatorCapability(participantName))
                 {
                     missingCapability = true; 
                 }
@@ -495,6 +683,18 @@ void TimeSyncService::StartTime()
             {
                 _participant->GetSystemController()->AbortSimulation();
             }
+
+            // A misspelled coordinator name would block all participants without further notice
+            const auto timeCoordinator = _timeConfiguration.GetTimeCoordinator();
+            if (_timeConfiguration.IsTimeCoordinated() && !_timeConfiguration.IsTimeCoordinator()
+                && std::find(synchronizedParticipantNames.begin(), synchronizedParticipantNames.end(), timeCoordinator)
+                       == synchronizedParticipantNames.end())
+            {
+                Warn(_logger,
+                     "TimeSyncService: The time coordinator '{}' is not among the synchronized participants, the "
+                     "virtual time does not advance until it joins",
+                     timeCoordinator);
+            }
         }
         // Start the distributed time algorithm by sending our NextSimStep
         GetTimeSyncPolicy()->RequestNextStep();
@@ -528,6 +728,52 @@ bool TimeSyncService::ParticipantHasAutonomousSynchronousCapability(const std::s
     return true;
 }
 
+bool TimeSyncService::ParticipantHasEventDrivenTimeSyncCapability(const std::string& participantName) const
+{
+    if (_timeConfiguration.IsEventDriven()
+        && !_participant->ParticipantHasCapability(participantName, SilKit::Core::Capabilities::EventDrivenTimeSync))
+    {
+        // We are an event-driven participant. The remote participant would not wait for our wake-ups.
+        Error(_participant->GetLogger(),
+              "Participant \'{}\' does not support simulations with event-driven participants "
+              "(TimeSynchronization/EventDriven). Please consider upgrading Participant \'{}\'. Aborting simulation...",
+              participantName, participantName);
+        return false;
+    }
+    return true;
+}
+
+bool TimeSyncService::ParticipantHasTimeCoordinatorCapability(const std::string& participantName) const
+{
+    if (_timeConfiguration.IsTimeCoordinated()
+        && !_participant->ParticipantHasCapability(participantName, SilKit::Core::Capabilities::TimeCoordinator))
+    {
+        // The remote participant would neither send its NextSimTask to the time coordinator nor use the time grants.
+        Error(_participant->GetLogger(),
+              "Participant \'{}\' does not support simulations with a time coordinator "
+              "(TimeSynchronization/Coordinator). Please consider upgrading Participant \'{}\'. Aborting simulation...",
+              participantName, participantName);
+        return false;
+    }
+    return true;
+}
+
+bool TimeSyncService::ParticipantHasSameTimeCoordinator(const Core::ServiceDescriptor& descriptor) const
+{
+    std::string timeCoordinator;
+    descriptor.GetSupplementalDataItem(Core::Discovery::timeSyncCoordinator, timeCoordinator);
+    if (timeCoordinator != _timeConfiguration.GetTimeCoordinator())
+    {
+        Error(_participant->GetLogger(),
+              "Participant \'{}\' uses the time coordinator \'{}\', but this participant uses \'{}\'. "
+              "TimeSynchronization/Coordinator must be the same for all synchronized participants. Aborting "
+              "simulation...",
+              descriptor.GetParticipantName(), timeCoordinator, _timeConfiguration.GetTimeCoordinator());
+        return false;
+    }
+    return true;
+}
+
 bool TimeSyncService::AbortHopOnForCoordinatedParticipants() const
 {
     if (_lifecycleService)
@@ -33,6 +33,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "LifecycleService.hpp"
 #include "ParticipantConfiguration.hpp"
 #include "PerformanceMonitor.hpp"
+#include "StepProfiler.hpp"
 #include "TimeProvider.hpp"
 #include "TimeConfiguration.hpp"
 #include "WatchDog.hpp"
@@ -61,7 +62,9 @@ public:
     // ----------------------------------------
     // Constructors, Destructor, and Assignment
     TimeSyncService(Core::IParticipantInternal* participant, ITimeProvider* timeProvider,
-                    const Config::HealthCheck& healthCheckConfig, LifecycleService* lifecycleService);
+                    const Config::HealthCheck& healthCheckConfig, LifecycleService* lifecycleService,
+                    const Config::ThreadSettings& watchDogThreadSettings = {},
+                    const Config::TimeSynchronization& timeSynchronizationConfig = {});
 
 public:
     // ----------------------------------------
@@ -78,6 +81,10 @@ public:
     // Used by Policies
     template <class MsgT>
     void SendMsg(MsgT&& msg) const;
+    template <class MsgT>
+    void SendMsg(const std::string& targetParticipantName, MsgT&& msg) const;
+    // Time coordinator: Sends the time grant to all participants, if it changed
+    void SendTimeGrant();
     void ExecuteSimStep(std::chrono::nanoseconds timePoint, std::chrono::nanoseconds duration);
 
     // Get the instance of the internal ITimeProvider that is updated with our simulation time
@@ -99,10 +106,17 @@ public:
     auto GetTimeConfiguration() -> TimeConfiguration*;
 
     bool ParticipantHasAutonomousSynchronousCapability(const std::string& participantName) const;
+    bool ParticipantHasEventDrivenTimeSyncCapability(const std::string& participantName) const;
+    bool ParticipantHasTimeCoordinatorCapability(const std::string& participantName) const;
+    bool ParticipantHasSameTimeCoordinator(const Core::ServiceDescriptor& descriptor) const;
     bool AbortHopOnForCoordinatedParticipants() const;
 
     auto StopRequested() const -> bool;
 
+    auto GetStepProfiler() const -> const StepProfiler&;
+    // Writes the recorded simulation steps to TimeSynchronization/StepTimelineOutputPath, if it is configured
+    void WriteStepTimeline();
+
 private:
     // ----------------------------------------
     // private methods
@@ -124,6 +138,8 @@ private:
     TimeConfiguration _timeConfiguration;
 
     mutable std::mutex _timeSyncPolicyMx;
+    // Time grants are sent in the order they are made
+    std::mutex _timeGrantMx;
     std::shared_ptr<ITimeSyncPolicy> _timeSyncPolicy{nullptr};
 
     std::vector<std::string> _requiredParticipants;
@@ -131,12 +147,16 @@ private:
     bool _isRunning{false};
     bool _isSynchronizingVirtualTime{false};
     bool _timeSyncConfigured{false};
+    // Fixed by the configuration, only the time coordinator sends time grants
+    bool _isTimeCoordinator{false};
 
     SimulationStepHandler _simTask;
     std::future<void> _asyncResult;
 
     Util::PerformanceMonitor _execTimeMonitor;
     Util::PerformanceMonitor _waitTimeMonitor;
+    StepProfiler _stepProfiler;
+    std::string _stepTimelineOutputPath;
     WatchDog _watchDog;
 
     // When pausing our participant, message processing is deferred
@@ -154,6 +174,12 @@ void TimeSyncService::SendMsg(MsgT&& msg) const
     _participant->SendMsg(this, std::forward<MsgT>(msg));
 }
 
+template <class MsgT>
+void TimeSyncService::SendMsg(const std::string& targetParticipantName, MsgT&& msg) const
+{
+    _participant->SendMsg(this, targetParticipantName, std::forward<MsgT>(msg));
+}
+
 void TimeSyncService::SetServiceDescriptor(const Core::ServiceDescriptor& serviceDescriptor)
 {
     _serviceDescriptor = serviceDescriptor;
@@ -20,9 +20,12 @@ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include <iostream>
+#include <system_error>
 
 #include "WatchDog.hpp"
 #include "SetThreadName.hpp"
+#include "SetThreadScheduling.hpp"
+#include "ILogger.hpp"
 
 using namespace std::chrono_literals;
 
@@ -36,10 +39,13 @@ namespace SilKit {
 namespace Services {
 namespace Orchestration {
 
-WatchDog::WatchDog(const Config::HealthCheck& healthCheckConfig, IClock* clock)
+WatchDog::WatchDog(const Config::HealthCheck& healthCheckConfig, IClock* clock,
+                   const Config::ThreadSettings& threadSettings, Logging::ILogger* logger)
     : _clock{clock ? clock : GetDefaultClock()}
     , _warnHandler{[](std::chrono::milliseconds) {}}
     , _errorHandler{[](std::chrono::milliseconds) {}}
+    , _threadSettings{threadSettings}
+    , _logger{logger}
 {
     if (healthCheckConfig.softResponseTimeout.has_value())
     {
@@ -93,6 +99,16 @@ void WatchDog::Run()
     };
 
     SilKit::Util::SetThreadName("SilKit-Watchdog");
+    try
+    {
+        SilKit::Util::SetThreadScheduling(_threadSettings.cpuAffinity, _threadSettings.schedulingPolicy,
+                                          _threadSettings.schedulingPriority);
+    }
+    catch (const std::system_error& error)
+    {
+        Logging::Warn(_logger, "WatchDog: Cannot apply the thread settings: {}", error.what());
+    }
+
     WatchDogState state = WatchDogState::Healthy;
     auto stopFuture = _stopPromise.get_future();
 
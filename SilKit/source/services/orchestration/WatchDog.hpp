@@ -27,6 +27,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <memory>
 
 #include "ParticipantConfiguration.hpp"
+#include "silkit/services/logging/ILogger.hpp"
 
 namespace SilKit {
 namespace Services {
@@ -46,7 +47,8 @@ public:
 public:
     // ----------------------------------------
     // Constructors, Destructor, and Assignment
-    WatchDog(const Config::HealthCheck& healthCheckConfig, IClock* clock = nullptr);
+    WatchDog(const Config::HealthCheck& healthCheckConfig, IClock* clock = nullptr,
+             const Config::ThreadSettings& threadSettings = {}, Logging::ILogger* logger = nullptr);
     ~WatchDog();
 
 public:
@@ -86,6 +88,9 @@ private:
     std::function<void(std::chrono::milliseconds)> _warnHandler;
     std::function<void(std::chrono::milliseconds)> _errorHandler;
 
+    Config::ThreadSettings _threadSettings;
+    Logging::ILogger* _logger;
+
     std::thread _watchThread;
 };
 
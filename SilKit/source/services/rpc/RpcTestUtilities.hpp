@@ -109,7 +109,9 @@ struct MockConnection
     }
 
     void OnAllMessagesDelivered(std::function<void()> /*callback*/) {}
+    void StartSendBuffering() {}
     void FlushSendBuffers() {}
+    void RemoveRemoteServiceEndpoint(const SilKit::Core::ServiceDescriptor& /*serviceDescriptor*/) {}
     void ExecuteDeferred(std::function<void()> /*callback*/) {}
     void NotifyShutdown() {}
 
@@ -122,6 +124,13 @@ struct MockConnection
 
     void SetAsyncSubscriptionsCompletionHandler(std::function<void()> /*completionHandler*/){};
 
+    void BeginRegistrationBatch() {}
+    void EndRegistrationBatch() {}
+
+    auto GetJoinSimulationStatistics() const -> SilKit::Core::JoinSimulationStatistics { return {}; }
+    auto GetNumberOfReceivedMessages() const -> uint64_t { return 0; }
+    auto GetPeerStatistics() -> std::vector<SilKit::Experimental::Participant::PeerStatistics> { return {}; }
+
     void Test_SetTimeProvider(SilKit::Services::Orchestration::ITimeProvider* timeProvider)
     {
         for (auto& service : services.rpcClient)
@@ -0,0 +1,272 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include "LzCompression.hpp"
+
+#include <array>
+#include <cstring>
+
+namespace {
+
+//! Shortest back-reference, shorter repetitions are stored as literals.
+constexpr size_t MIN_MATCH{4};
+//! The last bytes of the input are always stored as literals, which keeps the decoder simple.
+constexpr size_t LAST_LITERALS{5};
+//! No match starts within the last bytes of the input.
+constexpr size_t MATCH_FIND_LIMIT{12};
+//! Inputs shorter than this are stored as a single literal run.
+constexpr size_t MIN_INPUT_SIZE{MATCH_FIND_LIMIT + 1};
+constexpr size_t MAX_OFFSET{0xFFFF};
+
+constexpr unsigned HASH_BITS{12};
+//! Consecutive misses increase the step size, so incompressible data is skipped quickly.
+constexpr unsigned SKIP_TRIGGER{6};
+
+constexpr uint8_t RUN_MASK{0x0F};
+
+auto Read32(const uint8_t* p) -> uint32_t
+{
+    uint32_t value;
+    memcpy(&value, p, sizeof value);
+    return value;
+}
+
+auto Hash(uint32_t sequence) -> uint32_t
+{
+    return (sequence * 2654435761u) >> (32 - HASH_BITS);
+}
+
+//! Write the remainder of a run length that did not fit into the token.
+auto WriteLength(uint8_t* op, size_t length) -> uint8_t*
+{
+    while (length >= 255)
+    {
+        *op++ = 255;
+        length -= 255;
+    }
+    *op++ = static_cast<uint8_t>(length);
+    return op;
+}
+
+auto WriteSequence(uint8_t* op, const uint8_t* literals, size_t literalLength, size_t offset, size_t matchLength)
+    -> uint8_t*
+{
+    auto* token = op++;
+
+    if (literalLength >= RUN_MASK)
+    {
+        *token = RUN_MASK << 4;
+        op = WriteLength(op, literalLength - RUN_MASK);
+    }
+    else
+    {
+        *token = static_cast<uint8_t>(literalLength << 4);
+    }
+
+    memcpy(op, literals, literalLength);
+    op += literalLength;
+
+    // the last sequence consists of literals only
+    if (matchLength == 0)
+    {
+        return op;
+    }
+
+    *op++ = static_cast<uint8_t>(offset);
+    *op++ = static_cast<uint8_t>(offset >> 8);
+
+    const auto storedMatchLength = matchLength - MIN_MATCH;
+    if (storedMatchLength >= RUN_MASK)
+    {
+        *token |= RUN_MASK;
+        op = WriteLength(op, storedMatchLength - RUN_MASK);
+    }
+    else
+    {
+        *token |= static_cast<uint8_t>(storedMatchLength);
+    }
+
+    return op;
+}
+
+//! Read the remainder of a run length. Returns false if the input ends prematurely.
+bool ReadLength(const uint8_t*& ip, const uint8_t* inputEnd, size_t& length)
+{
+    uint8_t value;
+    do
+    {
+        if (ip == inputEnd)
+        {
+            return false;
+        }
+        value = *ip++;
+        length += value;
+    } while (value == 255);
+    return true;
+}
+
+} // namespace
+
+
+namespace SilKit {
+namespace Util {
+
+auto LzCompressBound(size_t inputSize) -> size_t
+{
+    return inputSize + inputSize / 255 + 16;
+}
+
+auto LzCompress(const uint8_t* input, size_t inputSize, std::vector<uint8_t>& output) -> size_t
+{
+    const auto outputStart = output.size();
+    output.resize(outputStart + LzCompressBound(inputSize));
+
+    auto* const outputBegin = output.data() + outputStart;
+    auto* op = outputBegin;
+
+    size_t anchor{0};
+
+    if (inputSize >= MIN_INPUT_SIZE)
+    {
+        // positions are stored incremented by one, zero marks an empty slot
+        std::array<uint32_t, 1u << HASH_BITS> table{};
+
+        const size_t matchFindLimit = inputSize - MATCH_FIND_LIMIT;
+        const size_t matchLimit = inputSize - LAST_LITERALS;
+
+        size_t ip{0};
+        size_t misses{0};
+        while (ip < matchFindLimit)
+        {
+            const auto sequence = Read32(input + ip);
+            auto& slot = table[Hash(sequence)];
+            const size_t candidate = slot;
+            slot = static_cast<uint32_t>(ip + 1);
+
+            if (candidate == 0 || ip - (candidate - 1) > MAX_OFFSET || Read32(input + candidate - 1) != sequence)
+            {
+                ip += 1 + (misses++ >> SKIP_TRIGGER);
+                continue;
+            }
+            misses = 0;
+
+            size_t match = candidate - 1;
+
+            // extend the match backwards into the pending literals
+            while (ip > anchor && match > 0 && input[ip - 1] == input[match - 1])
+            {
+                --ip;
+                --match;
+            }
+
+            size_t matchLength{MIN_MATCH};
+            while (ip + matchLength < matchLimit && input[ip + matchLength] == input[match + matchLength])
+            {
+                ++matchLength;
+            }
+
+            op = WriteSequence(op, input + anchor, ip - anchor, ip - match, matchLength);
+
+            ip += matchLength;
+            anchor = ip;
+        }
+    }
+
+    op = WriteSequence(op, input + anchor, inputSize - anchor, 0, 0);
+
+    const auto compressedSize = static_cast<size_t>(op - outputBegin);
+    output.resize(outputStart + compressedSize);
+    return compressedSize;
+}
+
+auto LzDecompress(const uint8_t* input, size_t inputSize, uint8_t* output, size_t outputSize) -> bool
+{
+    const auto* ip = input;
+    const auto* const inputEnd = input + inputSize;
+    auto* op = output;
+    auto* const outputEnd = output + outputSize;
+
+    while (ip != inputEnd)
+    {
+        const auto token = *ip++;
+
+        size_t literalLength = token >> 4;
+        if (literalLength == RUN_MASK && !ReadLength(ip, inputEnd, literalLength))
+        {
+            return false;
+        }
+        if (literalLength > static_cast<size_t>(inputEnd - ip) || literalLength > static_cast<size_t>(outputEnd - op))
+        {
+            return false;
+        }
+
+        memcpy(op, ip, literalLength);
+        ip += literalLength;
+        op += literalLength;
+
+        // the last sequence consists of literals only
+        if (ip == inputEnd)
+        {
+            break;
+        }
+
+        if (inputEnd - ip < 2)
+        {
+            return false;
+        }
+        const size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+        ip += 2;
+
+        size_t matchLength = token & RUN_MASK;
+        if (matchLength == RUN_MASK && !ReadLength(ip, inputEnd, matchLength))
+        {
+            return false;
+        }
+        matchLength += MIN_MATCH;
+
+        if (offset == 0 || offset > static_cast<size_t>(op - output)
+            || matchLength > static_cast<size_t>(outputEnd - op))
+        {
+            return false;
+        }
+
+        const auto* match = op - offset;
+        if (offset >= matchLength)
+        {
+            memcpy(op, match, matchLength);
+            op += matchLength;
+        }
+        else
+        {
+            // the match overlaps the output, i.e., it repeats the last offset bytes
+            for (size_t i = 0; i != matchLength; ++i)
+            {
+                *op++ = *match++;
+            }
+        }
+    }
+
+    return op == outputEnd;
+}
+
+} // namespace Util
+} // namespace SilKit
@@ -0,0 +1,48 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Self-contained LZ77 block codec in the style of LZ4: The compressed block is a sequence of literal runs, each followed
+// by a back-reference (16-bit offset) into the already decompressed data. It trades compression ratio for speed and
+// is meant for compressing network traffic. The block does not store the decompressed size, it must be transmitted
+// separately.
+
+namespace SilKit {
+namespace Util {
+
+//! Upper bound for the size of the compressed block of an input of the given size.
+auto LzCompressBound(size_t inputSize) -> size_t;
+
+//! Compress the input and append the compressed block to the output. Returns the size of the compressed block.
+auto LzCompress(const uint8_t* input, size_t inputSize, std::vector<uint8_t>& output) -> size_t;
+
+//! Decompress the block into the output, which must have exactly the size of the decompressed data. Returns false if
+//! the block is malformed or does not decompress into exactly outputSize bytes.
+auto LzDecompress(const uint8_t* input, size_t inputSize, uint8_t* output, size_t outputSize) -> bool;
+
+} // namespace Util
+} // namespace SilKit
@@ -0,0 +1,124 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "SetThreadScheduling.hpp"
+
+#include <string>
+#include <system_error>
+
+#if _WIN32
+#include <windows.h>
+#else // posix
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace SilKit {
+namespace Util {
+
+#if defined(_WIN32)
+
+void SetThreadScheduling(const std::vector<int>& cpus, ThreadSchedulingPolicy policy, int /*priority*/)
+{
+    HANDLE threadHandle = GetCurrentThread();
+
+    if (!cpus.empty())
+    {
+        DWORD_PTR affinityMask{0};
+        for (const auto cpu : cpus)
+        {
+            if (cpu < 0 || cpu >= static_cast<int>(sizeof(DWORD_PTR) * 8))
+            {
+                throw std::system_error{EINVAL, std::generic_category(), "invalid CPU index " + std::to_string(cpu)};
+            }
+            affinityMask |= DWORD_PTR{1} << cpu;
+        }
+
+        if (SetThreadAffinityMask(threadHandle, affinityMask) == 0)
+        {
+            throw std::system_error{static_cast<int>(GetLastError()), std::system_category(), "SetThreadAffinityMask"};
+        }
+    }
+
+    if (policy != ThreadSchedulingPolicy::Default)
+    {
+        // Windows has no real-time scheduling policies, the closest match is the highest thread priority
+        const auto threadPriority =
+            (policy == ThreadSchedulingPolicy::Fifo) ? THREAD_PRIORITY_TIME_CRITICAL : THREAD_PRIORITY_NORMAL;
+        if (!SetThreadPriority(threadHandle, threadPriority))
+        {
+            throw std::system_error{static_cast<int>(GetLastError()), std::system_category(), "SetThreadPriority"};
+        }
+    }
+}
+
+#else
+
+void SetThreadScheduling(const std::vector<int>& cpus, ThreadSchedulingPolicy policy, int priority)
+{
+    pthread_t thisThread = pthread_self();
+
+    if (!cpus.empty())
+    {
+#   if defined(__linux__)
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        for (const auto cpu : cpus)
+        {
+            if (cpu < 0 || cpu >= CPU_SETSIZE)
+            {
+                throw std::system_error{EINVAL, std::generic_category(), "invalid CPU index " + std::to_string(cpu)};
+            }
+            CPU_SET(cpu, &cpuSet);
+        }
+
+        const auto rc = pthread_setaffinity_np(thisThread, sizeof(cpuSet), &cpuSet);
+        if (rc != 0)
+        {
+            throw std::system_error{rc, std::generic_category(), "pthread_setaffinity_np"};
+        }
+#   else
+        throw std::system_error{ENOTSUP, std::generic_category(), "CPU affinity is not supported on this platform"};
+#   endif
+    }
+
+    if (policy != ThreadSchedulingPolicy::Default)
+    {
+        sched_param param{};
+        int nativePolicy{SCHED_OTHER};
+        if (policy == ThreadSchedulingPolicy::Fifo)
+        {
+            nativePolicy = SCHED_FIFO;
+            param.sched_priority = priority;
+        }
+
+        const auto rc = pthread_setschedparam(thisThread, nativePolicy, &param);
+        if (rc != 0)
+        {
+            throw std::system_error{rc, std::generic_category(), "pthread_setschedparam"};
+        }
+    }
+}
+
+#endif
+
+} // namespace Util
+} // namespace SilKit
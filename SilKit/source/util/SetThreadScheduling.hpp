@@ -0,0 +1,46 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace SilKit {
+namespace Util {
+
+enum class ThreadSchedulingPolicy : uint8_t
+{
+    //! Keep the scheduling policy and priority inherited from the creating thread.
+    Default,
+    //! Regular time-sharing scheduling (SCHED_OTHER).
+    Other,
+    //! Real-time first-in, first-out scheduling with a fixed priority (SCHED_FIFO).
+    Fifo,
+};
+
+// Restrict the current thread to the given CPUs and set its scheduling policy and priority. An empty CPU list and the
+// Default policy leave the respective setting unchanged. The priority is only used by the Fifo policy.
+// Throws std::system_error if the settings cannot be applied, e.g., due to missing privileges.
+void SetThreadScheduling(const std::vector<int>& cpus, ThreadSchedulingPolicy policy, int priority);
+
+} // namespace Util
+} // namespace SilKit
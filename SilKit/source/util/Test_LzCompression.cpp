@@ -0,0 +1,152 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include "gtest/gtest.h"
+
+#include "LzCompression.hpp"
+
+#include <numeric>
+#include <random>
+
+namespace {
+
+using namespace SilKit::Util;
+
+auto Compress(const std::vector<uint8_t>& input) -> std::vector<uint8_t>
+{
+    std::vector<uint8_t> compressed;
+    const auto compressedSize = LzCompress(input.data(), input.size(), compressed);
+    EXPECT_EQ(compressedSize, compressed.size());
+    EXPECT_LE(compressed.size(), LzCompressBound(input.size()));
+    return compressed;
+}
+
+auto Decompress(const std::vector<uint8_t>& compressed, size_t size) -> std::vector<uint8_t>
+{
+    std::vector<uint8_t> output(size);
+    EXPECT_TRUE(LzDecompress(compressed.data(), compressed.size(), output.data(), output.size()));
+    return output;
+}
+
+auto MakeRandomBytes(size_t size) -> std::vector<uint8_t>
+{
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<int> distribution{0, 255};
+
+    std::vector<uint8_t> bytes(size);
+    for (auto& byte : bytes)
+    {
+        byte = static_cast<uint8_t>(distribution(generator));
+    }
+    return bytes;
+}
+
+TEST(Test_LzCompression, roundtrip_of_small_inputs)
+{
+    for (size_t size = 0; size != 64; ++size)
+    {
+        std::vector<uint8_t> input(size);
+        std::iota(input.begin(), input.end(), uint8_t{0});
+
+        EXPECT_EQ(Decompress(Compress(input), input.size()), input) << "size " << size;
+    }
+}
+
+TEST(Test_LzCompression, repetitive_input_is_compressed)
+{
+    std::vector<uint8_t> input;
+    for (size_t index = 0; index != 64 * 1024; ++index)
+    {
+        input.push_back(static_cast<uint8_t>(index % 7 == 0 ? 0xAA : index % 3));
+    }
+
+    const auto compressed = Compress(input);
+    EXPECT_LT(compressed.size(), input.size() / 10);
+    EXPECT_EQ(Decompress(compressed, input.size()), input);
+}
+
+TEST(Test_LzCompression, overlapping_matches_of_a_single_byte)
+{
+    const std::vector<uint8_t> input(100000, 0x55);
+
+    const auto compressed = Compress(input);
+    EXPECT_LT(compressed.size(), 1024u);
+    EXPECT_EQ(Decompress(compressed, input.size()), input);
+}
+
+TEST(Test_LzCompression, random_input_roundtrip)
+{
+    auto input = MakeRandomBytes(200000);
+    // add some repetitions beyond the maximum offset
+    std::copy(input.begin(), input.begin() + 1000, input.begin() + 100000);
+
+    EXPECT_EQ(Decompress(Compress(input), input.size()), input);
+}
+
+TEST(Test_LzCompression, compressed_block_is_appended_to_the_output)
+{
+    const std::vector<uint8_t> input(1000, 1);
+
+    std::vector<uint8_t> output{9, 8, 7};
+    const auto compressedSize = LzCompress(input.data(), input.size(), output);
+    ASSERT_EQ(output.size(), 3 + compressedSize);
+    EXPECT_EQ(output[0], 9);
+
+    std::vector<uint8_t> decompressed(input.size());
+    EXPECT_TRUE(LzDecompress(output.data() + 3, compressedSize, decompressed.data(), decompressed.size()));
+    EXPECT_EQ(decompressed, input);
+}
+
+TEST(Test_LzCompression, wrong_output_size_is_rejected)
+{
+    const std::vector<uint8_t> input(1000, 1);
+    const auto compressed = Compress(input);
+
+    std::vector<uint8_t> output(input.size() + 1);
+    EXPECT_FALSE(LzDecompress(compressed.data(), compressed.size(), output.data(), input.size() - 1));
+    EXPECT_FALSE(LzDecompress(compressed.data(), compressed.size(), output.data(), input.size() + 1));
+}
+
+TEST(Test_LzCompression, malformed_input_is_rejected)
+{
+    auto input = MakeRandomBytes(4096);
+    std::copy(input.begin(), input.begin() + 2048, input.begin() + 2048);
+    const auto compressed = Compress(input);
+
+    std::vector<uint8_t> output(input.size());
+
+    // truncated blocks
+    for (size_t size = 0; size < compressed.size(); size += 97)
+    {
+        EXPECT_FALSE(LzDecompress(compressed.data(), size, output.data(), output.size()));
+    }
+
+    // garbage must not be read or written out of bounds, regardless of the result
+    for (int seed = 0; seed != 100; ++seed)
+    {
+        auto garbage = MakeRandomBytes(256);
+        garbage[0] = static_cast<uint8_t>(seed);
+        LzDecompress(garbage.data(), garbage.size(), output.data(), output.size());
+    }
+}
+
+} // namespace
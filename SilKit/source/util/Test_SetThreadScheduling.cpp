@@ -0,0 +1,79 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "SetThreadScheduling.hpp"
+
+#include <system_error>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+
+using SilKit::Util::SetThreadScheduling;
+using SilKit::Util::ThreadSchedulingPolicy;
+
+TEST(Test_SetThreadScheduling, default_settings_are_a_no_op)
+{
+    EXPECT_NO_THROW(SetThreadScheduling({}, ThreadSchedulingPolicy::Default, 0));
+}
+
+TEST(Test_SetThreadScheduling, invalid_cpu_index_throws)
+{
+    std::thread thread{[] {
+        EXPECT_THROW(SetThreadScheduling({-1}, ThreadSchedulingPolicy::Default, 0), std::system_error);
+    }};
+    thread.join();
+}
+
+TEST(Test_SetThreadScheduling, other_policy_can_be_set_without_privileges)
+{
+    std::thread thread{[] {
+        EXPECT_NO_THROW(SetThreadScheduling({}, ThreadSchedulingPolicy::Other, 0));
+    }};
+    thread.join();
+}
+
+#if defined(__linux__)
+TEST(Test_SetThreadScheduling, pin_thread_to_current_cpu)
+{
+    std::thread thread{[] {
+        const auto cpu = sched_getcpu();
+        ASSERT_GE(cpu, 0);
+
+        SetThreadScheduling({cpu}, ThreadSchedulingPolicy::Default, 0);
+
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        ASSERT_EQ(pthread_getaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet), 0);
+        EXPECT_EQ(CPU_COUNT(&cpuSet), 1);
+        EXPECT_TRUE(CPU_ISSET(cpu, &cpuSet));
+    }};
+    thread.join();
+}
+#endif
+
+} // namespace
@@ -154,6 +154,11 @@ void OverrideFromRegistryConfiguration(std::shared_ptr<SilKit::Config::IParticip
     {
         config->middleware.enableDomainSockets = registryConfiguration.enableDomainSockets.value();
     }
+
+    if (registryConfiguration.threads.has_value())
+    {
+        config->middleware.threads = registryConfiguration.threads.value();
+    }
 }
 
 void SanitizeConfiguration(std::shared_ptr<SilKit::Config::IParticipantConfiguration> configuration,
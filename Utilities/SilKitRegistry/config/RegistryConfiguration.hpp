@@ -43,6 +43,7 @@ struct RegistryConfiguration
     SilKit::Util::Optional<bool> enableDomainSockets;
     SilKit::Util::Optional<std::string> dashboardUri;
     SilKit::Config::Logging logging{};
+    SilKit::Util::Optional<SilKit::Config::Threads> threads;
 };
 
 } // namespace V1
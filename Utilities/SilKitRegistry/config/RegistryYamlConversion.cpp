@@ -50,6 +50,7 @@ Node Converter::encode(const V1::RegistryConfiguration& obj)
     optional_encode(obj.enableDomainSockets, node, "EnableDomainSockets");
     optional_encode(obj.dashboardUri, node, "DashboardUri");
     non_default_encode(obj.logging, node, "Logging", defaultObj.logging);
+    optional_encode(obj.threads, node, "Threads");
 
     return node;
 }
@@ -62,6 +63,7 @@ bool Converter::decode(const Node& node, V1::RegistryConfiguration& obj)
     optional_decode(obj.enableDomainSockets, node, "EnableDomainSockets");
     optional_decode(obj.dashboardUri, node, "DashboardUri");
     optional_decode(obj.logging, node, "Logging");
+    optional_decode(obj.threads, node, "Threads");
 
     if (obj.logging.logFromRemotes)
     {
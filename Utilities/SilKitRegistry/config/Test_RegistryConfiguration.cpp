@@ -47,6 +47,13 @@ void CheckFull(const SilKitRegistry::Config::V1::RegistryConfiguration& c)
 
     ASSERT_TRUE(c.dashboardUri.has_value());
     EXPECT_EQ(c.dashboardUri.value(), "http://dashboard.example.com:1234");
+
+    ASSERT_TRUE(c.threads.has_value());
+    EXPECT_EQ(c.threads.value().io.cpuAffinity, std::vector<int>{1});
+    EXPECT_EQ(c.threads.value().io.schedulingPolicy, SilKit::Util::ThreadSchedulingPolicy::Fifo);
+    EXPECT_EQ(c.threads.value().io.schedulingPriority, 20);
+    EXPECT_EQ(c.threads.value().dashboard.cpuAffinity, std::vector<int>{0});
+    EXPECT_EQ(c.threads.value().dashboard.schedulingPolicy, SilKit::Util::ThreadSchedulingPolicy::Default);
 }
 
 TEST(Test_RegistryConfiguration, FullJson)
@@ -72,6 +79,7 @@ void CheckEmpty(const SilKitRegistry::Config::V1::RegistryConfiguration& c)
     ASSERT_FALSE(c.enableDomainSockets.has_value());
     ASSERT_EQ(c.logging.sinks.size(), 0);
     ASSERT_FALSE(c.dashboardUri.has_value());
+    ASSERT_FALSE(c.threads.has_value());
 }
 
 TEST(Test_RegistryConfiguration, EmptyJson)